@@ -21,35 +21,44 @@
 #include "Model.h"
 #include "EquationSet.h"
 
+#include <cstring>
+#include <thread>
+
 ///////////////////////////////////////////////////////////////////////////////
 // ExchangeBuffer
 ///////////////////////////////////////////////////////////////////////////////
 
 void ExchangeBuffer::Reset() {
-	if (m_dSendBuffer.GetByteSize() < sizeof(MessageHeader)) {
-		_EXCEPTION1("Invalid ExchangeBuffer send buffer (%i)",
-			m_dSendBuffer.GetByteSize());
-	}
 	if (sizeof(MessageHeader) % sizeof(double) != 0) {
 		_EXCEPTIONT("sizeof(MessageHeader) % sizeof(double) != 0");
 	}
 
-	// Store ExchangeBuffer::MessageHeader
-	GetSendMessageHeader((MessageHeader *)(&(m_dSendBuffer[0])));
-
 	// Set read and write indices to just beyond the MessageHeader
 	m_ixRecvBuffer = sizeof(MessageHeader) / sizeof(double);
 	m_ixSendBuffer = sizeof(MessageHeader) / sizeof(double);
+
+	// Data copied directly to a patch on this processor has no message
+	if (m_pLocalTarget != NULL) {
+		return;
+	}
+
+	if (m_dSendBuffer.GetByteSize() < sizeof(MessageHeader)) {
+		_EXCEPTION1("Invalid ExchangeBuffer send buffer (%i)",
+			m_dSendBuffer.GetByteSize());
+	}
+
+	// Store ExchangeBuffer::MessageHeader
+	GetSendMessageHeader((MessageHeader *)(&(m_dSendBuffer[0])));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void ExchangeBuffer::Pack(
-	const DataArray3D<double> & data
-) {
-	const size_t sAElements = data.GetSize(0);
-	const size_t sBElements = data.GetSize(1);
-	const size_t sRElements = data.GetSize(2);
+void ExchangeBuffer::GetSendNodes(
+	size_t sAElements,
+	size_t sBElements,
+	std::vector<int> & vecNodes
+) const {
+	vecNodes.clear();
 
 	// Check matrix bounds
 	if (((m_dir == Direction_Right) || (m_dir == Direction_Left)) &&
@@ -72,341 +81,186 @@ void ExchangeBuffer::Pack(
 	int ixBBoundaryBegin;
 	int ixBBoundaryEnd;
 
-	// Maximum index for radial elements
-	int nVarRElements;
-
-	// Pack data to send right
+	// Send data rightward
 	if (m_dir == Direction_Right) {
 		ixBoundaryBegin = sAElements - 2 * m_sHaloElements;
 		ixBoundaryEnd   = sAElements - m_sHaloElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
-
-		// Pack the SendBuffer
 		if (m_fReverseDirection) {
 			for (int i = ixBoundaryBegin; i < ixBoundaryEnd; i++) {
 			for (int j = m_ixSecond-1; j >= m_ixFirst; j--) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 
 		} else {
 			for (int i = ixBoundaryBegin; i < ixBoundaryEnd; i++) {
 			for (int j = m_ixFirst; j < m_ixSecond; j++) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);	
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 		}
-	
-	// Pack data to send topward
+
+	// Send data topward
 	} else if (m_dir == Direction_Top) {
 		ixBoundaryBegin = sBElements - 2 * m_sHaloElements;
 		ixBoundaryEnd   = sBElements - m_sHaloElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
-
-		// Pack the SendBuffer
 		if (m_fReverseDirection) {
 			for (int j = ixBoundaryBegin; j < ixBoundaryEnd; j++) {
 			for (int i = m_ixSecond-1; i >= m_ixFirst; i--) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 
 		} else {
 			for (int j = ixBoundaryBegin; j < ixBoundaryEnd; j++) {
 			for (int i = m_ixFirst; i < m_ixSecond; i++) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 		}
 
-	// Pack data to send left
+	// Send data leftward
 	} else if (m_dir == Direction_Left) {
 		ixBoundaryBegin = m_sHaloElements;
 		ixBoundaryEnd   = 2 * m_sHaloElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
-
-		// Pack the SendBuffer
 		if (m_fReverseDirection) {
 			for (int i = ixBoundaryEnd-1; i >= ixBoundaryBegin; i--) {
 			for (int j = m_ixSecond-1; j >= m_ixFirst; j--) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 
 		} else {
 			for (int i = ixBoundaryEnd-1; i >= ixBoundaryBegin; i--) {
 			for (int j = m_ixFirst; j < m_ixSecond; j++) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 		}
 
-	// Pack data to send bottomward
+	// Send data bottomward
 	} else if (m_dir == Direction_Bottom) {
 		ixBoundaryBegin = m_sHaloElements;
 		ixBoundaryEnd   = 2 * m_sHaloElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
-
-		// Pack the SendBuffer
 		if (m_fReverseDirection) {
 			for (int j = ixBoundaryEnd-1; j >= ixBoundaryBegin; j--) {
 			for (int i = m_ixSecond-1; i >= m_ixFirst; i--) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 
 		} else {
 			for (int j = ixBoundaryEnd-1; j >= ixBoundaryBegin; j--) {
 			for (int i = m_ixFirst; i < m_ixSecond; i++) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 		}
 
-	// Pack data to send toprightward 
+	// Send data toprightward
 	} else if (m_dir == Direction_TopRight) {
 		ixABoundaryBegin = m_ixFirst - m_sHaloElements + 1;
 		ixABoundaryEnd   = m_ixFirst + 1;
 		ixBBoundaryBegin = m_ixSecond - m_sHaloElements + 1;
 		ixBBoundaryEnd   = m_ixSecond + 1;
- 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
 
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
-
-		// Pack the SendBuffer
 		if (m_fReverseDirection) {
 			for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
 			for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 
 		} else {
 			for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
 			for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 		}
 
-	// Pack data to send topleftward 
+	// Send data topleftward
 	} else if (m_dir == Direction_TopLeft) {
 		ixABoundaryBegin = m_ixFirst;
 		ixABoundaryEnd   = m_ixFirst + m_sHaloElements;
 		ixBBoundaryBegin = m_ixSecond - m_sHaloElements + 1;
 		ixBBoundaryEnd   = m_ixSecond + 1;
- 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
 
-		// Pack the SendBuffer
 		if (m_fReverseDirection) {
 			for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
 			for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 
 		} else {
 			for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
 			for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 		}
 
-	// Pack data to send bottomleftward 
+	// Send data bottomleftward
 	} else if (m_dir == Direction_BottomLeft) {
 		ixABoundaryBegin = m_ixFirst;
 		ixABoundaryEnd   = m_ixFirst + m_sHaloElements;
 		ixBBoundaryBegin = m_ixSecond;
 		ixBBoundaryEnd   = m_ixSecond + m_sHaloElements;
- 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
 
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
-
-		// Pack the SendBuffer
 		if (m_fReverseDirection) {
 			for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
 			for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 
 		} else {
 			for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
 			for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 		}
 
-	// Pack data to send bottomrightward 
+	// Send data bottomrightward
 	} else if (m_dir == Direction_BottomRight) {
 		ixABoundaryBegin = m_ixFirst - m_sHaloElements + 1;
 		ixABoundaryEnd   = m_ixFirst + 1;
 		ixBBoundaryBegin = m_ixSecond;
 		ixBBoundaryEnd   = m_ixSecond + m_sHaloElements;
- 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixSendBuffer + nTotalValues > m_dSendBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
-		}
 
-		// Pack the SendBuffer
 		if (m_fReverseDirection) {
 			for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
 			for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 
 		} else {
 			for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
 			for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-#pragma simd
-				for (int k = 0; k < sRElements; k++) {
-					m_dSendBuffer[m_ixSendBuffer + k] =
-						data(i,j,k);
-				}
-				m_ixSendBuffer += sRElements;
+				vecNodes.push_back(i);
+				vecNodes.push_back(j);
 			}
 			}
 		}
@@ -419,51 +273,12 @@ void ExchangeBuffer::Pack(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void ExchangeBuffer::Pack(
-	const Grid & grid,
-	const DataArray4D<double> & data
-) {
-	// Number of components in data
-	size_t sComponents = data.GetSize(0);
-
-	// 3D Grid Data
-	DataArray3D<double> data3D;
-	data3D.SetSize(
-		data.GetSize(1),
-		data.GetSize(2),
-		data.GetSize(3));
-
-	// For state data exclude non-collacted data points
-	if (data.GetDataType() == DataType_State) {
-		// List of variable indices to send
-		// - exclude variables which are not-collocated with this data structure
-		for (int c = 0; c < sComponents; c++) {
-			if (grid.GetVarLocation(c) != data.GetDataLocation()) {
-				continue;
-			}
-			data3D.AttachToData(const_cast<double*>(&(data(c,0,0,0))));
-			Pack(data3D);
-			data3D.Detach();
-		}
-
-	// Send everything
-	} else {
-		for (int c = 0; c < sComponents; c++) {
-			data3D.AttachToData(const_cast<double*>(&(data(c,0,0,0))));
-			Pack(data3D);
-			data3D.Detach();
-		}
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void ExchangeBuffer::Unpack(
-	DataArray3D<double> & data
-) {
-	const size_t sAElements = data.GetSize(0);
-	const size_t sBElements = data.GetSize(1);
-	const size_t sRElements = data.GetSize(2);
+void ExchangeBuffer::GetRecvNodes(
+	size_t sAElements,
+	size_t sBElements,
+	std::vector<int> & vecNodes
+) const {
+	vecNodes.clear();
 
 	// Index for halo elements along boundary
 	int ixBoundaryBegin;
@@ -471,231 +286,110 @@ void ExchangeBuffer::Unpack(
 
 	int ixABoundaryBegin;
 	int ixABoundaryEnd;
-
 	int ixBBoundaryBegin;
 	int ixBBoundaryEnd;
 
-	// Unpack data from right
+	// Receive data from right
 	if (m_dir == Direction_Right) {
 		ixBoundaryBegin = sAElements - m_sHaloElements;
 		ixBoundaryEnd   = sAElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
 		for (int i = ixBoundaryEnd-1; i >= ixBoundaryBegin; i--) {
 		for (int j = m_ixFirst; j < m_ixSecond; j++) {
-#pragma simd
-			for (int k = 0; k < sRElements; k++) {
-				data(i,j,k) =
-					m_dRecvBuffer[m_ixRecvBuffer + k];
-			}
-			m_ixRecvBuffer += sRElements;
+			vecNodes.push_back(i);
+			vecNodes.push_back(j);
 		}
 		}
 
-	// Unpack data from top
+	// Receive data from top
 	} else if (m_dir == Direction_Top) {
 		ixBoundaryBegin = sBElements - m_sHaloElements;
 		ixBoundaryEnd   = sBElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
 		for (int j = ixBoundaryEnd-1; j >= ixBoundaryBegin; j--) {
 		for (int i = m_ixFirst; i < m_ixSecond; i++) {
-#pragma simd
-			for (int k = 0; k < sRElements; k++) {
-				data(i,j,k) =
-					m_dRecvBuffer[m_ixRecvBuffer + k];
-			}
-			m_ixRecvBuffer += sRElements;
+			vecNodes.push_back(i);
+			vecNodes.push_back(j);
 		}
 		}
 
-	// Unpack data from left
+	// Receive data from left
 	} else if (m_dir == Direction_Left) {
 		ixBoundaryBegin = 0;
 		ixBoundaryEnd   = m_sHaloElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
 		for (int i = ixBoundaryBegin; i < ixBoundaryEnd; i++) {
 		for (int j = m_ixFirst; j < m_ixSecond; j++) {
-#pragma simd
-			for (int k = 0; k < sRElements; k++) {
-				data(i,j,k) =
-					m_dRecvBuffer[m_ixRecvBuffer + k];
-			}
-			m_ixRecvBuffer += sRElements;
+			vecNodes.push_back(i);
+			vecNodes.push_back(j);
 		}
 		}
 
-	// Unpack data from bottom
+	// Receive data from bottom
 	} else if (m_dir == Direction_Bottom) {
 		ixBoundaryBegin = 0;
 		ixBoundaryEnd   = m_sHaloElements;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixBoundaryEnd - ixBoundaryBegin)
-			* (m_ixSecond - m_ixFirst);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
 		for (int j = ixBoundaryBegin; j < ixBoundaryEnd; j++) {
 		for (int i = m_ixFirst; i < m_ixSecond; i++) {
-#pragma simd
-			for (int k = 0; k < sRElements; k++) {
-				data(i,j,k) =
-					m_dRecvBuffer[m_ixRecvBuffer + k];
-			}
-			m_ixRecvBuffer += sRElements;
+			vecNodes.push_back(i);
+			vecNodes.push_back(j);
 		}
 		}
 
-	// Unpack data from top-right
+	// Receive data from top-right
 	} else if (m_dir == Direction_TopRight) {
 		ixABoundaryBegin = m_ixFirst + 1;
 		ixABoundaryEnd   = m_ixFirst + m_sHaloElements + 1;
 		ixBBoundaryBegin = m_ixSecond + 1;
 		ixBBoundaryEnd   = m_ixSecond + m_sHaloElements + 1;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
 		for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
 		for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-#pragma simd
-			for (int k = 0; k < sRElements; k++) {
-				data(i,j,k) =
-					m_dRecvBuffer[m_ixRecvBuffer + k];
-			}
-			m_ixRecvBuffer += sRElements;
+			vecNodes.push_back(i);
+			vecNodes.push_back(j);
 		}
 		}
 
-	// Unpack data from top-left
+	// Receive data from top-left
 	} else if (m_dir == Direction_TopLeft) {
 		ixABoundaryBegin = m_ixFirst - m_sHaloElements;
 		ixABoundaryEnd   = m_ixFirst;
 		ixBBoundaryBegin = m_ixSecond + 1;
 		ixBBoundaryEnd   = m_ixSecond + m_sHaloElements + 1;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
 		for (int j = ixBBoundaryEnd-1; j >= ixBBoundaryBegin; j--) {
 		for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-#pragma simd
-			for (int k = 0; k < sRElements; k++) {
-				data(i,j,k) =
-					m_dRecvBuffer[m_ixRecvBuffer + k];
-			}
-			m_ixRecvBuffer += sRElements;
+			vecNodes.push_back(i);
+			vecNodes.push_back(j);
 		}
 		}
 
-	// Unpack data from bottom-left
+	// Receive data from bottom-left
 	} else if (m_dir == Direction_BottomLeft) {
 		ixABoundaryBegin = m_ixFirst - m_sHaloElements;
 		ixABoundaryEnd   = m_ixFirst;
 		ixBBoundaryBegin = m_ixSecond - m_sHaloElements;
 		ixBBoundaryEnd   = m_ixSecond;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
 		for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
 		for (int i = ixABoundaryBegin; i < ixABoundaryEnd; i++) {
-#pragma simd
-			for (int k = 0; k < sRElements; k++) {
-				data(i,j,k) =
-					m_dRecvBuffer[m_ixRecvBuffer + k];
-			}
-			m_ixRecvBuffer += sRElements;
+			vecNodes.push_back(i);
+			vecNodes.push_back(j);
 		}
 		}
 
-	// Unpack data from bottom-right
+	// Receive data from bottom-right
 	} else if (m_dir == Direction_BottomRight) {
 		ixABoundaryBegin = m_ixFirst + 1;
 		ixABoundaryEnd   = m_ixFirst + m_sHaloElements + 1;
 		ixBBoundaryBegin = m_ixSecond - m_sHaloElements;
 		ixBBoundaryEnd   = m_ixSecond;
 
-		// Check that sufficient data remains in send buffer
-		int nTotalValues =
-			  sRElements
-			* (ixABoundaryEnd - ixABoundaryBegin)
-			* (ixBBoundaryEnd - ixBBoundaryBegin);
-
-		if (m_ixRecvBuffer + nTotalValues > m_dRecvBuffer.GetRows()) {
-			_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
-		}
-
-		// Unpack data
 		for (int j = ixBBoundaryBegin; j < ixBBoundaryEnd; j++) {
 		for (int i = ixABoundaryEnd-1; i >= ixABoundaryBegin; i--) {
-#pragma simd
-			for (int k = 0; k < sRElements; k++) {
-				data(i,j,k) =
-					m_dRecvBuffer[m_ixRecvBuffer + k];
-			}
-			m_ixRecvBuffer += sRElements;
+			vecNodes.push_back(i);
+			vecNodes.push_back(j);
 		}
 		}
 
@@ -707,12 +401,137 @@ void ExchangeBuffer::Unpack(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void ExchangeBuffer::Pack(
+	const DataArray3D<double> & data,
+	const std::vector<int> & vecNodes
+) {
+	const size_t sRElements = data.GetSize(2);
+
+	const int nNodes = vecNodes.size() / 2;
+
+	// Check that sufficient data remains in send buffer
+	if (m_ixSendBuffer + nNodes * sRElements > m_dSendBuffer.GetRows()) {
+		_EXCEPTIONT("Insufficient space in SendBuffer for operation.");
+	}
+
+	// Pack the SendBuffer
+	for (int n = 0; n < nNodes; n++) {
+		const int i = vecNodes[2*n];
+		const int j = vecNodes[2*n+1];
+#pragma simd
+		for (int k = 0; k < sRElements; k++) {
+			m_dSendBuffer[m_ixSendBuffer + k] = data(i,j,k);
+		}
+		m_ixSendBuffer += sRElements;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBuffer::Pack(
+	const DataArray3D<double> & data
+) {
+	std::vector<int> vecNodes;
+	GetSendNodes(data.GetSize(0), data.GetSize(1), vecNodes);
+
+	Pack(data, vecNodes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBuffer::Pack(
+	const Grid & grid,
+	const DataArray4D<double> & data
+) {
+	// Number of components in data
+	size_t sComponents = data.GetSize(0);
+	if (sComponents == 0) {
+		return;
+	}
+
+	// 3D Grid Data
+	DataArray3D<double> data3D;
+	data3D.SetSize(
+		data.GetSize(1),
+		data.GetSize(2),
+		data.GetSize(3));
+
+	// Nodes to send
+	std::vector<int> vecNodes;
+	GetSendNodes(data.GetSize(1), data.GetSize(2), vecNodes);
+
+	// For state data exclude non-collacted data points
+	if (data.GetDataType() == DataType_State) {
+		// List of variable indices to send
+		// - exclude variables which are not-collocated with this data structure
+		for (int c = 0; c < sComponents; c++) {
+			if (grid.GetVarLocation(c) != data.GetDataLocation()) {
+				continue;
+			}
+			data3D.AttachToData(const_cast<double*>(&(data(c,0,0,0))));
+			Pack(data3D, vecNodes);
+			data3D.Detach();
+		}
+
+	// Send everything
+	} else {
+		for (int c = 0; c < sComponents; c++) {
+			data3D.AttachToData(const_cast<double*>(&(data(c,0,0,0))));
+			Pack(data3D, vecNodes);
+			data3D.Detach();
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBuffer::Unpack(
+	DataArray3D<double> & data,
+	const std::vector<int> & vecNodes
+) {
+	const size_t sRElements = data.GetSize(2);
+
+	const int nNodes = vecNodes.size() / 2;
+
+	// Check that sufficient data remains in receive buffer
+	if (m_ixRecvBuffer + nNodes * sRElements > m_dRecvBuffer.GetRows()) {
+		_EXCEPTIONT("Insufficient space in RecvBuffer for operation.");
+	}
+
+	// Unpack data
+	for (int n = 0; n < nNodes; n++) {
+		const int i = vecNodes[2*n];
+		const int j = vecNodes[2*n+1];
+#pragma simd
+		for (int k = 0; k < sRElements; k++) {
+			data(i,j,k) = m_dRecvBuffer[m_ixRecvBuffer + k];
+		}
+		m_ixRecvBuffer += sRElements;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBuffer::Unpack(
+	DataArray3D<double> & data
+) {
+	std::vector<int> vecNodes;
+	GetRecvNodes(data.GetSize(0), data.GetSize(1), vecNodes);
+
+	Unpack(data, vecNodes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void ExchangeBuffer::Unpack(
 	const Grid & grid,
 	DataArray4D<double> & data
 ) {
 	// Number of components in data
 	size_t sComponents = data.GetSize(0);
+	if (sComponents == 0) {
+		return;
+	}
 
 	// 3D Grid Data
 	DataArray3D<double> data3D;
@@ -721,6 +540,10 @@ void ExchangeBuffer::Unpack(
 		data.GetSize(2),
 		data.GetSize(3));
 
+	// Nodes to receive
+	std::vector<int> vecNodes;
+	GetRecvNodes(data.GetSize(1), data.GetSize(2), vecNodes);
+
 	// List of variable indices to receive
 	// - exclude variables which are not-collocated with this data structure
 	if (data.GetDataType() == DataType_State) {
@@ -729,7 +552,7 @@ void ExchangeBuffer::Unpack(
 				continue;
 			}
 			data3D.AttachToData(&(data(c,0,0,0)));
-			Unpack(data3D);
+			Unpack(data3D, vecNodes);
 			data3D.Detach();
 		}
 
@@ -737,23 +560,171 @@ void ExchangeBuffer::Unpack(
 	} else {
 		for (int c = 0; c < sComponents; c++) {
 			data3D.AttachToData(&(data(c,0,0,0)));
-			Unpack(data3D);
+			Unpack(data3D, vecNodes);
 			data3D.Detach();
 		}
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBuffer::Copy(
+	const DataArray3D<double> & dataSource,
+	const std::vector<int> & vecSendNodes,
+	DataArray3D<double> & dataTarget,
+	const std::vector<int> & vecRecvNodes
+) {
+	const size_t sRElements = dataSource.GetSize(2);
+
+	const int nNodes = vecSendNodes.size() / 2;
+
+	if ((vecRecvNodes.size() != vecSendNodes.size()) ||
+	    (dataTarget.GetSize(2) != sRElements)
+	) {
+		_EXCEPTIONT("Source and target of ExchangeBuffer copy do not match.");
+	}
+
+	// Copy data from the patch edge into the target halo
+	for (int n = 0; n < nNodes; n++) {
+		const int iSource = vecSendNodes[2*n];
+		const int jSource = vecSendNodes[2*n+1];
+		const int iTarget = vecRecvNodes[2*n];
+		const int jTarget = vecRecvNodes[2*n+1];
+#pragma simd
+		for (int k = 0; k < sRElements; k++) {
+			dataTarget(iTarget,jTarget,k) = dataSource(iSource,jSource,k);
+		}
+	}
+
+	// Account for the copied data as if it had been packed and unpacked
+	m_ixSendBuffer += nNodes * sRElements;
+	m_pLocalTarget->m_ixRecvBuffer += nNodes * sRElements;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBuffer::Copy(
+	const DataArray3D<double> & dataSource,
+	DataArray3D<double> & dataTarget
+) {
+	if (m_pLocalTarget == NULL) {
+		_EXCEPTIONT("ExchangeBuffer has no local target");
+	}
+
+	std::vector<int> vecSendNodes;
+	GetSendNodes(dataSource.GetSize(0), dataSource.GetSize(1), vecSendNodes);
+
+	std::vector<int> vecRecvNodes;
+	m_pLocalTarget->GetRecvNodes(
+		dataTarget.GetSize(0), dataTarget.GetSize(1), vecRecvNodes);
+
+	Copy(dataSource, vecSendNodes, dataTarget, vecRecvNodes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBuffer::Copy(
+	const Grid & grid,
+	const DataArray4D<double> & dataSource,
+	DataArray4D<double> & dataTarget
+) {
+	if (m_pLocalTarget == NULL) {
+		_EXCEPTIONT("ExchangeBuffer has no local target");
+	}
+
+	// Number of components in data
+	size_t sComponents = dataSource.GetSize(0);
+	if (sComponents == 0) {
+		return;
+	}
+
+	if (dataTarget.GetSize(0) != sComponents) {
+		_EXCEPTIONT("Source and target of ExchangeBuffer copy do not match.");
+	}
+
+	// 3D Grid Data
+	DataArray3D<double> data3DSource;
+	data3DSource.SetSize(
+		dataSource.GetSize(1),
+		dataSource.GetSize(2),
+		dataSource.GetSize(3));
+
+	DataArray3D<double> data3DTarget;
+	data3DTarget.SetSize(
+		dataTarget.GetSize(1),
+		dataTarget.GetSize(2),
+		dataTarget.GetSize(3));
+
+	// Nodes to send and receive
+	std::vector<int> vecSendNodes;
+	GetSendNodes(dataSource.GetSize(1), dataSource.GetSize(2), vecSendNodes);
+
+	std::vector<int> vecRecvNodes;
+	m_pLocalTarget->GetRecvNodes(
+		dataTarget.GetSize(1), dataTarget.GetSize(2), vecRecvNodes);
+
+	// Copy all variables, excluding state variables which are not
+	// collocated with this data structure
+	for (int c = 0; c < sComponents; c++) {
+		if ((dataSource.GetDataType() == DataType_State) &&
+		    (grid.GetVarLocation(c) != dataSource.GetDataLocation())
+		) {
+			continue;
+		}
+		data3DSource.AttachToData(
+			const_cast<double*>(&(dataSource(c,0,0,0))));
+		data3DTarget.AttachToData(&(dataTarget(c,0,0,0)));
+		Copy(data3DSource, vecSendNodes, data3DTarget, vecRecvNodes);
+		data3DSource.Detach();
+		data3DTarget.Detach();
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // ExchangeBufferRegistry
 ///////////////////////////////////////////////////////////////////////////////
 
 ExchangeBufferRegistry::ExchangeBufferRegistry() :
-	m_fActiveAsyncSend(false)
+	m_iExchangeIndex(0),
+#ifdef TEMPEST_MPI_SHARED_MEMORY
+	m_commNode(MPI_COMM_NULL),
+	m_winShared(MPI_WIN_NULL),
+#endif
+	m_fActiveAsyncSend(false),
+	m_nMessagesSent(0),
+	m_sBytesSent(0),
+	m_nMessagesReceived(0),
+	m_sBytesReceived(0),
+	m_nLocalMessagesSent(0),
+	m_sLocalBytesSent(0),
+	m_nSharedMemoryMessagesSent(0),
+	m_sSharedMemoryBytesSent(0)
 { }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 ExchangeBufferRegistry::~ExchangeBufferRegistry() {
+#ifdef TEMPEST_MPIOMP
+	// Shared memory can no longer be released once MPI is finalized
+	int fFinalized;
+	MPI_Finalized(&fFinalized);
+	if (fFinalized) {
+		return;
+	}
+#endif
+
+	DeallocateBuffers();
+
+#ifdef TEMPEST_MPI_SHARED_MEMORY
+	if (m_commNode != MPI_COMM_NULL) {
+		MPI_Comm_free(&m_commNode);
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBufferRegistry::DeallocateBuffers() {
 	for (int i = 0; i < m_vecRecvBuffers.size(); i++) {
 		if (m_vecRecvBuffers[i] != NULL) {
 #if defined(__INTEL_COMPILER)
@@ -764,6 +735,11 @@ ExchangeBufferRegistry::~ExchangeBufferRegistry() {
 		}
 	}
 	for (int i = 0; i < m_vecSendBuffers.size(); i++) {
+
+		// Send buffers in the shared memory window are released below
+		if (m_vecTransport[i] == Transport_SharedMemory) {
+			continue;
+		}
 		if (m_vecSendBuffers[i] != NULL) {
 #if defined(__INTEL_COMPILER)
 			_mm_free(m_vecSendBuffers[i]);
@@ -772,6 +748,41 @@ ExchangeBufferRegistry::~ExchangeBufferRegistry() {
 #endif
 		}
 	}
+	m_vecRecvBuffers.clear();
+	m_vecSendBuffers.clear();
+
+#ifdef TEMPEST_MPI_SHARED_MEMORY
+	if (m_winShared != MPI_WIN_NULL) {
+		MPI_Win_unlock_all(m_winShared);
+		MPI_Win_free(&m_winShared);
+	}
+	m_vecSharedSendSlot.clear();
+	m_vecSharedRecvSlot.clear();
+	m_vecSharedSendSlotStride.clear();
+	m_vecSharedRecvSlotStride.clear();
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBufferRegistry::Clear() {
+
+	// Complete any outstanding sends before releasing the buffers
+	WaitSend();
+
+	DeallocateBuffers();
+
+	m_vecRegistry.clear();
+	m_vecAreRecvBuffersAttached.clear();
+	m_vecBufferSize.clear();
+	m_vecProcessors.clear();
+	m_vecRecvRequest.clear();
+	m_vecSendRequest.clear();
+	m_vecSendStatus.clear();
+	m_vecMessageReceived.clear();
+	m_vecTransport.clear();
+	m_vecRegistryByProcessor.clear();
+	m_vecRecvOrderByProcessor.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -829,38 +840,70 @@ void ExchangeBufferRegistry::Allocate() {
 		}
 	}
 
-	// Allocate space per processor
+	// Determine the transport used for each processor
 	{
 		std::map<int, int>::const_iterator iterProcs =
 			mapProcessorToBufferSize.begin();
 		for (; iterProcs != mapProcessorToBufferSize.end(); iterProcs++) {
 			m_vecProcessors.push_back(iterProcs->first);
+			m_vecBufferSize.push_back(iterProcs->second);
+			m_vecTransport.push_back(Transport_MPI);
+		}
+
+#ifdef TEMPEST_MPIOMP
+		int nRank;
+		MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+
+		for (int p = 0; p < m_vecProcessors.size(); p++) {
+			if (m_vecProcessors[p] == nRank) {
+				m_vecTransport[p] = Transport_Local;
+			}
+		}
+#endif
+
+		// Processors on the same node communicate through shared memory
+		AllocateSharedMemory();
+	}
+
+	// Allocate space per processor
+	for (int p = 0; p < m_vecProcessors.size(); p++) {
+		m_vecAreRecvBuffersAttached.push_back(false);
+
+		// Data for patches on this processor is copied without a
+		// message and shared memory send buffers are assigned for each
+		// exchange
+		if (m_vecTransport[p] != Transport_MPI) {
+			m_vecRecvBuffers.push_back(NULL);
+			m_vecSendBuffers.push_back(NULL);
+			continue;
+		}
 
 #if defined(__INTEL_COMPILER)
-			char * pRecvBuffer = (char *)(_mm_malloc(iterProcs->second, 64));
-			char * pSendBuffer = (char *)(_mm_malloc(iterProcs->second, 64));
+		char * pSendBuffer = (char *)(_mm_malloc(m_vecBufferSize[p], 64));
 #else
-			char * pRecvBuffer = new char[iterProcs->second];
-			char * pSendBuffer = new char[iterProcs->second];
+		char * pSendBuffer = new char[m_vecBufferSize[p]];
 #endif
+		if (pSendBuffer == NULL) {
+			_EXCEPTIONT("Out of memory");
+		}
 
-			if (pRecvBuffer == NULL) {
-				_EXCEPTIONT("Out of memory");
-			}
-			if (pSendBuffer == NULL) {
-				_EXCEPTIONT("Out of memory");
-			}
-
-			m_vecBufferSize.push_back(iterProcs->second);
-			m_vecRecvBuffers.push_back(pRecvBuffer);
-			m_vecSendBuffers.push_back(pSendBuffer);
-			m_vecAreRecvBuffersAttached.push_back(false);
+#if defined(__INTEL_COMPILER)
+		char * pRecvBuffer = (char *)(_mm_malloc(m_vecBufferSize[p], 64));
+#else
+		char * pRecvBuffer = new char[m_vecBufferSize[p]];
+#endif
+		if (pRecvBuffer == NULL) {
+			_EXCEPTIONT("Out of memory");
 		}
+
+		m_vecRecvBuffers.push_back(pRecvBuffer);
+		m_vecSendBuffers.push_back(pSendBuffer);
 	}
 
 	// Build lookup table for ExchangeBuffers
 	{
 		m_vecRegistryByProcessor.resize(m_vecProcessors.size());
+		m_vecRecvOrderByProcessor.resize(m_vecProcessors.size());
 		for (int m = 0; m < m_vecRegistry.size(); m++) {
 			int p = 0;
 			for (; p < m_vecProcessors.size(); p++) {
@@ -881,37 +924,40 @@ void ExchangeBufferRegistry::Allocate() {
 
 	// Assign space to send buffers for each ExchangeBuffer (receive
 	// buffers are attached when the first message arrives)
-	{
-		std::vector<int> vecSendBufferPosition;
-		vecSendBufferPosition.resize(m_vecProcessors.size());
+	for (int p = 0; p < m_vecProcessors.size(); p++) {
+		if (m_vecTransport[p] == Transport_MPI) {
+			AttachSendBuffers(p);
+		}
+	}
 
-		for (int m = 0; m < m_vecRegistry.size(); m++) {
-			int nExchangeBufferByteSize =
-				m_vecRegistry[m].GetMessageSize();
+	// Pair each ExchangeBuffer to a patch on this processor with the
+	// ExchangeBuffer of the target patch, whose halo it fills directly
+	for (int p = 0; p < m_vecProcessors.size(); p++) {
+		if (m_vecTransport[p] != Transport_Local) {
+			continue;
+		}
 
-			if (nExchangeBufferByteSize % sizeof(double) != 0) {
-				_EXCEPTIONT("Message size must be aligned at "
-					"double boundaries");
-			}
+		std::vector<ExchangeBuffer *> & vecExchangeBufs =
+			m_vecRegistryByProcessor[p];
 
-			int p = 0;
-			for (; p < m_vecProcessors.size(); p++) {
-				int ixTargetProc = m_vecRegistry[m].m_ixTargetProcessor;
-				if (m_vecProcessors[p] == ixTargetProc) {
+		for (int b = 0; b < vecExchangeBufs.size(); b++) {
+			ExchangeBuffer::MessageHeader msghead;
+			vecExchangeBufs[b]->GetSendMessageHeader(&msghead);
+
+			int c = 0;
+			for (; c < vecExchangeBufs.size(); c++) {
+				ExchangeBuffer::MessageHeader exbufhead;
+				vecExchangeBufs[c]->GetRecvMessageHeader(&exbufhead);
+
+				if (exbufhead == msghead) {
 					break;
 				}
 			}
-			if (p == m_vecProcessors.size()) {
-				_EXCEPTIONT("Logic error");
+			if (c == vecExchangeBufs.size()) {
+				_EXCEPTIONT("Corresponding ExchangeBuffer not found");
 			}
 
-			m_vecRegistry[m].m_dSendBuffer.SetSize(
-				nExchangeBufferByteSize / sizeof(double));
-			m_vecRegistry[m].m_dSendBuffer.AttachToData(
-				m_vecSendBuffers[p] + vecSendBufferPosition[p]);
-
-			vecSendBufferPosition[p] +=
-				nExchangeBufferByteSize;
+			vecExchangeBufs[b]->m_pLocalTarget = vecExchangeBufs[c];
 		}
 	}
 
@@ -920,13 +966,230 @@ void ExchangeBufferRegistry::Allocate() {
 	m_vecSendRequest.resize(m_vecProcessors.size());
 	m_vecSendStatus.resize(m_vecProcessors.size());
 
+#ifdef TEMPEST_MPIOMP
+	for (int p = 0; p < m_vecProcessors.size(); p++) {
+		m_vecRecvRequest[p] = MPI_REQUEST_NULL;
+		m_vecSendRequest[p] = MPI_REQUEST_NULL;
+	}
+#endif
+
 	m_vecMessageReceived.resize(m_vecProcessors.size());
+
+	m_iExchangeIndex = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBufferRegistry::AllocateSharedMemory() {
+
+#ifdef TEMPEST_MPI_SHARED_MEMORY
+	// Communicator over all processors on this node
+	if (m_commNode == MPI_COMM_NULL) {
+		MPI_Comm_split_type(
+			MPI_COMM_WORLD,
+			MPI_COMM_TYPE_SHARED,
+			0,
+			MPI_INFO_NULL,
+			&m_commNode);
+	}
+
+	// Rank of each processor on this node
+	std::vector<int> vecNodeRank(m_vecProcessors.size());
+	{
+		MPI_Group groupWorld;
+		MPI_Group groupNode;
+		MPI_Comm_group(MPI_COMM_WORLD, &groupWorld);
+		MPI_Comm_group(m_commNode, &groupNode);
+
+		if (m_vecProcessors.size() != 0) {
+			MPI_Group_translate_ranks(
+				groupWorld,
+				m_vecProcessors.size(),
+				&(m_vecProcessors[0]),
+				groupNode,
+				&(vecNodeRank[0]));
+		}
+
+		MPI_Group_free(&groupWorld);
+		MPI_Group_free(&groupNode);
+	}
+
+	// Two message slots per processor on this node, each aligned to
+	// a cache line
+	const long long nAlign = sizeof(SharedSlotHeader);
+
+	m_vecSharedSendSlot.resize(m_vecProcessors.size(), NULL);
+	m_vecSharedRecvSlot.resize(m_vecProcessors.size(), NULL);
+	m_vecSharedSendSlotStride.resize(m_vecProcessors.size(), 0);
+	m_vecSharedRecvSlotStride.resize(m_vecProcessors.size(), 0);
+
+	std::vector<long long> vecSlotOffset(m_vecProcessors.size(), 0);
+
+	long long nWindowSize = 0;
+	for (int p = 0; p < m_vecProcessors.size(); p++) {
+		if (m_vecTransport[p] != Transport_MPI) {
+			continue;
+		}
+		if (vecNodeRank[p] == MPI_UNDEFINED) {
+			continue;
+		}
+
+		m_vecTransport[p] = Transport_SharedMemory;
+
+		m_vecSharedSendSlotStride[p] =
+			sizeof(SharedSlotHeader)
+			+ ((m_vecBufferSize[p] + nAlign - 1) / nAlign) * nAlign;
+
+		vecSlotOffset[p] = nWindowSize;
+
+		nWindowSize += 2 * m_vecSharedSendSlotStride[p];
+	}
+
+	// Allocate the window, placing each processor's part in its own
+	// memory for first-touch locality
+	MPI_Info info;
+	MPI_Info_create(&info);
+	MPI_Info_set(info, const_cast<char *>("alloc_shared_noncontig"),
+		const_cast<char *>("true"));
+
+	char * pWindow = NULL;
+	MPI_Win_allocate_shared(
+		nWindowSize,
+		1,
+		info,
+		m_commNode,
+		&pWindow,
+		&m_winShared);
+
+	MPI_Info_free(&info);
+
+	MPI_Win_lock_all(MPI_MODE_NOCHECK, m_winShared);
+
+	if (nWindowSize != 0) {
+		memset(pWindow, 0, nWindowSize);
+	}
+
+	// Exchange slot offsets and strides with processors on this node
+	std::vector<long long> vecSendSlotInfo(2 * m_vecProcessors.size());
+	std::vector<long long> vecRecvSlotInfo(2 * m_vecProcessors.size());
+	std::vector<MPI_Request> vecRequests;
+
+	for (int p = 0; p < m_vecProcessors.size(); p++) {
+		if (m_vecTransport[p] != Transport_SharedMemory) {
+			continue;
+		}
+
+		m_vecSharedSendSlot[p] = pWindow + vecSlotOffset[p];
+
+		vecSendSlotInfo[2*p  ] = vecSlotOffset[p];
+		vecSendSlotInfo[2*p+1] = m_vecSharedSendSlotStride[p];
+
+		vecRequests.push_back(MPI_REQUEST_NULL);
+		MPI_Irecv(
+			&(vecRecvSlotInfo[2*p]),
+			2,
+			MPI_LONG_LONG,
+			m_vecProcessors[p],
+			1,
+			MPI_COMM_WORLD,
+			&(vecRequests.back()));
+
+		vecRequests.push_back(MPI_REQUEST_NULL);
+		MPI_Isend(
+			&(vecSendSlotInfo[2*p]),
+			2,
+			MPI_LONG_LONG,
+			m_vecProcessors[p],
+			1,
+			MPI_COMM_WORLD,
+			&(vecRequests.back()));
+	}
+
+	if (vecRequests.size() != 0) {
+		MPI_Waitall(
+			vecRequests.size(),
+			&(vecRequests[0]),
+			MPI_STATUSES_IGNORE);
+	}
+
+	for (int p = 0; p < m_vecProcessors.size(); p++) {
+		if (m_vecTransport[p] != Transport_SharedMemory) {
+			continue;
+		}
+
+		MPI_Aint sSize;
+		int nDispUnit;
+		char * pPeerWindow;
+		MPI_Win_shared_query(
+			m_winShared, vecNodeRank[p], &sSize, &nDispUnit, &pPeerWindow);
+
+		m_vecSharedRecvSlot[p] = pPeerWindow + vecRecvSlotInfo[2*p];
+		m_vecSharedRecvSlotStride[p] = vecRecvSlotInfo[2*p+1];
+	}
+
+	// Make the cleared slot headers visible on all processors
+	MPI_Win_sync(m_winShared);
+	MPI_Barrier(m_commNode);
+	MPI_Win_sync(m_winShared);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeBufferRegistry::AttachSendBuffers(
+	int p
+) {
+	std::vector<ExchangeBuffer *> & vecExchangeBufs =
+		m_vecRegistryByProcessor[p];
+
+	int iPosition = 0;
+
+	for (int b = 0; b < vecExchangeBufs.size(); b++) {
+		ExchangeBuffer * pExBuf = vecExchangeBufs[b];
+
+		int nExchangeBufferByteSize = pExBuf->GetMessageSize();
+
+		if (nExchangeBufferByteSize % sizeof(double) != 0) {
+			_EXCEPTIONT("Message size must be aligned at "
+				"double boundaries");
+		}
+
+		if (pExBuf->m_dSendBuffer.IsAttached()) {
+			pExBuf->m_dSendBuffer.Detach();
+		}
+		pExBuf->m_dSendBuffer.SetSize(
+			nExchangeBufferByteSize / sizeof(double));
+		pExBuf->m_dSendBuffer.AttachToData(
+			m_vecSendBuffers[p] + iPosition);
+
+		iPosition += nExchangeBufferByteSize;
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void ExchangeBufferRegistry::PrepareExchange() {
 
+	m_iExchangeIndex++;
+
+#ifdef TEMPEST_MPI_SHARED_MEMORY
+	// Pack messages to processors on this node directly into the
+	// shared memory slot for this exchange
+	for (int p = 0; p < m_vecProcessors.size(); p++) {
+		if (m_vecTransport[p] != Transport_SharedMemory) {
+			continue;
+		}
+
+		char * pSlot =
+			m_vecSharedSendSlot[p]
+			+ (m_iExchangeIndex % 2) * m_vecSharedSendSlotStride[p];
+
+		m_vecSendBuffers[p] = pSlot + sizeof(SharedSlotHeader);
+
+		AttachSendBuffers(p);
+	}
+#endif
+
 	// Reset all ExchangeBuffers
 	for (int r = 0; r < m_vecRegistry.size(); r++) {
 		m_vecRegistry[r].Reset();
@@ -935,9 +1198,14 @@ void ExchangeBufferRegistry::PrepareExchange() {
 #ifdef TEMPEST_MPIOMP
 	// Set up asynchornous receives
 	for (int p = 0; p < m_vecProcessors.size(); p++) {
-		m_vecMessageReceived[p] = false;
 
-#pragma message "Check for Exchange between processors of the same rank"
+		// Data for patches on this processor is copied while packing
+		m_vecMessageReceived[p] = (m_vecTransport[p] == Transport_Local);
+
+		if (m_vecTransport[p] != Transport_MPI) {
+			continue;
+		}
+
 		MPI_Irecv(
 			m_vecRecvBuffers[p],
 			m_vecBufferSize[p],
@@ -968,21 +1236,89 @@ void ExchangeBufferRegistry::Send() {
 	}
 
 	for (int p = 0; p < m_vecProcessors.size(); p++) {
+
+		std::vector<ExchangeBuffer *> & vecExchangeBufs =
+			m_vecRegistryByProcessor[p];
+
+		// Data for patches on this processor has already been copied
+		if (m_vecTransport[p] == Transport_Local) {
+			for (int b = 0; b < vecExchangeBufs.size(); b++) {
+				m_nLocalMessagesSent++;
+				m_sLocalBytesSent +=
+					vecExchangeBufs[b]->GetPackedMessageSize()
+					- sizeof(ExchangeBuffer::MessageHeader);
+			}
+			continue;
+		}
+
+		// Store the size of each packed message in its header and move
+		// messages together so that only packed data is sent
+		int iPosition = 0;
+
+		for (int b = 0; b < vecExchangeBufs.size(); b++) {
+			ExchangeBuffer * pExBuf = vecExchangeBufs[b];
+
+			const size_t sMessageSize = pExBuf->GetPackedMessageSize();
+
+			char * pMessage = (char *)(&(pExBuf->m_dSendBuffer[0]));
+
+			ExchangeBuffer::MessageHeader * msghead =
+				(ExchangeBuffer::MessageHeader *)(pMessage);
+
+			msghead->m_sPayloadSize =
+				sMessageSize - sizeof(ExchangeBuffer::MessageHeader);
+
+			if (pMessage != m_vecSendBuffers[p] + iPosition) {
+				memmove(
+					m_vecSendBuffers[p] + iPosition,
+					pMessage,
+					sMessageSize);
+			}
+
+			iPosition += sMessageSize;
+		}
+
+		if (iPosition > m_vecBufferSize[p]) {
+			_EXCEPTIONT("Packed messages exceed buffer size");
+		}
+
+#ifdef TEMPEST_MPI_SHARED_MEMORY
+		// Publish the message in the shared memory slot
+		if (m_vecTransport[p] == Transport_SharedMemory) {
+			SharedSlotHeader * pSlotHeader =
+				(SharedSlotHeader *)
+					(m_vecSendBuffers[p] - sizeof(SharedSlotHeader));
+
+			pSlotHeader->m_nMessageSize = iPosition;
+			MPI_Win_sync(m_winShared);
+
+			pSlotHeader->m_iExchangeIndex = m_iExchangeIndex;
+			MPI_Win_sync(m_winShared);
+
+			m_nSharedMemoryMessagesSent++;
+			m_sSharedMemoryBytesSent += iPosition;
+			continue;
+		}
+#endif
+
 		MPI_Isend(
 			m_vecSendBuffers[p],
-			m_vecBufferSize[p],
+			iPosition,
 			MPI_BYTE,
 			m_vecProcessors[p],
 			0,
 			MPI_COMM_WORLD,
 			&(m_vecSendRequest[p]));
 
+		m_nMessagesSent++;
+		m_sBytesSent += iPosition;
+
 /*
 		int nRank;
 		MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 		printf("On %i sending %i bytes to %i\n",
 			nRank,
-			m_vecBufferSize[p],
+			iPosition,
 			m_vecProcessors[p]);
 */
 	}
@@ -994,7 +1330,11 @@ void ExchangeBufferRegistry::Send() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void ExchangeBufferRegistry::AttachRecvBuffers(int p) {
+void ExchangeBufferRegistry::AttachRecvBuffers(
+	int p,
+	char * pRecvBuffer,
+	int nRecvBytes
+) {
 
 	// Find the array of ExchangeBuffers relevant to this processor
 	if ((p < 0) || (p >= m_vecRegistryByProcessor.size())) {
@@ -1006,49 +1346,90 @@ void ExchangeBufferRegistry::AttachRecvBuffers(int p) {
 	// Number of ExchangeBuffers needed
 	int nProcExchangeBuffers = vecExchangeBufs.size();
 
+	// On the first message from this processor determine the order of
+	// ExchangeBuffers from the message headers
+	std::vector<ExchangeBuffer *> & vecRecvOrder =
+		m_vecRecvOrderByProcessor[p];
+
+	bool fFindOrder = !m_vecAreRecvBuffersAttached[p];
+	if (fFindOrder) {
+		vecRecvOrder.clear();
+	}
+
 	// Assign buffers in the correct order
 	int iPosition = 0;
 
-	ExchangeBuffer::MessageHeader * msghead =
-		(ExchangeBuffer::MessageHeader *)(m_vecRecvBuffers[p]);
-
 	int nProcExchangeBuffersAssigned = 0;
-	for (;;) {
+	while (iPosition < nRecvBytes) {
+
+		if (iPosition + sizeof(ExchangeBuffer::MessageHeader) > nRecvBytes) {
+			_EXCEPTIONT("Message length does not match buffer size");
+		}
+
+		ExchangeBuffer::MessageHeader * msghead =
+			(ExchangeBuffer::MessageHeader *)
+				(pRecvBuffer + iPosition);
+
 		// Search for ExchangeBuffers with a header that
 		// matches the header in the message
-		int b = 0;
-		for (; b < nProcExchangeBuffers; b++) {
-			ExchangeBuffer * pExBuf = vecExchangeBufs[b];
+		ExchangeBuffer * pExBuf = NULL;
+		if (fFindOrder) {
+			int b = 0;
+			for (; b < nProcExchangeBuffers; b++) {
+				ExchangeBuffer::MessageHeader exbufhead;
+				vecExchangeBufs[b]->GetRecvMessageHeader(&exbufhead);
+
+				if (exbufhead == (*msghead)) {
+					break;
+				}
+			}
+			if (b == nProcExchangeBuffers) {
+				_EXCEPTIONT("Corresponding ExchangeBuffer not found");
+			}
+
+			pExBuf = vecExchangeBufs[b];
+			vecRecvOrder.push_back(pExBuf);
+
+		} else {
+			if (nProcExchangeBuffersAssigned >= vecRecvOrder.size()) {
+				_EXCEPTIONT("Too many ExchangeBuffers in message");
+			}
+
+			pExBuf = vecRecvOrder[nProcExchangeBuffersAssigned];
 
 			ExchangeBuffer::MessageHeader exbufhead;
 			pExBuf->GetRecvMessageHeader(&exbufhead);
 
 			if (exbufhead != (*msghead)) {
-				continue;
+				_EXCEPTIONT("Corresponding ExchangeBuffer not found");
 			}
+		}
 
-			pExBuf->m_dRecvBuffer.SetSize(
-				pExBuf->GetMessageSize());
-			pExBuf->m_dRecvBuffer.AttachToData(
-				m_vecRecvBuffers[p] + iPosition);
+		// Attach the RecvBuffer to the packed data
+		size_t sMessageSize =
+			sizeof(ExchangeBuffer::MessageHeader) + msghead->m_sPayloadSize;
 
-			iPosition += pExBuf->GetMessageSize();
-			msghead = (ExchangeBuffer::MessageHeader *)
-				(m_vecRecvBuffers[p] + iPosition);
-			break;
+		if ((msghead->m_sPayloadSize > pExBuf->m_sByteSize) ||
+		    (sMessageSize % sizeof(double) != 0)
+		) {
+			_EXCEPTIONT("Invalid message payload size");
 		}
-		if (b == nProcExchangeBuffers) {
-			_EXCEPTIONT("Corresponding ExchangeBuffer not found");
+
+		if (pExBuf->m_dRecvBuffer.IsAttached()) {
+			pExBuf->m_dRecvBuffer.Detach();
 		}
+		pExBuf->m_dRecvBuffer.SetSize(
+			sMessageSize / sizeof(double));
+		pExBuf->m_dRecvBuffer.AttachToData(
+			pRecvBuffer + iPosition);
+
+		iPosition += sMessageSize;
 
 		nProcExchangeBuffersAssigned++;
+	}
 
-		if (iPosition > m_vecBufferSize[p]) {
-			_EXCEPTIONT("Message length does not match buffer size");
-		}
-		if (iPosition == m_vecBufferSize[p]) {
-			break;
-		}
+	if (iPosition != nRecvBytes) {
+		_EXCEPTIONT("Message length does not match buffer size");
 	}
 
 	if (nProcExchangeBuffersAssigned != nProcExchangeBuffers) {
@@ -1075,12 +1456,45 @@ const std::vector<ExchangeBuffer *> * ExchangeBufferRegistry::WaitReceive() {
 				continue;
 			}
 
-			// Check if a message is waiting
-			int fRecvWaiting;
-			MPI_Status status;
-			MPI_Test(&(m_vecRecvRequest[p]), &fRecvWaiting, &status);
-			if (!fRecvWaiting) {
-				continue;
+			char * pRecvBuffer = m_vecRecvBuffers[p];
+			int nRecvBytes;
+
+			// Check if an MPI message is waiting
+			if (m_vecTransport[p] == Transport_MPI) {
+				int fRecvWaiting;
+				MPI_Status status;
+				MPI_Test(&(m_vecRecvRequest[p]), &fRecvWaiting, &status);
+				if (!fRecvWaiting) {
+					continue;
+				}
+
+				MPI_Get_count(&status, MPI_BYTE, &nRecvBytes);
+
+				m_nMessagesReceived++;
+				m_sBytesReceived += nRecvBytes;
+
+#ifdef TEMPEST_MPI_SHARED_MEMORY
+			// Check if the message has been published in shared memory
+			} else if (m_vecTransport[p] == Transport_SharedMemory) {
+				char * pSlot =
+					m_vecSharedRecvSlot[p]
+					+ (m_iExchangeIndex % 2) * m_vecSharedRecvSlotStride[p];
+
+				SharedSlotHeader * pSlotHeader =
+					(SharedSlotHeader *)(pSlot);
+
+				MPI_Win_sync(m_winShared);
+				if (pSlotHeader->m_iExchangeIndex != m_iExchangeIndex) {
+					continue;
+				}
+				MPI_Win_sync(m_winShared);
+
+				pRecvBuffer = pSlot + sizeof(SharedSlotHeader);
+				nRecvBytes = pSlotHeader->m_nMessageSize;
+#endif
+
+			} else {
+				_EXCEPTIONT("Invalid transport");
 			}
 
 			// Message received
@@ -1090,15 +1504,18 @@ const std::vector<ExchangeBuffer *> * ExchangeBufferRegistry::WaitReceive() {
 			MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 			printf("Message received on proc %i from proc %i\n", nRank, m_vecProcessors[p]);
 */
-			// Attach Recv buffers
-			if (!m_vecAreRecvBuffersAttached[p]) {
-				AttachRecvBuffers(p);
-				m_vecAreRecvBuffersAttached[p] = true;
-			}
+			// Attach Recv buffers to the packed data in this message
+			AttachRecvBuffers(p, pRecvBuffer, nRecvBytes);
+			m_vecAreRecvBuffersAttached[p] = true;
 
 			// Return the array of ExchangeBuffers that have been filled
 			return &(m_vecRegistryByProcessor[p]);
 		}
+
+		// Let processors sharing this core publish their messages
+		if (nRecvMessageCount != m_vecProcessors.size()) {
+			std::this_thread::yield();
+		}
 	}
 #endif
 
@@ -33,6 +33,10 @@ typedef int MPI_Status;
 typedef int MPI_Request;
 #endif
 
+#if defined(TEMPEST_MPI_SHARED_MEMORY) && !(MPI_VERSION >= 3)
+#error "TEMPEST_MPI_SHARED_MEMORY requires PARALLEL=MPIOMP and MPI-3"
+#endif
+
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -68,6 +72,21 @@ class ExchangeBuffer {
 
 	friend class ExchangeBufferRegistry;
 
+public:
+	///	<summary>
+	///		Type of a diagonal ExchangeBuffer.  Where a neighboring patch
+	///		both contains the diagonal node at a patch corner and borders
+	///		the patch edge (as with non-conforming patch edges), two
+	///		diagonal ExchangeBuffers connect the same patches in the same
+	///		direction: one at the patch corner and one at the edge junction.
+	///		The type distinguishes the two.
+	///	</summary>
+	enum DiagonalType {
+		DiagonalType_Unique = 0,
+		DiagonalType_PatchCorner = 1,
+		DiagonalType_EdgeJunction = 2
+	};
+
 public:
 	///	<summary>
 	///		Message header for MPI message exchange.
@@ -81,7 +100,9 @@ public:
 				m_ixReserved(0x01010101),
 				m_ixFirstPatch(-1),
 				m_ixSecondPatch(-1),
-				m_ixDirection(Direction_Middle)
+				m_ixDirection(Direction_Middle),
+				m_ixDiagonalType(DiagonalType_Unique),
+				m_sPayloadSize(0)
 			{ }
 
 			///	<summary>
@@ -90,12 +111,15 @@ public:
 			MessageHeader(
 				int ixFirstPatch,
 				int ixSecondPatch,
-				int ixDirection
+				int ixDirection,
+				int ixDiagonalType
 			) :
 				m_ixReserved(0x01010101),
 				m_ixFirstPatch(ixFirstPatch),
 				m_ixSecondPatch(ixSecondPatch),
-				m_ixDirection(ixDirection)
+				m_ixDirection(ixDirection),
+				m_ixDiagonalType(ixDiagonalType),
+				m_sPayloadSize(0)
 			{ }
 
 			///	<summary>
@@ -105,7 +129,8 @@ public:
 				if ((m_ixReserved == msghead.m_ixReserved) &&
 				    (m_ixFirstPatch == msghead.m_ixFirstPatch) &&
 				    (m_ixSecondPatch == msghead.m_ixSecondPatch) &&
-				    (m_ixDirection == msghead.m_ixDirection)
+				    (m_ixDirection == msghead.m_ixDirection) &&
+				    (m_ixDiagonalType == msghead.m_ixDiagonalType)
 				) {
 					return true;
 				}
@@ -124,6 +149,13 @@ public:
 			int m_ixFirstPatch;
 			int m_ixSecondPatch;
 			int m_ixDirection;
+			int m_ixDiagonalType;
+
+			///	<summary>
+			///		Size of the packed data following the header (in bytes),
+			///		set when the message is sent.
+			///	</summary>
+			size_t m_sPayloadSize;
 	};
 
 public:
@@ -146,7 +178,9 @@ public:
 		m_ixFirst(0),
 		m_ixSecond(0),
 		m_fReverseDirection(false),
-		m_fFlippedCoordinate(false)
+		m_fFlippedCoordinate(false),
+		m_eDiagonalType(DiagonalType_Unique),
+		m_pLocalTarget(NULL)
 	{ }
 
 public:
@@ -163,12 +197,20 @@ public:
 	}
 
 	///	<summary>
-	///		Get the message size (in bytes).
+	///		Get the maximum message size (in bytes).
 	///	</summary>
 	size_t GetMessageSize() {
 		return (m_sByteSize + sizeof(MessageHeader));
 	}
 
+	///	<summary>
+	///		Get the size of the message packed or copied since the last
+	///		call to Reset(), including the MessageHeader (in bytes).
+	///	</summary>
+	size_t GetPackedMessageSize() const {
+		return (m_ixSendBuffer * sizeof(double));
+	}
+
 	///	<summary>
 	///		Get the outgoing message header for this ExchangeBuffer.
 	///	</summary>
@@ -179,7 +221,8 @@ public:
 			MessageHeader(
 				m_ixSourcePatch,
 				m_ixTargetPatch,
-				m_dirOpposing);
+				m_dirOpposing,
+				m_eDiagonalType);
 	}
 
 	///	<summary>
@@ -192,7 +235,32 @@ public:
 			MessageHeader(
 				m_ixTargetPatch,
 				m_ixSourcePatch,
-				m_dir);
+				m_dir,
+				GetOpposingDiagonalType());
+	}
+
+	///	<summary>
+	///		Get the type of the matching ExchangeBuffer on the target
+	///		patch.  A corner buffer pairs with a junction buffer on the
+	///		target patch and vice versa.
+	///	</summary>
+	DiagonalType GetOpposingDiagonalType() const {
+		if (m_eDiagonalType == DiagonalType_PatchCorner) {
+			return DiagonalType_EdgeJunction;
+		}
+		if (m_eDiagonalType == DiagonalType_EdgeJunction) {
+			return DiagonalType_PatchCorner;
+		}
+		return DiagonalType_Unique;
+	}
+
+	///	<summary>
+	///		Get the ExchangeBuffer on a patch of this processor whose halo
+	///		is filled directly from this ExchangeBuffer, or NULL if data
+	///		is sent in a message.
+	///	</summary>
+	ExchangeBuffer * GetLocalTarget() const {
+		return m_pLocalTarget;
 	}
 
 public:
@@ -201,6 +269,28 @@ public:
 	///	</summary>
 	void Reset();
 
+	///	<summary>
+	///		Get the nodes of a patch with the given number of alpha and
+	///		beta nodes that are sent through this ExchangeBuffer, as pairs
+	///		of indices in the order they are packed.
+	///	</summary>
+	void GetSendNodes(
+		size_t sAElements,
+		size_t sBElements,
+		std::vector<int> & vecNodes
+	) const;
+
+	///	<summary>
+	///		Get the halo nodes of a patch with the given number of alpha
+	///		and beta nodes that are received through this ExchangeBuffer,
+	///		as pairs of indices in the order they are unpacked.
+	///	</summary>
+	void GetRecvNodes(
+		size_t sAElements,
+		size_t sBElements,
+		std::vector<int> & vecNodes
+	) const;
+
 	///	<summary>
 	///		Pack DataArray3D into the send buffer.
 	///	</summary>
@@ -231,6 +321,53 @@ public:
 		DataArray4D<double> & data
 	);
 
+	///	<summary>
+	///		Copy DataArray3D directly into the halo of the given DataArray3D
+	///		on the patch of the local target ExchangeBuffer.
+	///	</summary>
+	void Copy(
+		const DataArray3D<double> & dataSource,
+		DataArray3D<double> & dataTarget
+	);
+
+	///	<summary>
+	///		Copy DataArray4D directly into the halo of the given DataArray4D
+	///		on the patch of the local target ExchangeBuffer.
+	///	</summary>
+	void Copy(
+		const Grid & grid,
+		const DataArray4D<double> & dataSource,
+		DataArray4D<double> & dataTarget
+	);
+
+protected:
+	///	<summary>
+	///		Pack the given nodes of DataArray3D into the send buffer.
+	///	</summary>
+	void Pack(
+		const DataArray3D<double> & data,
+		const std::vector<int> & vecNodes
+	);
+
+	///	<summary>
+	///		Unpack receive buffer into the given nodes of DataArray3D.
+	///	</summary>
+	void Unpack(
+		DataArray3D<double> & data,
+		const std::vector<int> & vecNodes
+	);
+
+	///	<summary>
+	///		Copy the given nodes of DataArray3D into the given halo nodes
+	///		of the target DataArray3D.
+	///	</summary>
+	void Copy(
+		const DataArray3D<double> & dataSource,
+		const std::vector<int> & vecSendNodes,
+		DataArray3D<double> & dataTarget,
+		const std::vector<int> & vecRecvNodes
+	);
+
 public:
 	///	<summary>
 	///		Unique global id of this exchange buffer.
@@ -320,7 +457,19 @@ public:
 	///	</summary>
 	bool m_fFlippedCoordinate;
 
+	///	<summary>
+	///		Type of this diagonal ExchangeBuffer, if it shares its source
+	///		patch, target patch and direction with another ExchangeBuffer.
+	///	</summary>
+	DiagonalType m_eDiagonalType;
+
 protected:
+	///	<summary>
+	///		Matching ExchangeBuffer on a patch of this processor, whose halo
+	///		is filled directly without packing a message.
+	///	</summary>
+	ExchangeBuffer * m_pLocalTarget;
+
 	///	<summary>
 	///		Current RecvBuffer.
 	///	</summary>
@@ -349,6 +498,20 @@ protected:
 ///	</summary>
 class ExchangeBufferRegistry {
 
+public:
+	///	<summary>
+	///		Path taken by messages to a processor.  Data for patches on
+	///		this processor is copied directly into their halo, messages to
+	///		processors on the same node pass through an MPI-3 shared memory
+	///		window (if built with TEMPEST_MPI_SHARED_MEMORY) and all other
+	///		messages are sent with MPI.
+	///	</summary>
+	enum Transport {
+		Transport_MPI = 0,
+		Transport_Local = 1,
+		Transport_SharedMemory = 2
+	};
+
 public:
 	///	<summary>
 	///		Constructor.
@@ -380,6 +543,12 @@ public:
 	///	</summary>
 	void Allocate();
 
+	///	<summary>
+	///		Remove all ExchangeBuffers and release all send and receive
+	///		buffers, so that the registry can be rebuilt.
+	///	</summary>
+	void Clear();
+
 	///	<summary>
 	///		Set up asynchronous receives.
 	///	</summary>
@@ -392,9 +561,27 @@ public:
 
 protected:
 	///	<summary>
-	///		Attach RecvBuffers based on a received message.
+	///		Release all send and receive buffers.
+	///	</summary>
+	void DeallocateBuffers();
+
+	///	<summary>
+	///		Allocate the shared memory window used for messages to
+	///		processors on the same node.
+	///	</summary>
+	void AllocateSharedMemory();
+
+	///	<summary>
+	///		Attach the SendBuffers of all ExchangeBuffers to the given
+	///		processor to the current send buffer for that processor.
+	///	</summary>
+	void AttachSendBuffers(int ixProc);
+
+	///	<summary>
+	///		Attach RecvBuffers based on a received message of the given
+	///		size (in bytes).
 	///	</summary>
-	void AttachRecvBuffers(int ixProc);
+	void AttachRecvBuffers(int ixProc, char * pRecvBuffer, int nRecvBytes);
 
 public:
 	///	<summary>
@@ -411,10 +598,71 @@ public:
 	///	</summary>
 	void WaitSend();
 
+public:
+	///	<summary>
+	///		Get the number of MPI messages sent since construction.
+	///	</summary>
+	unsigned long GetMessagesSent() const {
+		return m_nMessagesSent;
+	}
+
+	///	<summary>
+	///		Get the number of bytes sent over MPI since construction.
+	///	</summary>
+	unsigned long long GetBytesSent() const {
+		return m_sBytesSent;
+	}
+
+	///	<summary>
+	///		Get the number of MPI messages received since construction.
+	///	</summary>
+	unsigned long GetMessagesReceived() const {
+		return m_nMessagesReceived;
+	}
+
+	///	<summary>
+	///		Get the number of bytes received over MPI since construction.
+	///	</summary>
+	unsigned long long GetBytesReceived() const {
+		return m_sBytesReceived;
+	}
+
+	///	<summary>
+	///		Get the number of ExchangeBuffers copied directly to patches on
+	///		this processor since construction.
+	///	</summary>
+	unsigned long GetLocalMessagesSent() const {
+		return m_nLocalMessagesSent;
+	}
+
+	///	<summary>
+	///		Get the number of bytes copied directly to patches on this
+	///		processor since construction.
+	///	</summary>
+	unsigned long long GetLocalBytesSent() const {
+		return m_sLocalBytesSent;
+	}
+
+	///	<summary>
+	///		Get the number of messages sent through shared memory since
+	///		construction.
+	///	</summary>
+	unsigned long GetSharedMemoryMessagesSent() const {
+		return m_nSharedMemoryMessagesSent;
+	}
+
+	///	<summary>
+	///		Get the number of bytes sent through shared memory since
+	///		construction.
+	///	</summary>
+	unsigned long long GetSharedMemoryBytesSent() const {
+		return m_sSharedMemoryBytesSent;
+	}
+
 protected:
 	///	<summary>
-	///		Flag indicating that ExchangeBuffer RecvBuffers have not yet been
-	///		attached to data.
+	///		Flag indicating that the order of ExchangeBuffers in messages
+	///		from each processor has been determined.
 	///	</summary>
 	std::vector<bool> m_vecAreRecvBuffersAttached;
 
@@ -424,7 +672,7 @@ protected:
 	std::vector<ExchangeBuffer> m_vecRegistry;
 
 	///	<summary>
-	///		Buffer size for each processor.
+	///		Maximum buffer size for each processor.
 	///	</summary>
 	std::vector<int> m_vecBufferSize;
 
@@ -463,12 +711,108 @@ protected:
 	///	</summary>
 	std::vector<bool> m_vecMessageReceived;
 
+	///	<summary>
+	///		Transport used for messages to each processor.
+	///	</summary>
+	std::vector<Transport> m_vecTransport;
+
+	///	<summary>
+	///		Number of exchanges since Allocate().
+	///	</summary>
+	long long m_iExchangeIndex;
+
+#ifdef TEMPEST_MPI_SHARED_MEMORY
+protected:
+	///	<summary>
+	///		Header of a message slot in the shared memory window.  Each
+	///		processor on the same node has two slots, used on alternating
+	///		exchanges.  The sender writes the message, then the exchange
+	///		index, which the receiver polls.
+	///	</summary>
+	struct SharedSlotHeader {
+		volatile long long m_iExchangeIndex;
+		long long m_nMessageSize;
+		char m_cPadding[48];
+	};
+
+	///	<summary>
+	///		Communicator over all processors on this node.
+	///	</summary>
+	MPI_Comm m_commNode;
+
+	///	<summary>
+	///		Shared memory window holding the send slots of this processor.
+	///	</summary>
+	MPI_Win m_winShared;
+
+	///	<summary>
+	///		First send slot in this processor's window for each processor.
+	///	</summary>
+	std::vector<char *> m_vecSharedSendSlot;
+
+	///	<summary>
+	///		First send slot for this processor in the window of each
+	///		processor.
+	///	</summary>
+	std::vector<char *> m_vecSharedRecvSlot;
+
+	///	<summary>
+	///		Distance between the two send slots for each processor.
+	///	</summary>
+	std::vector<long long> m_vecSharedSendSlotStride;
+
+	///	<summary>
+	///		Distance between the two receive slots for each processor.
+	///	</summary>
+	std::vector<long long> m_vecSharedRecvSlotStride;
+#endif
+
 protected:
 	///	<summary>
 	///		Flag indicating active Isend requests.
 	///	</summary>
 	bool m_fActiveAsyncSend;
 
+	///	<summary>
+	///		Number of MPI messages sent.
+	///	</summary>
+	unsigned long m_nMessagesSent;
+
+	///	<summary>
+	///		Number of bytes sent over MPI.
+	///	</summary>
+	unsigned long long m_sBytesSent;
+
+	///	<summary>
+	///		Number of MPI messages received.
+	///	</summary>
+	unsigned long m_nMessagesReceived;
+
+	///	<summary>
+	///		Number of bytes received over MPI.
+	///	</summary>
+	unsigned long long m_sBytesReceived;
+
+	///	<summary>
+	///		Number of ExchangeBuffers copied to patches on this processor.
+	///	</summary>
+	unsigned long m_nLocalMessagesSent;
+
+	///	<summary>
+	///		Number of bytes copied to patches on this processor.
+	///	</summary>
+	unsigned long long m_sLocalBytesSent;
+
+	///	<summary>
+	///		Number of messages sent through shared memory.
+	///	</summary>
+	unsigned long m_nSharedMemoryMessagesSent;
+
+	///	<summary>
+	///		Number of bytes sent through shared memory.
+	///	</summary>
+	unsigned long long m_sSharedMemoryBytesSent;
+
 protected:
 	///	<summary>
 	///		A lookup table mapping processor to ExchangeBuffer pointers.
@@ -480,6 +824,12 @@ protected:
 	///	</summary>
 	ProcessorExBufferVector m_vecRegistryByProcessor;
 
+	///	<summary>
+	///		Vector of ExchangeBuffers organized by processor, in the order
+	///		they appear in messages received from that processor.
+	///	</summary>
+	ProcessorExBufferVector m_vecRecvOrderByProcessor;
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////
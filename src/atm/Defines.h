@@ -33,6 +33,17 @@
 //#define USE_JACOBIAN_DEBUG
 //#define USE_JACOBIAN_GENERAL
 #define USE_JACOBIAN_DIAGONAL
+//#define USE_JACOBIAN_DIAGONAL_BATCHED
+
+///	<summary>
+///		Batched banded Jacobian storage uses the same banded form as
+///		USE_JACOBIAN_DIAGONAL, but solves groups of columns in lockstep
+///		with BandedSolverBatch instead of calling DGBSV for each column
+///		(VerticalDynamicsFEM only).
+///	</summary>
+#if defined(USE_JACOBIAN_DIAGONAL_BATCHED) && !defined(USE_JACOBIAN_DIAGONAL)
+#define USE_JACOBIAN_DIAGONAL
+#endif
 
 ///	<summary>
 ///		Thermodynamic closure to use.
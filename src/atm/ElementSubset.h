@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ElementSubset.h
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _ELEMENTSUBSET_H_
+#define _ELEMENTSUBSET_H_
+
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Subset of the elements on a patch to update.  Elements on the
+///		patch edge hold all data that is sent to neighboring patches
+///		during an exchange, so they can be updated first and the update
+///		of the patch interior overlapped with communication.
+///	</summary>
+enum ElementSubset {
+	ElementSubset_All,
+	ElementSubset_PatchEdge,
+	ElementSubset_PatchInterior
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Determine if element (a,b) of a patch with the given number of
+///		elements in each coordinate direction is in the given subset.
+///	</summary>
+inline bool IsElementInSubset(
+	ElementSubset eSubset,
+	int a,
+	int b,
+	int nElementCountA,
+	int nElementCountB
+) {
+	if (eSubset == ElementSubset_All) {
+		return true;
+	}
+
+	bool fPatchEdge =
+		(a == 0) || (a == nElementCountA - 1) ||
+		(b == 0) || (b == nElementCountB - 1);
+
+	if (eSubset == ElementSubset_PatchEdge) {
+		return fPatchEdge;
+	}
+	return (!fPatchEdge);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get the indices (a * nElementCountB + b) of all elements (a,b) of
+///		a patch that are in the given subset.
+///	</summary>
+inline void GetElementsInSubset(
+	ElementSubset eSubset,
+	int nElementCountA,
+	int nElementCountB,
+	std::vector<int> & vecElements
+) {
+	vecElements.clear();
+	vecElements.reserve(nElementCountA * nElementCountB);
+
+	for (int a = 0; a < nElementCountA; a++) {
+	for (int b = 0; b < nElementCountB; b++) {
+		if (IsElementInSubset(
+			eSubset, a, b, nElementCountA, nElementCountB)
+		) {
+			vecElements.push_back(a * nElementCountB + b);
+		}
+	}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
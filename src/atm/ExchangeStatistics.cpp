@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ExchangeStatistics.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "ExchangeStatistics.h"
+#include "Exception.h"
+#include "Announce.h"
+
+#ifdef TEMPEST_MPIOMP
+#include <mpi.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Counters of one call site and DataType aggregated over ranks.
+///	</summary>
+struct ExchangeCountersAggregate {
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	ExchangeCountersAggregate() :
+		nRanks(0),
+		nMaxExchanges(0),
+		dMinWaitTime(0.0),
+		dMaxWaitTime(0.0)
+	{ }
+
+	///	<summary>
+	///		Counters summed over ranks.
+	///	</summary>
+	ExchangeCounters sum;
+
+	///	<summary>
+	///		Number of ranks with counters.
+	///	</summary>
+	int nRanks;
+
+	///	<summary>
+	///		Maximum number of exchanges over ranks.
+	///	</summary>
+	unsigned long nMaxExchanges;
+
+	///	<summary>
+	///		Minimum wait time over ranks with counters.
+	///	</summary>
+	double dMinWaitTime;
+
+	///	<summary>
+	///		Maximum wait time over ranks.
+	///	</summary>
+	double dMaxWaitTime;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ExchangeStatistics::Report(
+	const std::string & strFilename
+) const {
+
+	// Serialize the counters on this rank as CSV rows
+	std::string strLocal;
+
+	CounterMap::const_iterator iter = m_mapCounters.begin();
+	for (; iter != m_mapCounters.end(); iter++) {
+		std::string strSite = "(none)";
+		if (iter->first.first != FunctionTimer::InvalidGroupId) {
+			strSite = FunctionTimer::GetGroupName(iter->first.first);
+		}
+
+		const ExchangeCounters & counters = iter->second;
+
+		char szRow[512];
+		snprintf(szRow, 512,
+			"%s,%s,%lu,%lu,%llu,%lu,%llu,%lu,%llu,%lu,%llu,"
+			"%1.9e,%1.9e,%1.9e,%1.9e\n",
+			strSite.c_str(),
+			DataTypeToString(static_cast<DataType>(iter->first.second)),
+			counters.nExchanges,
+			counters.nMessagesSent,
+			counters.sBytesSent,
+			counters.nMessagesReceived,
+			counters.sBytesReceived,
+			counters.nLocalMessagesSent,
+			counters.sLocalBytesSent,
+			counters.nSharedMemoryMessagesSent,
+			counters.sSharedMemoryBytesSent,
+			counters.dPackTime,
+			counters.dUnpackTime,
+			counters.dWaitRecvTime,
+			counters.dWaitSendTime);
+
+		strLocal += szRow;
+	}
+
+	// Gather rows on the root rank
+	int nRank = 0;
+	int nCommSize = 1;
+
+	std::vector<int> vecLengths(1, static_cast<int>(strLocal.length()));
+	std::vector<int> vecDisplacements(1, 0);
+	std::vector<char> vecGathered(strLocal.begin(), strLocal.end());
+
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
+
+	int nLocalLength = static_cast<int>(strLocal.length());
+
+	vecLengths.resize(nCommSize);
+	MPI_Gather(
+		&nLocalLength, 1, MPI_INT,
+		&(vecLengths[0]), 1, MPI_INT,
+		0, MPI_COMM_WORLD);
+
+	int nTotalLength = 0;
+	vecDisplacements.resize(nCommSize);
+	if (nRank == 0) {
+		for (int p = 0; p < nCommSize; p++) {
+			vecDisplacements[p] = nTotalLength;
+			nTotalLength += vecLengths[p];
+		}
+	}
+
+	vecGathered.resize(nTotalLength + 1);
+	MPI_Gatherv(
+		const_cast<char *>(strLocal.c_str()), nLocalLength, MPI_CHAR,
+		&(vecGathered[0]), &(vecLengths[0]), &(vecDisplacements[0]),
+		MPI_CHAR, 0, MPI_COMM_WORLD);
+#endif
+
+	if (nRank != 0) {
+		return;
+	}
+
+	// Open the output file
+	FILE * fp = NULL;
+	if (strFilename != "") {
+		fp = fopen(strFilename.c_str(), "w");
+		if (fp == NULL) {
+			_EXCEPTION1("Unable to open exchange statistics file \"%s\"",
+				strFilename.c_str());
+		}
+		fprintf(fp, "rank,site,datatype,exchanges,"
+			"messages_sent,bytes_sent,messages_received,bytes_received,"
+			"local_messages_sent,local_bytes_sent,"
+			"shm_messages_sent,shm_bytes_sent,"
+			"pack,unpack,wait_recv,wait_send\n");
+	}
+
+	// Aggregate counters over ranks
+	typedef std::map<std::pair<std::string, std::string>,
+		ExchangeCountersAggregate> AggregateMap;
+
+	AggregateMap mapAggregate;
+
+	std::vector<double> vecRankWaitTime(nCommSize, 0.0);
+
+	for (int p = 0; p < nCommSize; p++) {
+		std::string strRows(
+			vecGathered.begin() + vecDisplacements[p],
+			vecGathered.begin() + vecDisplacements[p] + vecLengths[p]);
+
+		size_t sBegin = 0;
+		while (sBegin < strRows.length()) {
+			size_t sEnd = strRows.find('\n', sBegin);
+			if (sEnd == std::string::npos) {
+				_EXCEPTIONT("Malformed exchange statistics");
+			}
+
+			std::string strRow = strRows.substr(sBegin, sEnd - sBegin);
+			sBegin = sEnd + 1;
+
+			if (fp != NULL) {
+				fprintf(fp, "%i,%s\n", p, strRow.c_str());
+			}
+
+			size_t sComma0 = strRow.find(',');
+			size_t sComma1 = strRow.find(',', sComma0 + 1);
+			if ((sComma0 == std::string::npos) ||
+			    (sComma1 == std::string::npos)
+			) {
+				_EXCEPTIONT("Malformed exchange statistics");
+			}
+
+			ExchangeCounters counters;
+			int nFields = sscanf(strRow.c_str() + sComma1 + 1,
+				"%lu,%lu,%llu,%lu,%llu,%lu,%llu,%lu,%llu,%lf,%lf,%lf,%lf",
+				&(counters.nExchanges),
+				&(counters.nMessagesSent),
+				&(counters.sBytesSent),
+				&(counters.nMessagesReceived),
+				&(counters.sBytesReceived),
+				&(counters.nLocalMessagesSent),
+				&(counters.sLocalBytesSent),
+				&(counters.nSharedMemoryMessagesSent),
+				&(counters.sSharedMemoryBytesSent),
+				&(counters.dPackTime),
+				&(counters.dUnpackTime),
+				&(counters.dWaitRecvTime),
+				&(counters.dWaitSendTime));
+
+			if (nFields != 13) {
+				_EXCEPTIONT("Malformed exchange statistics");
+			}
+
+			ExchangeCountersAggregate & agg =
+				mapAggregate[std::pair<std::string, std::string>(
+					strRow.substr(0, sComma0),
+					strRow.substr(sComma0 + 1, sComma1 - sComma0 - 1))];
+
+			const double dWaitTime =
+				counters.dWaitRecvTime + counters.dWaitSendTime;
+
+			if ((agg.nRanks == 0) || (dWaitTime < agg.dMinWaitTime)) {
+				agg.dMinWaitTime = dWaitTime;
+			}
+			if ((agg.nRanks == 0) || (dWaitTime > agg.dMaxWaitTime)) {
+				agg.dMaxWaitTime = dWaitTime;
+			}
+			if (counters.nExchanges > agg.nMaxExchanges) {
+				agg.nMaxExchanges = counters.nExchanges;
+			}
+			agg.nRanks++;
+
+			agg.sum.nExchanges += counters.nExchanges;
+			agg.sum.nMessagesSent += counters.nMessagesSent;
+			agg.sum.sBytesSent += counters.sBytesSent;
+			agg.sum.nMessagesReceived += counters.nMessagesReceived;
+			agg.sum.sBytesReceived += counters.sBytesReceived;
+			agg.sum.nLocalMessagesSent += counters.nLocalMessagesSent;
+			agg.sum.sLocalBytesSent += counters.sLocalBytesSent;
+			agg.sum.nSharedMemoryMessagesSent +=
+				counters.nSharedMemoryMessagesSent;
+			agg.sum.sSharedMemoryBytesSent += counters.sSharedMemoryBytesSent;
+			agg.sum.dPackTime += counters.dPackTime;
+			agg.sum.dUnpackTime += counters.dUnpackTime;
+			agg.sum.dWaitRecvTime += counters.dWaitRecvTime;
+			agg.sum.dWaitSendTime += counters.dWaitSendTime;
+
+			vecRankWaitTime[p] += dWaitTime;
+		}
+	}
+
+	if (fp != NULL) {
+		fclose(fp);
+	}
+
+	// Announce the aggregated counters
+	char szTitle[64];
+	snprintf(szTitle, 64, "Exchange statistics over %i ranks", nCommSize);
+
+	AnnounceStartBlock(szTitle);
+	Announce("%-24s %-16s %8s %10s %10s %8s %10s %10s %10s %10s "
+		"%9s %9s %9s %9s %9s",
+		"Site", "DataType", "Exch", "MPIMsgs", "MPIMBytes", "KB/Msg",
+		"LocalMsgs", "LocalMB", "ShmMsgs", "ShmMB",
+		"Pack(s)", "Unpack(s)", "WaitMin", "WaitMean", "WaitMax");
+
+	const double dCommSize = static_cast<double>(nCommSize);
+
+	AggregateMap::const_iterator iterAgg = mapAggregate.begin();
+	for (; iterAgg != mapAggregate.end(); iterAgg++) {
+		const ExchangeCountersAggregate & agg = iterAgg->second;
+
+		double dMinWaitTime = agg.dMinWaitTime;
+		if (agg.nRanks < nCommSize) {
+			dMinWaitTime = 0.0;
+		}
+
+		double dKBPerMessage = 0.0;
+		if (agg.sum.nMessagesSent != 0) {
+			dKBPerMessage =
+				static_cast<double>(agg.sum.sBytesSent)
+				/ (1024.0 * static_cast<double>(agg.sum.nMessagesSent));
+		}
+
+		Announce("%-24s %-16s %8lu %10lu %10.3f %8.2f %10lu %10.3f "
+			"%10lu %10.3f %9.4f %9.4f %9.4f %9.4f %9.4f",
+			iterAgg->first.first.c_str(),
+			iterAgg->first.second.c_str(),
+			agg.nMaxExchanges,
+			agg.sum.nMessagesSent,
+			static_cast<double>(agg.sum.sBytesSent) / (1024.0 * 1024.0),
+			dKBPerMessage,
+			agg.sum.nLocalMessagesSent,
+			static_cast<double>(agg.sum.sLocalBytesSent)
+				/ (1024.0 * 1024.0),
+			agg.sum.nSharedMemoryMessagesSent,
+			static_cast<double>(agg.sum.sSharedMemoryBytesSent)
+				/ (1024.0 * 1024.0),
+			agg.sum.dPackTime / dCommSize,
+			agg.sum.dUnpackTime / dCommSize,
+			dMinWaitTime,
+			(agg.sum.dWaitRecvTime + agg.sum.dWaitSendTime) / dCommSize,
+			agg.dMaxWaitTime);
+	}
+
+	// Announce the spread of the total wait time over ranks
+	int iMinRank = 0;
+	int iMaxRank = 0;
+	double dSumWaitTime = 0.0;
+	for (int p = 0; p < nCommSize; p++) {
+		if (vecRankWaitTime[p] < vecRankWaitTime[iMinRank]) {
+			iMinRank = p;
+		}
+		if (vecRankWaitTime[p] > vecRankWaitTime[iMaxRank]) {
+			iMaxRank = p;
+		}
+		dSumWaitTime += vecRankWaitTime[p];
+	}
+
+	Announce("Total wait time: %1.4fs [rank %i] / %1.4fs / %1.4fs [rank %i] "
+		"(min / mean / max)",
+		vecRankWaitTime[iMinRank], iMinRank,
+		dSumWaitTime / dCommSize,
+		vecRankWaitTime[iMaxRank], iMaxRank);
+
+	AnnounceEndBlock(NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,191 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ExchangeStatistics.h
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _EXCHANGESTATISTICS_H_
+#define _EXCHANGESTATISTICS_H_
+
+#include "DataType.h"
+#include "FunctionTimer.h"
+
+#include <string>
+#include <map>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Counters accumulated over the exchanges of one DataType from one
+///		call site.  Times are in seconds.
+///	</summary>
+struct ExchangeCounters {
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	ExchangeCounters() :
+		nExchanges(0),
+		nMessagesSent(0),
+		nMessagesReceived(0),
+		sBytesSent(0),
+		sBytesReceived(0),
+		nLocalMessagesSent(0),
+		sLocalBytesSent(0),
+		nSharedMemoryMessagesSent(0),
+		sSharedMemoryBytesSent(0),
+		dPackTime(0.0),
+		dUnpackTime(0.0),
+		dWaitRecvTime(0.0),
+		dWaitSendTime(0.0)
+	{ }
+
+	///	<summary>
+	///		Number of exchanges.
+	///	</summary>
+	unsigned long nExchanges;
+
+	///	<summary>
+	///		Number of MPI messages sent.
+	///	</summary>
+	unsigned long nMessagesSent;
+
+	///	<summary>
+	///		Number of MPI messages received.
+	///	</summary>
+	unsigned long nMessagesReceived;
+
+	///	<summary>
+	///		Number of bytes sent over MPI.
+	///	</summary>
+	unsigned long long sBytesSent;
+
+	///	<summary>
+	///		Number of bytes received over MPI.
+	///	</summary>
+	unsigned long long sBytesReceived;
+
+	///	<summary>
+	///		Number of ExchangeBuffers copied to patches on the same rank.
+	///	</summary>
+	unsigned long nLocalMessagesSent;
+
+	///	<summary>
+	///		Number of bytes copied to patches on the same rank.
+	///	</summary>
+	unsigned long long sLocalBytesSent;
+
+	///	<summary>
+	///		Number of messages sent through shared memory.
+	///	</summary>
+	unsigned long nSharedMemoryMessagesSent;
+
+	///	<summary>
+	///		Number of bytes sent through shared memory.
+	///	</summary>
+	unsigned long long sSharedMemoryBytesSent;
+
+	///	<summary>
+	///		Time spent packing ExchangeBuffers, or copying them directly to
+	///		patches on the same rank.
+	///	</summary>
+	double dPackTime;
+
+	///	<summary>
+	///		Time spent unpacking ExchangeBuffers.
+	///	</summary>
+	double dUnpackTime;
+
+	///	<summary>
+	///		Time spent blocked waiting for messages to arrive.
+	///	</summary>
+	double dWaitRecvTime;
+
+	///	<summary>
+	///		Time spent blocked waiting for sends to complete.
+	///	</summary>
+	double dWaitSendTime;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Communication statistics of the exchanges on a Grid, organized by
+///		call site and DataType.  The call site of an exchange is the
+///		innermost active named FunctionTimer when the exchange begins.
+///	</summary>
+class ExchangeStatistics {
+
+public:
+	///	<summary>
+	///		Get the seconds elapsed since the given time point.
+	///	</summary>
+	static double SecondsSince(
+		const FunctionTimer::Clock::time_point & tpStart
+	) {
+		return std::chrono::duration<double>(
+			FunctionTimer::Clock::now() - tpStart).count();
+	}
+
+public:
+	///	<summary>
+	///		Get the counters of the given call site and DataType, creating
+	///		them if they do not exist.
+	///	</summary>
+	ExchangeCounters & GetCounters(
+		FunctionTimer::GroupId idSite,
+		DataType eDataType
+	) {
+		return m_mapCounters[CounterKey(idSite, eDataType)];
+	}
+
+	///	<summary>
+	///		Remove all counters.
+	///	</summary>
+	void Reset() {
+		m_mapCounters.clear();
+	}
+
+	///	<summary>
+	///		Gather the counters of all ranks.  The root rank announces the
+	///		counters of each call site and DataType summed over ranks, with
+	///		the minimum, mean and maximum wait time over ranks, followed by
+	///		the spread of the total wait time over ranks.  If a filename is
+	///		given the counters of each rank are also written to file as CSV.
+	///		This function is collective.
+	///	</summary>
+	void Report(
+		const std::string & strFilename = ""
+	) const;
+
+private:
+	///	<summary>
+	///		Key identifying a call site and DataType.
+	///	</summary>
+	typedef std::pair<FunctionTimer::GroupId, int> CounterKey;
+
+	///	<summary>
+	///		Map from call site and DataType to counters.
+	///	</summary>
+	typedef std::map<CounterKey, ExchangeCounters> CounterMap;
+
+	///	<summary>
+	///		Counters of all call sites and DataTypes on this rank.
+	///	</summary>
+	CounterMap m_mapCounters;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    FixedOrderMatrix.h
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _FIXEDORDERMATRIX_H_
+#define _FIXEDORDERMATRIX_H_
+
+#include "DataArray2D.h"
+#include "Exception.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A copy of a square element operator (such as the derivatives of the
+///		1D GLL basis or the 1D stiffness matrix) with compile-time order.
+///		Coefficients are stored in a fixed-size array so that loops over
+///		the order can be fully unrolled and the operator held in registers.
+///	</summary>
+template <int NOrder>
+class FixedOrderMatrix {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FixedOrderMatrix(const DataArray2D<double> & dMatrix) {
+		if ((dMatrix.GetRows() != NOrder) || (dMatrix.GetColumns() != NOrder)) {
+			_EXCEPTION2("Matrix size (%i) does not match fixed order (%i)",
+				static_cast<int>(dMatrix.GetRows()), NOrder);
+		}
+		for (int i = 0; i < NOrder; i++) {
+		for (int j = 0; j < NOrder; j++) {
+			m_dMatrix[i][j] = dMatrix(i,j);
+		}
+		}
+	}
+
+	///	<summary>
+	///		Get the order of this matrix.
+	///	</summary>
+	int GetOrder() const {
+		return NOrder;
+	}
+
+	///	<summary>
+	///		Get an element of the matrix.
+	///	</summary>
+	inline double operator()(int i, int j) const {
+		return m_dMatrix[i][j];
+	}
+
+private:
+	///	<summary>
+	///		Matrix coefficients.
+	///	</summary>
+	double m_dMatrix[NOrder][NOrder];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Generic element operator of runtime order, used for orders without
+///		a specialized kernel.
+///	</summary>
+template <>
+class FixedOrderMatrix<0> {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FixedOrderMatrix(const DataArray2D<double> & dMatrix) :
+		m_dMatrix(dMatrix)
+	{ }
+
+	///	<summary>
+	///		Get the order of this matrix.
+	///	</summary>
+	int GetOrder() const {
+		return static_cast<int>(m_dMatrix.GetRows());
+	}
+
+	///	<summary>
+	///		Get an element of the matrix.
+	///	</summary>
+	inline double operator()(int i, int j) const {
+		return m_dMatrix(i,j);
+	}
+
+private:
+	///	<summary>
+	///		Reference to the matrix.
+	///	</summary>
+	const DataArray2D<double> & m_dMatrix;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Call the member function template Function<N> of the current object
+///		with the given horizontal order as a compile-time constant.  Orders
+///		2 through 8 are specialized; other orders call Function<0>, which
+///		uses the runtime order.
+///	</summary>
+#define DISPATCH_FIXED_ORDER_KERNEL(nOrder, Function, ...) \
+	switch (nOrder) { \
+		case 2: Function<2>(__VA_ARGS__); break; \
+		case 3: Function<3>(__VA_ARGS__); break; \
+		case 4: Function<4>(__VA_ARGS__); break; \
+		case 5: Function<5>(__VA_ARGS__); break; \
+		case 6: Function<6>(__VA_ARGS__); break; \
+		case 7: Function<7>(__VA_ARGS__); break; \
+		case 8: Function<8>(__VA_ARGS__); break; \
+		default: Function<0>(__VA_ARGS__); break; \
+	}
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
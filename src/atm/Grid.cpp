@@ -22,11 +22,13 @@
 #include "VerticalStretch.h"
 #include "ConsolidationStatus.h"
 #include "FunctionTimer.h"
+#include "Announce.h"
 
 #include "Exception.h"
 
 #include <cfloat>
 #include <cmath>
+#include <cstring>
 
 #ifdef TEMPEST_NETCDF
 #include <netcdfcpp.h>
@@ -44,6 +46,7 @@ Grid::Grid(
 	m_fInitialized(false),
 	m_model(model),
 	m_fBlockParallelExchange(false),
+	m_pExchangeCounters(NULL),
 	m_pVerticalStretchF(NULL)
 { }
 
@@ -53,7 +56,6 @@ void Grid::DefineParameters() {
 	if (m_dcGridParameters.IsAttached()) {
 		_EXCEPTIONT("Attempting to recall DefineParameters");
 	}
-#pragma message "May have to modify DataContainer to incorporate padding for DataChunks"
 
 	// Four lateral boundaries (rectangular mesh)
 	m_eBoundaryCondition.SetSize(4);
@@ -162,6 +164,65 @@ void Grid::InitializeDataLocal() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void Grid::ReservePatchBoxes(
+	int nPatchBoxes
+) {
+	if (nPatchBoxes <= m_nMaxPatchCount) {
+		return;
+	}
+	if (!m_dcGridPatchData.IsAttached()) {
+		_EXCEPTIONT("Grid must be initialized before reserving PatchBoxes");
+	}
+
+	// Store the existing GridPatchData, which is laid out as the number
+	// of initialized PatchBoxes, the PatchBoxes and then all other data,
+	// with each DataChunk padded by the DataContainer
+	size_t sHeadByteSize =
+		PadToDataAlignment(m_nInitializedPatchBoxes.GetByteSize());
+	size_t sOldBoxByteSize =
+		PadToDataAlignment(m_aPatchBoxes.GetByteSize());
+
+	std::vector<unsigned char> vecOldData(
+		m_dcGridPatchData.GetPointer(),
+		m_dcGridPatchData.GetPointer()
+			+ m_dcGridPatchData.GetTotalByteSize());
+
+	// Reallocate with the new number of PatchBoxes
+	m_dcGridPatchData.Deallocate();
+
+	m_nMaxPatchCount = nPatchBoxes;
+	m_aPatchBoxes.SetSize(m_nMaxPatchCount);
+
+	m_dcGridPatchData.Allocate();
+
+	size_t sNewBoxByteSize =
+		PadToDataAlignment(m_aPatchBoxes.GetByteSize());
+
+	unsigned char * pData = m_dcGridPatchData.GetPointer();
+	memcpy(pData, &(vecOldData[0]), sHeadByteSize + sOldBoxByteSize);
+	memcpy(
+		pData + sHeadByteSize + sNewBoxByteSize,
+		&(vecOldData[sHeadByteSize + sOldBoxByteSize]),
+		vecOldData.size() - sHeadByteSize - sOldBoxByteSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ReplaceDefaultPatchLayout(
+	int nPatchCount
+) {
+	if (GetActivePatchCount() != 0) {
+		_EXCEPTIONT("Patch layout cannot be replaced after patches "
+			"have been distributed");
+	}
+
+	m_nInitializedPatchBoxes = 0;
+
+	ApplyDefaultPatchLayout(nPatchCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 Grid::~Grid() {
 	if (m_pVerticalStretchF != NULL) {
 		delete m_pVerticalStretchF;
@@ -627,23 +688,52 @@ double Grid::ComputeTotalVerticalMomentum(
 void Grid::Exchange(
 	DataType eDataType,
 	int iDataIndex
+) {
+	BeginExchange(eDataType, iDataIndex);
+	EndExchange(eDataType, iDataIndex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::BeginExchange(
+	DataType eDataType,
+	int iDataIndex
 ) {
 	// Block parallel exchanges
 	if (m_fBlockParallelExchange) {
 		return;
 	}
 
-	FunctionTimer timer("Communicate");
+	// Counters for this call site and DataType
+	m_pExchangeCounters =
+		&(m_exstat.GetCounters(
+			FunctionTimer::GetCurrentGroup(), eDataType));
+
+	m_pExchangeCounters->nExchanges++;
+
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("Communicate");
+	FunctionTimer timer(s_idTimer);
 
 #ifdef TEMPEST_MPIOMP
 	// Verify all processors are prepared to exchange
+	FunctionTimer::Clock::time_point tpWaitSend =
+		FunctionTimer::Clock::now();
+
 	m_aExchangeBufferRegistry.WaitSend();
+
+	m_pExchangeCounters->dWaitSendTime +=
+		ExchangeStatistics::SecondsSince(tpWaitSend);
 #endif
 
 	// Set up asynchronous recvs
 	m_aExchangeBufferRegistry.PrepareExchange();
 
-	// Pack data
+	// Pack data, or copy it directly into the halo of patches on this
+	// processor
+	FunctionTimer::Clock::time_point tpPack =
+		FunctionTimer::Clock::now();
+
 	std::vector<ExchangeBuffer> & vecExchangeBuffers =
 		m_aExchangeBufferRegistry.GetExchangeBuffers();
 
@@ -654,22 +744,110 @@ void Grid::Exchange(
 		) {
 			_EXCEPTIONT("ExchangeBuffer active patch index out of range");
 		}
-		m_vecActiveGridPatches[ixActivePatch]->PackExchangeBuffer(
-			eDataType, iDataIndex, vecExchangeBuffers[b]);
+
+		const ExchangeBuffer * pTarget =
+			vecExchangeBuffers[b].GetLocalTarget();
+
+		if (pTarget == NULL) {
+			m_vecActiveGridPatches[ixActivePatch]->PackExchangeBuffer(
+				eDataType, iDataIndex, vecExchangeBuffers[b]);
+			continue;
+		}
+
+		int ixActiveTargetPatch = pTarget->m_ixLocalActiveSourcePatch;
+		if ((ixActiveTargetPatch < 0) ||
+		    (ixActiveTargetPatch >= m_vecActiveGridPatches.size())
+		) {
+			_EXCEPTIONT("ExchangeBuffer active patch index out of range");
+		}
+		m_vecActiveGridPatches[ixActivePatch]->CopyExchangeBuffer(
+			eDataType, iDataIndex, vecExchangeBuffers[b],
+			*(m_vecActiveGridPatches[ixActiveTargetPatch]));
 	}
 
+	m_pExchangeCounters->dPackTime +=
+		ExchangeStatistics::SecondsSince(tpPack);
+
 	// Send data
+	unsigned long nMessagesSent =
+		m_aExchangeBufferRegistry.GetMessagesSent();
+	unsigned long long sBytesSent =
+		m_aExchangeBufferRegistry.GetBytesSent();
+	unsigned long nLocalMessagesSent =
+		m_aExchangeBufferRegistry.GetLocalMessagesSent();
+	unsigned long long sLocalBytesSent =
+		m_aExchangeBufferRegistry.GetLocalBytesSent();
+	unsigned long nSharedMemoryMessagesSent =
+		m_aExchangeBufferRegistry.GetSharedMemoryMessagesSent();
+	unsigned long long sSharedMemoryBytesSent =
+		m_aExchangeBufferRegistry.GetSharedMemoryBytesSent();
+
 	m_aExchangeBufferRegistry.Send();
 
+	m_pExchangeCounters->nMessagesSent +=
+		m_aExchangeBufferRegistry.GetMessagesSent() - nMessagesSent;
+	m_pExchangeCounters->sBytesSent +=
+		m_aExchangeBufferRegistry.GetBytesSent() - sBytesSent;
+	m_pExchangeCounters->nLocalMessagesSent +=
+		m_aExchangeBufferRegistry.GetLocalMessagesSent()
+		- nLocalMessagesSent;
+	m_pExchangeCounters->sLocalBytesSent +=
+		m_aExchangeBufferRegistry.GetLocalBytesSent() - sLocalBytesSent;
+	m_pExchangeCounters->nSharedMemoryMessagesSent +=
+		m_aExchangeBufferRegistry.GetSharedMemoryMessagesSent()
+		- nSharedMemoryMessagesSent;
+	m_pExchangeCounters->sSharedMemoryBytesSent +=
+		m_aExchangeBufferRegistry.GetSharedMemoryBytesSent()
+		- sSharedMemoryBytesSent;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::EndExchange(
+	DataType eDataType,
+	int iDataIndex
+) {
+	// Block parallel exchanges
+	if (m_fBlockParallelExchange) {
+		return;
+	}
+
+	// Counters of the matching call to BeginExchange()
+	if (m_pExchangeCounters == NULL) {
+		m_pExchangeCounters =
+			&(m_exstat.GetCounters(
+				FunctionTimer::GetCurrentGroup(), eDataType));
+	}
+	ExchangeCounters & counters = *m_pExchangeCounters;
+	m_pExchangeCounters = NULL;
+
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("Communicate");
+	FunctionTimer timer(s_idTimer);
+
+	unsigned long nMessagesReceived =
+		m_aExchangeBufferRegistry.GetMessagesReceived();
+	unsigned long long sBytesReceived =
+		m_aExchangeBufferRegistry.GetBytesReceived();
+
 	// Receive data
 	for (;;) {
+		FunctionTimer::Clock::time_point tpWaitRecv =
+			FunctionTimer::Clock::now();
+
 		const std::vector<ExchangeBuffer *> * pExchangeBuffers =
 			m_aExchangeBufferRegistry.WaitReceive();
 
+		counters.dWaitRecvTime +=
+			ExchangeStatistics::SecondsSince(tpWaitRecv);
+
 		if (pExchangeBuffers == NULL) {
 			break;
 		}
 
+		FunctionTimer::Clock::time_point tpUnpack =
+			FunctionTimer::Clock::now();
+
 		for (int b = 0; b < pExchangeBuffers->size(); b++) {
 			int ixActivePatch =
 				(*pExchangeBuffers)[b]->m_ixLocalActiveSourcePatch;
@@ -681,7 +859,17 @@ void Grid::Exchange(
 			m_vecActiveGridPatches[ixActivePatch]->UnpackExchangeBuffer(
 				eDataType, iDataIndex, *((*pExchangeBuffers)[b]));
 		}
+
+		counters.dUnpackTime +=
+			ExchangeStatistics::SecondsSince(tpUnpack);
 	}
+
+	counters.nMessagesReceived +=
+		m_aExchangeBufferRegistry.GetMessagesReceived()
+		- nMessagesReceived;
+	counters.sBytesReceived +=
+		m_aExchangeBufferRegistry.GetBytesReceived()
+		- sBytesReceived;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -692,7 +880,7 @@ int Grid::GetMaxNodeCount2D() const {
 	int nMaxNodes2D = 0;
 
 	// Loop over all patches and obtain total node count
-	for (int n = 0; n < m_aPatchBoxes.GetRows(); n++) {
+	for (int n = 0; n < GetPatchCount(); n++) {
 		int nPatchNodes2D = m_aPatchBoxes[n].GetTotalNodeCount2D();
 
 		if (nPatchNodes2D > nMaxNodes2D) {
@@ -711,7 +899,7 @@ int Grid::GetTotalNodeCount2D() const {
 	int nTotalNodes2D = 0;
 
 	// Loop over all patches and obtain total node count
-	for (int n = 0; n < m_aPatchBoxes.GetRows(); n++) {
+	for (int n = 0; n < GetPatchCount(); n++) {
 		nTotalNodes2D += m_aPatchBoxes[n].GetTotalNodeCount2D();
 	}
 
@@ -728,7 +916,7 @@ int Grid::GetMaxNodeCount(
 	int nMaxNodes = 0;
 
 	// Loop over all patches and obtain total node count
-	for (int n = 0; n < m_aPatchBoxes.GetRows(); n++) {
+	for (int n = 0; n < GetPatchCount(); n++) {
 		const PatchBox & box = GetPatchBox(n);
 
 		int nPatchNodes;
@@ -758,7 +946,7 @@ int Grid::GetTotalNodeCount(
 	int nTotalNodes = 0;
 
 	// Loop over all patches and obtain total node count
-	for (int n = 0; n < m_aPatchBoxes.GetRows(); n++) {
+	for (int n = 0; n < GetPatchCount(); n++) {
 		const PatchBox & box = GetPatchBox(n);
 
 		int nPatchNodes;
@@ -840,6 +1028,38 @@ void Grid::ComputeRichardson(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+double Grid::ComputeMaximumCourantNumber(
+	int iDataIndex,
+	double dDeltaT
+) const {
+	double dMaxCourantNumber = 0.0;
+
+	// Loop over all grid patches
+	for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+		double dPatchCourantNumber =
+			m_vecActiveGridPatches[n]->ComputeMaximumCourantNumber(
+				iDataIndex, dDeltaT);
+
+		if (dPatchCourantNumber > dMaxCourantNumber) {
+			dMaxCourantNumber = dPatchCourantNumber;
+		}
+	}
+
+#ifdef TEMPEST_MPIOMP
+	MPI_Allreduce(
+		MPI_IN_PLACE,
+		&dMaxCourantNumber,
+		1,
+		MPI_DOUBLE,
+		MPI_MAX,
+		MPI_COMM_WORLD);
+#endif
+
+	return dMaxCourantNumber;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void Grid::InterpolateNodeToREdge(
 	int iVar,
 	int iDataIndex
@@ -864,6 +1084,89 @@ void Grid::InterpolateREdgeToNode(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void Grid::InitializeInterpStencil(
+	const DataArray1D<double> & dAlpha,
+	const DataArray1D<double> & dBeta,
+	const DataArray1D<int> & iPatch,
+	GridInterpStencil & stencil
+) const {
+	// Check interpolation data array size
+	if ((dAlpha.GetRows() != dBeta.GetRows()) ||
+		(dAlpha.GetRows() != iPatch.GetRows())
+	) {
+		_EXCEPTIONT("Inconsistency in vector lengths.");
+	}
+
+	// Current processor and number of processors
+	int nRank = 0;
+	int nSize = 1;
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nSize);
+#endif
+
+	const int nPoints = dAlpha.GetRows();
+
+	stencil.m_iGridStamp = m_iGridStamp;
+	stencil.m_vecPointProcessor.resize(nPoints);
+	stencil.m_vecPointCount.assign(nSize, 0);
+
+	// Determine the processor that owns each point.  On root, points are
+	// interpolated directly into the full array of points; on all other
+	// processors they are interpolated into a compact array of the points
+	// owned by that processor.
+	std::vector<int> vecLocalPoint(nPoints, (-1));
+
+	for (int i = 0; i < nPoints; i++) {
+		if ((iPatch[i] < 0) || (iPatch[i] >= GetPatchCount())) {
+			stencil.m_vecPointProcessor[i] = (-1);
+			continue;
+		}
+
+#ifdef TEMPEST_MPIOMP
+		int iProcessor = m_vecPatchProcessor[iPatch[i]];
+#else
+		int iProcessor = 0;
+#endif
+		stencil.m_vecPointProcessor[i] = iProcessor;
+
+		if (iProcessor == nRank) {
+			if (nRank == 0) {
+				vecLocalPoint[i] = i;
+			} else {
+				vecLocalPoint[i] = stencil.m_vecPointCount[iProcessor];
+			}
+		}
+		stencil.m_vecPointCount[iProcessor]++;
+	}
+
+	if (nRank == 0) {
+		stencil.m_nLocalPoints = nPoints;
+	} else {
+		stencil.m_nLocalPoints = stencil.m_vecPointCount[nRank];
+	}
+
+	// Build interpolation stencils on each active patch
+	stencil.m_vecPatchStencils.resize(m_vecActiveGridPatches.size());
+
+	for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+		PatchInterpStencil & stencilPatch = stencil.m_vecPatchStencils[n];
+
+		m_vecActiveGridPatches[n]->InitializeInterpStencil(
+			dAlpha,
+			dBeta,
+			iPatch,
+			stencilPatch);
+
+		for (int j = 0; j < stencilPatch.GetPointCount(); j++) {
+			stencilPatch.m_vecPoint[j] =
+				vecLocalPoint[stencilPatch.m_vecPoint[j]];
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void Grid::ReduceInterpolate(
 	DataType eDataType,
 	const DataArray1D<double> & dREta,
@@ -875,11 +1178,36 @@ void Grid::ReduceInterpolate(
 	bool fIncludeReferenceState,
 	bool fConvertToPrimitive
 ) const {
-	// Check interpolation data array size
-	if ((dAlpha.GetRows() != dBeta.GetRows()) ||
-		(dAlpha.GetRows() != iPatch.GetRows())
+	GridInterpStencil stencil;
+
+	InitializeInterpStencil(dAlpha, dBeta, iPatch, stencil);
+
+	ReduceInterpolate(
+		eDataType,
+		dREta,
+		stencil,
+		dInterpData,
+		eOnlyVariablesAt,
+		fIncludeReferenceState,
+		fConvertToPrimitive);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::ReduceInterpolate(
+	DataType eDataType,
+	const DataArray1D<double> & dREta,
+	const GridInterpStencil & stencil,
+	DataArray3D<double> & dInterpData,
+	DataLocation eOnlyVariablesAt,
+	bool fIncludeReferenceState,
+	bool fConvertToPrimitive
+) const {
+	// Check that the stencil is consistent with the grid
+	if ((stencil.m_iGridStamp != m_iGridStamp) ||
+		(stencil.m_vecPatchStencils.size() != m_vecActiveGridPatches.size())
 	) {
-		_EXCEPTIONT("Inconsistency in vector lengths.");
+		_EXCEPTIONT("Interpolation stencil is out of date.");
 	}
 
 	if ((eDataType == DataType_Tracers) &&
@@ -938,56 +1266,141 @@ void Grid::ReduceInterpolate(
 		_EXCEPTIONT("InterpData dimension mismatch (1)");
 	}
 
-	if (dInterpData.GetSubColumns() != dAlpha.GetRows()) {
+	if (dInterpData.GetSubColumns() != stencil.m_vecPointProcessor.size()) {
 		_EXCEPTIONT("InterpData dimension mismatch (2)");
 	}
 
-	// Zero the interpolated data
-	dInterpData.Zero();
-
-	// Interpolate data
-	for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
-		m_vecActiveGridPatches[n]->InterpolateData(
-			eDataType,
-			dREta,
-			dAlpha,
-			dBeta,
-			iPatch,
-			dInterpData,
-			eOnlyVariablesAt,
-			fIncludeReferenceState,
-			fConvertToPrimitive);
-	}
-
 #ifdef TEMPEST_MPIOMP
-	// Perform an Reduce operation to combine all data
+	// Current processor
 	int nRank;
 	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 
+	// Number of processors
+	int nSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nSize);
+
+	const int nPoints = stencil.m_vecPointProcessor.size();
+	const int nValuesPerPoint =
+		dInterpData.GetRows() * dInterpData.GetColumns();
+
+	// Root interpolates directly into the output array and gathers the
+	// points owned by all other processors
 	if (nRank == 0) {
-		MPI_Reduce(
-			MPI_IN_PLACE,
-			&(dInterpData[0][0][0]),
-			dInterpData.GetRows()
-				* dInterpData.GetColumns()
-				* dInterpData.GetSubColumns(),
+		dInterpData.Zero();
+
+		for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+			m_vecActiveGridPatches[n]->InterpolateData(
+				eDataType,
+				dREta,
+				stencil.m_vecPatchStencils[n],
+				dInterpData,
+				eOnlyVariablesAt,
+				fIncludeReferenceState,
+				fConvertToPrimitive);
+		}
+
+		std::vector<int> vecRecvCount(nSize);
+		std::vector<int> vecRecvDispl(nSize);
+
+		int nTotalRecv = 0;
+		for (int p = 0; p < nSize; p++) {
+			if (p == 0) {
+				vecRecvCount[p] = 0;
+			} else {
+				vecRecvCount[p] =
+					stencil.m_vecPointCount[p] * nValuesPerPoint;
+			}
+			vecRecvDispl[p] = nTotalRecv;
+			nTotalRecv += vecRecvCount[p];
+		}
+
+		DataArray1D<double> dRecvData(nTotalRecv);
+
+		MPI_Gatherv(
+			NULL,
+			0,
+			MPI_DOUBLE,
+			(nTotalRecv == 0)?(NULL):(&(dRecvData[0])),
+			&(vecRecvCount[0]),
+			&(vecRecvDispl[0]),
 			MPI_DOUBLE,
-			MPI_SUM,
 			0,
 			MPI_COMM_WORLD);
 
+		// Scatter received values into the output array.  Data from each
+		// processor is ordered by component, level and then point.
+		std::vector<int> vecPointIx(nSize, 0);
+
+		for (int i = 0; i < nPoints; i++) {
+			int p = stencil.m_vecPointProcessor[i];
+			if (p <= 0) {
+				continue;
+			}
+
+			const double * dData =
+				&(dRecvData[vecRecvDispl[p]]) + vecPointIx[p];
+
+			for (int c = 0; c < dInterpData.GetRows(); c++) {
+			for (int k = 0; k < dInterpData.GetColumns(); k++) {
+				dInterpData[c][k][i] = dData[0];
+				dData += stencil.m_vecPointCount[p];
+			}
+			}
+
+			vecPointIx[p]++;
+		}
+
+	// Other processors interpolate only the points they own and send the
+	// result to root.  The output array is not accessed on these
+	// processors and need not be allocated.
 	} else {
-		MPI_Reduce(
-			&(dInterpData[0][0][0]),
+		const int nLocalPoints = stencil.m_nLocalPoints;
+
+		DataArray3D<double> dLocalInterpData;
+		if (nLocalPoints != 0) {
+			dLocalInterpData.Allocate(
+				dInterpData.GetRows(),
+				dInterpData.GetColumns(),
+				nLocalPoints);
+
+			for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+				m_vecActiveGridPatches[n]->InterpolateData(
+					eDataType,
+					dREta,
+					stencil.m_vecPatchStencils[n],
+					dLocalInterpData,
+					eOnlyVariablesAt,
+					fIncludeReferenceState,
+					fConvertToPrimitive);
+			}
+		}
+
+		MPI_Gatherv(
+			(nLocalPoints == 0)?(NULL):(&(dLocalInterpData[0][0][0])),
+			nLocalPoints * nValuesPerPoint,
+			MPI_DOUBLE,
+			NULL,
+			NULL,
 			NULL,
-			dInterpData.GetRows()
-				* dInterpData.GetColumns()
-				* dInterpData.GetSubColumns(),
 			MPI_DOUBLE,
-			MPI_SUM,
 			0,
 			MPI_COMM_WORLD);
 	}
+#else
+	// Zero the interpolated data
+	dInterpData.Zero();
+
+	// Interpolate data
+	for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+		m_vecActiveGridPatches[n]->InterpolateData(
+			eDataType,
+			dREta,
+			stencil.m_vecPatchStencils[n],
+			dInterpData,
+			eOnlyVariablesAt,
+			fIncludeReferenceState,
+			fConvertToPrimitive);
+	}
 #endif
 }
 
@@ -1045,24 +1458,336 @@ void Grid::DistributePatches() {
 	int nRank;
 	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 
+	// Weight each patch by its number of interior nodes
+	int nPatchCount = GetPatchCount();
+
+	std::vector<long> vecPatchWeight(nPatchCount);
+	for (int n = 0; n < nPatchCount; n++) {
+		const PatchBox & box = m_aPatchBoxes[n];
+		vecPatchWeight[n] =
+			static_cast<long>(box.GetAInteriorWidth())
+			* static_cast<long>(box.GetBInteriorWidth());
+	}
+
+	// Assign contiguous runs of patches to each processor
+	std::vector<int> vecPartBegin;
+	PartitionContiguous(vecPatchWeight, nSize, vecPartBegin);
+
 	// Loop over all patches and initialize data
-	m_vecPatchProcessor.resize(m_aPatchBoxes.GetRows());
-	for (int n = 0; n < m_aPatchBoxes.GetRows(); n++) {
-		int iPatchProcessor = n % nSize;
-		m_vecPatchProcessor[n] = iPatchProcessor;
+	m_vecPatchProcessor.resize(nPatchCount);
+	for (int p = 0; p < nSize; p++) {
+	for (int n = vecPartBegin[p]; n < vecPartBegin[p+1]; n++) {
+		m_vecPatchProcessor[n] = p;
 
-		if (iPatchProcessor == nRank) {
+		if (p == nRank) {
 			GridPatch * pPatch = NewPatch(n);
 			pPatch->InitializeDataLocal();
 			m_vecActiveGridPatches.push_back(pPatch);
 			m_vecActiveGridPatchIndices.push_back(n);
 		}
 	}
+	}
 #endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+bool Grid::RebalancePatches(
+	unsigned long lComputeTime
+) {
+#ifdef TEMPEST_MPIOMP
+	// Migrate patches only if the cost on the most expensive processor
+	// is reduced by at least this fraction
+	const double MinimumImprovement = 0.05;
+
+	// Number of processors
+	int nSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nSize);
+
+	// Current processor
+	int nRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+
+	int nPatchCount = GetPatchCount();
+
+	if (m_vecPatchProcessor.size() != nPatchCount) {
+		_EXCEPTIONT("Patches have not been distributed");
+	}
+
+	// Estimate the cost of each active patch
+	DataArray1D<double> dPatchCost(nPatchCount);
+	{
+		unsigned long lMeasuredTime = 0;
+		long lLocalNodes = 0;
+
+		for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+			const GridPatch * pPatch = m_vecActiveGridPatches[n];
+			const PatchBox & box = pPatch->GetPatchBox();
+
+			lMeasuredTime += pPatch->GetComputeTime();
+			lLocalNodes +=
+				static_cast<long>(box.GetAInteriorWidth())
+				* static_cast<long>(box.GetBInteriorWidth());
+		}
+
+		double dUnmeasuredTime = 0.0;
+		if (lComputeTime > lMeasuredTime) {
+			dUnmeasuredTime =
+				static_cast<double>(lComputeTime - lMeasuredTime);
+		}
+
+		for (int n = 0; n < m_vecActiveGridPatches.size(); n++) {
+			GridPatch * pPatch = m_vecActiveGridPatches[n];
+			const PatchBox & box = pPatch->GetPatchBox();
+
+			long lPatchNodes =
+				static_cast<long>(box.GetAInteriorWidth())
+				* static_cast<long>(box.GetBInteriorWidth());
+
+			dPatchCost[pPatch->GetPatchIndex()] =
+				static_cast<double>(pPatch->GetComputeTime())
+				+ dUnmeasuredTime
+					* static_cast<double>(lPatchNodes)
+					/ static_cast<double>(lLocalNodes);
+
+			pPatch->ResetComputeTime();
+		}
+	}
+
+	MPI_Allreduce(
+		MPI_IN_PLACE,
+		&(dPatchCost[0]),
+		nPatchCount,
+		MPI_DOUBLE,
+		MPI_SUM,
+		MPI_COMM_WORLD);
+
+	// Partition the patches by cost, preserving their order
+	std::vector<long> vecPatchWeight(nPatchCount);
+	for (int n = 0; n < nPatchCount; n++) {
+		vecPatchWeight[n] = static_cast<long>(dPatchCost[n] + 0.5);
+	}
+
+	std::vector<int> vecPartBegin;
+	PartitionContiguous(vecPatchWeight, nSize, vecPartBegin);
+
+	std::vector<int> vecNewPatchProcessor(nPatchCount);
+	for (int p = 0; p < nSize; p++) {
+		for (int n = vecPartBegin[p]; n < vecPartBegin[p+1]; n++) {
+			vecNewPatchProcessor[n] = p;
+		}
+	}
+
+	// Compare the cost on the most expensive processor
+	DataArray1D<double> dProcessorCost(nSize);
+	DataArray1D<double> dNewProcessorCost(nSize);
+	for (int n = 0; n < nPatchCount; n++) {
+		dProcessorCost[m_vecPatchProcessor[n]] += dPatchCost[n];
+		dNewProcessorCost[vecNewPatchProcessor[n]] += dPatchCost[n];
+	}
+
+	double dMaxCost = 0.0;
+	double dNewMaxCost = 0.0;
+	for (int p = 0; p < nSize; p++) {
+		dMaxCost = Max(dMaxCost, dProcessorCost[p]);
+		dNewMaxCost = Max(dNewMaxCost, dNewProcessorCost[p]);
+	}
+
+	if (dNewMaxCost > (1.0 - MinimumImprovement) * dMaxCost) {
+		return false;
+	}
+
+	Announce("Rebalancing patches (maximum processor cost %1.3f s -> %1.3f s)",
+		dMaxCost / static_cast<double>(FunctionTimer::MICROSECONDS_PER_SECOND),
+		dNewMaxCost / static_cast<double>(FunctionTimer::MICROSECONDS_PER_SECOND));
+
+	// Migrate patch data.  Messages between each pair of processors are
+	// posted in order of patch index and DataContainer, so they are
+	// matched in order.
+	const int RebalanceMessageTag = 1;
+
+	std::vector<MPI_Request> vecRequest;
+	std::vector<GridPatch *> vecIncomingPatches;
+	std::vector<int> vecOutgoingPatchIndices;
+
+	for (int n = 0; n < nPatchCount; n++) {
+		int iOldProcessor = m_vecPatchProcessor[n];
+		int iNewProcessor = vecNewPatchProcessor[n];
+
+		if (iOldProcessor == iNewProcessor) {
+			continue;
+		}
+
+		GridPatch * pPatch = NULL;
+		int iRemoteProcessor;
+
+		if (iNewProcessor == nRank) {
+			pPatch = NewPatch(n);
+			pPatch->InitializeDataLocal();
+			vecIncomingPatches.push_back(pPatch);
+			iRemoteProcessor = iOldProcessor;
+
+		} else if (iOldProcessor == nRank) {
+			for (int i = 0; i < m_vecActiveGridPatches.size(); i++) {
+				if (m_vecActiveGridPatchIndices[i] == n) {
+					pPatch = m_vecActiveGridPatches[i];
+					break;
+				}
+			}
+			if (pPatch == NULL) {
+				_EXCEPTION1("Patch %i not active on this processor", n);
+			}
+			vecOutgoingPatchIndices.push_back(n);
+			iRemoteProcessor = iNewProcessor;
+
+		} else {
+			continue;
+		}
+
+		DataContainer * pDataContainers[4] = {
+			&(pPatch->GetDataContainerGeometric()),
+			&(pPatch->GetDataContainerActiveState()),
+			&(pPatch->GetDataContainerBufferState()),
+			&(pPatch->GetDataContainerAuxiliary())
+		};
+
+		for (int d = 0; d < 4; d++) {
+			MPI_Request request;
+
+			if (iNewProcessor == nRank) {
+				MPI_Irecv(
+					pDataContainers[d]->GetPointer(),
+					pDataContainers[d]->GetTotalByteSize(),
+					MPI_BYTE,
+					iRemoteProcessor,
+					RebalanceMessageTag,
+					MPI_COMM_WORLD,
+					&request);
+
+			} else {
+				MPI_Isend(
+					pDataContainers[d]->GetPointer(),
+					pDataContainers[d]->GetTotalByteSize(),
+					MPI_BYTE,
+					iRemoteProcessor,
+					RebalanceMessageTag,
+					MPI_COMM_WORLD,
+					&request);
+			}
+
+			vecRequest.push_back(request);
+		}
+	}
+
+	if (vecRequest.size() != 0) {
+		MPI_Waitall(
+			vecRequest.size(),
+			&(vecRequest[0]),
+			MPI_STATUSES_IGNORE);
+	}
+
+	// Update the set of active patches, in order of patch index
+	for (int i = 0; i < vecOutgoingPatchIndices.size(); i++) {
+		DeactivatePatch(vecOutgoingPatchIndices[i]);
+	}
+
+	for (int i = 0; i < vecIncomingPatches.size(); i++) {
+		GridPatch * pPatch = vecIncomingPatches[i];
+
+		int ix = 0;
+		for (; ix < m_vecActiveGridPatchIndices.size(); ix++) {
+			if (m_vecActiveGridPatchIndices[ix] > pPatch->GetPatchIndex()) {
+				break;
+			}
+		}
+
+		m_vecActiveGridPatches.insert(
+			m_vecActiveGridPatches.begin() + ix, pPatch);
+		m_vecActiveGridPatchIndices.insert(
+			m_vecActiveGridPatchIndices.begin() + ix,
+			pPatch->GetPatchIndex());
+	}
+
+	m_vecPatchProcessor = vecNewPatchProcessor;
+
+	// Invalidate interpolation stencils built for the old distribution
+	m_iGridStamp = m_iGridStamp + 1;
+
+	// Rebuild exchange buffers and connectivity
+	m_aExchangeBufferRegistry.Clear();
+
+	InitializeExchangeBuffersFromActivePatches();
+	InitializeConnectivity();
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void Grid::PartitionContiguous(
+	const std::vector<long> & vecWeight,
+	int nParts,
+	std::vector<int> & vecPartBegin
+) {
+	if (nParts < 1) {
+		_EXCEPTION1("Invalid number of parts (%i)", nParts);
+	}
+
+	int nItems = static_cast<int>(vecWeight.size());
+
+	// Cumulative weight at the beginning of each item
+	std::vector<long> vecCumulative(nItems + 1);
+	vecCumulative[0] = 0;
+	for (int i = 0; i < nItems; i++) {
+		if (vecWeight[i] < 0) {
+			_EXCEPTION1("Negative weight on item %i", i);
+		}
+		vecCumulative[i+1] = vecCumulative[i] + vecWeight[i];
+	}
+
+	const long lTotal = vecCumulative[nItems];
+
+	// Place each cut at the item boundary closest to k * lTotal / nParts,
+	// keeping at least one item in each remaining run where possible
+	vecPartBegin.resize(nParts + 1);
+	vecPartBegin[0] = 0;
+	vecPartBegin[nParts] = nItems;
+
+	int i = 0;
+	for (int k = 1; k < nParts; k++) {
+		const long lTarget = static_cast<long>(k) * lTotal;
+
+		while ((i < nItems) && (vecCumulative[i] * nParts < lTarget)) {
+			i++;
+		}
+
+		int iCut = i;
+		if ((i > 0) &&
+			(lTarget - vecCumulative[i-1] * nParts
+				< vecCumulative[i] * nParts - lTarget)
+		) {
+			iCut = i - 1;
+		}
+
+		int iMin = Min(vecPartBegin[k-1] + 1, nItems);
+		int iMax = Max(nItems - (nParts - k), iMin);
+
+		if (iCut < iMin) {
+			iCut = iMin;
+		}
+		if (iCut > iMax) {
+			iCut = iMax;
+		}
+
+		vecPartBegin[k] = iCut;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void Grid::RegisterExchangeBuffer(
 	int ixSourcePatch,
 	int ixTargetPatch,
@@ -1260,6 +1985,12 @@ void Grid::InitializeExchangeBuffersFromPatch(
 ) {
 	const PatchBox & box = GetPatchBox(ixSourcePatch);
 
+	// First ExchangeBuffer registered for this patch
+	std::vector<ExchangeBuffer> & vecExchangeBuffers =
+		m_aExchangeBufferRegistry.GetExchangeBuffers();
+
+	const int ixFirstExchangeBuffer = vecExchangeBuffers.size();
+
 	// Vector of nodal points around element
 	int nPerimeter = box.GetInteriorPerimeter() + 4;
 
@@ -1562,6 +2293,66 @@ void Grid::InitializeExchangeBuffersFromPatch(
 	if (ix != box.GetInteriorPerimeter() + 4) {
 		_EXCEPTIONT("Index mismatch");
 	}
+
+	// With non-conforming patch edges a neighboring patch may connect
+	// diagonally both at a patch corner and at an edge junction in the
+	// same direction.  Mark these so that messages can be matched.
+	for (int m = ixFirstExchangeBuffer; m < vecExchangeBuffers.size(); m++) {
+	for (int n = m + 1; n < vecExchangeBuffers.size(); n++) {
+		ExchangeBuffer & exbufM = vecExchangeBuffers[m];
+		ExchangeBuffer & exbufN = vecExchangeBuffers[n];
+
+		if ((exbufM.m_ixTargetPatch != exbufN.m_ixTargetPatch) ||
+		    (exbufM.m_dir != exbufN.m_dir)
+		) {
+			continue;
+		}
+
+		int ixCornerFirst;
+		int ixCornerSecond;
+
+		if (exbufM.m_dir == Direction_TopRight) {
+			ixCornerFirst  = box.GetAInteriorEnd()-1;
+			ixCornerSecond = box.GetBInteriorEnd()-1;
+
+		} else if (exbufM.m_dir == Direction_TopLeft) {
+			ixCornerFirst  = box.GetAInteriorBegin();
+			ixCornerSecond = box.GetBInteriorEnd()-1;
+
+		} else if (exbufM.m_dir == Direction_BottomLeft) {
+			ixCornerFirst  = box.GetAInteriorBegin();
+			ixCornerSecond = box.GetBInteriorBegin();
+
+		} else if (exbufM.m_dir == Direction_BottomRight) {
+			ixCornerFirst  = box.GetAInteriorEnd()-1;
+			ixCornerSecond = box.GetBInteriorBegin();
+
+		} else {
+			_EXCEPTION2("Multiple ExchangeBuffers along edge "
+				"from patch %i to patch %i",
+				ixSourcePatch, exbufM.m_ixTargetPatch);
+		}
+
+		if ((exbufM.m_ixFirst == ixCornerFirst) &&
+		    (exbufM.m_ixSecond == ixCornerSecond)
+		) {
+			exbufM.m_eDiagonalType = ExchangeBuffer::DiagonalType_PatchCorner;
+			exbufN.m_eDiagonalType = ExchangeBuffer::DiagonalType_EdgeJunction;
+
+		} else if (
+		    (exbufN.m_ixFirst == ixCornerFirst) &&
+		    (exbufN.m_ixSecond == ixCornerSecond)
+		) {
+			exbufM.m_eDiagonalType = ExchangeBuffer::DiagonalType_EdgeJunction;
+			exbufN.m_eDiagonalType = ExchangeBuffer::DiagonalType_PatchCorner;
+
+		} else {
+			_EXCEPTION2("Multiple diagonal ExchangeBuffers from patch %i "
+				"to patch %i away from the patch corner",
+				ixSourcePatch, exbufM.m_ixTargetPatch);
+		}
+	}
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@
 #include "ChecksumType.h"
 #include "MathHelper.h"
 #include "Connectivity.h"
+#include "ExchangeStatistics.h"
 #include "DataStruct.h"
 
 #ifdef TEMPEST_MPIOMP
@@ -232,6 +233,28 @@ public:
 		_EXCEPTIONT("Unimplemented");
 	}
 
+	///	<summary>
+	///		Begin post-processing of variables on the grid after each
+	///		TimeStep substage.  Only data on the patch interior may be
+	///		modified before the matching call to EndPostProcessSubstage().
+	///	</summary>
+	virtual void BeginPostProcessSubstage(
+		int iDataUpdate,
+		DataType eDataType = DataType_State
+	) {
+	}
+
+	///	<summary>
+	///		Complete post-processing of variables on the grid after each
+	///		TimeStep substage.
+	///	</summary>
+	virtual void EndPostProcessSubstage(
+		int iDataUpdate,
+		DataType eDataType = DataType_State
+	) {
+		PostProcessSubstage(iDataUpdate, eDataType);
+	}
+
 public:
 	///	<summary>
 	///		Perform checksum calculation on all state variables.
@@ -273,6 +296,27 @@ public:
 		int iDataIndex
 	);
 
+	///	<summary>
+	///		Begin a split-phase exchange of data between processors by
+	///		packing and sending all outgoing buffers.  Data on the patch
+	///		interior may be modified before the matching call to
+	///		EndExchange(), but halo data and data on the patch edge must
+	///		not be.
+	///	</summary>
+	void BeginExchange(
+		DataType eDataType,
+		int iDataIndex
+	);
+
+	///	<summary>
+	///		Complete a split-phase exchange of data between processors by
+	///		receiving and unpacking all incoming buffers.
+	///	</summary>
+	void EndExchange(
+		DataType eDataType,
+		int iDataIndex
+	);
+
 public:
 	///	<summary>
 	///		Get the total number of patches on the grid.
@@ -350,6 +394,15 @@ public:
 		int iDataIndex
 	);
 
+	///	<summary>
+	///		Compute the maximum horizontal Courant number over all
+	///		processors for a time step of dDeltaT seconds.
+	///	</summary>
+	double ComputeMaximumCourantNumber(
+		int iDataIndex,
+		double dDeltaT
+	) const;
+
 	///	<summary>
 	///		Interpolate data vertically from Nodes to REdges.
 	///	</summary>
@@ -379,9 +432,41 @@ public:
 		_EXCEPTIONT("Not implemented");
 	}
 
+	///	<summary>
+	///		Build interpolation stencils from the active patches to the
+	///		given points in patch coordinates, for use in
+	///		ReduceInterpolate().  Stencils must be rebuilt whenever the
+	///		grid stamp changes.
+	///	</summary>
+	void InitializeInterpStencil(
+		const DataArray1D<double> & dAlpha,
+		const DataArray1D<double> & dBeta,
+		const DataArray1D<int> & iPatch,
+		GridInterpStencil & stencil
+	) const;
+
 	///	<summary>
 	///		Perform interpolation on a node array and send data to root
-	///		(generally used for serial output on reference grid)
+	///		(generally used for serial output on reference grid).
+	///	</summary>
+	void ReduceInterpolate(
+		DataType eDataType,
+		const DataArray1D<double> & dREta,
+		const DataArray1D<double> & dAlpha,
+		const DataArray1D<double> & dBeta,
+		const DataArray1D<int> & iPatch,
+		DataArray3D<double> & dInterpData,
+		DataLocation eOnlyVariablesAt = DataLocation_None,
+		bool fIncludeReferenceState = true,
+		bool fConvertToPrimitive = true
+	) const;
+
+	///	<summary>
+	///		Perform interpolation on a node array using precomputed
+	///		stencils and send data to root.  Each processor interpolates
+	///		only the points in its active patches and sends these values
+	///		to root.  dInterpData is only written on root; on other
+	///		processors only its size is used.
 	///	</summary>
 	///	<param name="eDataLocation">
 	///		DataLocation_Node  = Interpolate all variables on nodes
@@ -390,9 +475,7 @@ public:
 	void ReduceInterpolate(
 		DataType eDataType,
 		const DataArray1D<double> & dREta,
-		const DataArray1D<double> & dAlpha,
-		const DataArray1D<double> & dBeta,
-		const DataArray1D<int> & iPatch,
+		const GridInterpStencil & stencil,
 		DataArray3D<double> & dInterpData,
 		DataLocation eOnlyVariablesAt = DataLocation_None,
 		bool fIncludeReferenceState = true,
@@ -442,7 +525,10 @@ public:
 
 public:
 	///	<summary>
-	///		Build the default patch layout.
+	///		Build the default patch layout.  Layouts should number patches
+	///		so that consecutive patches are spatially adjacent, since
+	///		DistributePatches() assigns contiguous runs of patches to
+	///		each processor.
 	///	</summary>
 	virtual void ApplyDefaultPatchLayout(
 		int nPatchCount
@@ -451,14 +537,32 @@ public:
 	}
 
 	///	<summary>
-	///		Return a pointer to a new GridPatch.
+	///		Replace the current patch layout with the default patch layout.
+	///		Patches must not have been distributed among processors.
+	///	</summary>
+	void ReplaceDefaultPatchLayout(
+		int nPatchCount
+	);
+
+	///	<summary>
+	///		Return a pointer to a new GridPatch with the given PatchBox.
 	///	</summary>
 	virtual GridPatch * NewPatch(
-		int ixPatch
+		int ixPatch,
+		const PatchBox & box
 	) {
 		_EXCEPTIONT("Not implemented");
 	}
 
+	///	<summary>
+	///		Return a pointer to a new GridPatch.
+	///	</summary>
+	GridPatch * NewPatch(
+		int ixPatch
+	) {
+		return NewPatch(ixPatch, GetPatchBox(ixPatch));
+	}
+
 	///	<summary>
 	///		Create a new empty GridPatch and activate it.
 	///	</summary>
@@ -474,6 +578,14 @@ public:
 	);
 
 protected:
+	///	<summary>
+	///		Ensure storage is available for at least the given number of
+	///		PatchBoxes, preserving all other GridPatchData.
+	///	</summary>
+	void ReservePatchBoxes(
+		int nPatchBoxes
+	);
+
 	///	<summary>
 	///		Add a patch to the grid.
 	///	</summary>
@@ -496,12 +608,46 @@ public:
 		return m_aExchangeBufferRegistry;
 	}
 
+	///	<summary>
+	///		Get a reference to the communication statistics of exchanges.
+	///	</summary>
+	ExchangeStatistics & GetExchangeStatistics() {
+		return m_exstat;
+	}
+
 public:
 	///	<summary>
 	///		Distribute patches among processors and allocate local patches.
+	///		Each processor receives a contiguous run of patch indices with
+	///		approximately equal numbers of interior nodes.
 	///	</summary>
 	void DistributePatches();
 
+	///	<summary>
+	///		Redistribute patches among processors using the measured cost
+	///		of each patch, migrating patch data between processors and
+	///		rebuilding the exchange buffers.  The cost of each active
+	///		patch is its measured compute time plus a share of the
+	///		remaining compute time on its processor (lComputeTime) in
+	///		proportion to its number of interior nodes.  Returns true if
+	///		any patches were migrated.
+	///	</summary>
+	bool RebalancePatches(
+		unsigned long lComputeTime
+	);
+
+	///	<summary>
+	///		Partition a sequence of weighted items into nParts contiguous
+	///		runs of approximately equal total weight.  Run k covers items
+	///		vecPartBegin[k] through vecPartBegin[k+1]-1.  Each run is
+	///		non-empty whenever there are at least nParts items.
+	///	</summary>
+	static void PartitionContiguous(
+		const std::vector<long> & vecWeight,
+		int nParts,
+		std::vector<int> & vecPartBegin
+	);
+
 protected:
 	///	<summary>
 	///		Register an ExchangeBuffer.
@@ -539,7 +685,7 @@ public:
 	///	<summary>
 	///		Initialize connectivity between patches.
 	///	</summary>
-	void InitializeConnectivity();
+	virtual void InitializeConnectivity();
 
 public:
 	///	<summary>
@@ -931,6 +1077,16 @@ protected:
 	///	</summary>
 	ExchangeBufferRegistry m_aExchangeBufferRegistry;
 
+	///	<summary>
+	///		Communication statistics of exchanges.
+	///	</summary>
+	ExchangeStatistics m_exstat;
+
+	///	<summary>
+	///		Counters of the exchange in progress, set by BeginExchange().
+	///	</summary>
+	ExchangeCounters * m_pExchangeCounters;
+
 protected:
 	///	<summary>
 	///		DataContainer for Grid parameters.
@@ -93,55 +93,120 @@ void GridCSGLL::ApplyDefaultPatchLayout(
 	int nPatchCount
 ) {
 
+	// Verify patch count is positive
+	if (nPatchCount < 1) {
+		_EXCEPTIONT("nPatchCount must be a positive integer");
+	}
+
 	// Verify no Patches have been previously added
 	if (m_nInitializedPatchBoxes != 0) {
 		_EXCEPTIONT("ApplyDefaultPatchLayout() must be called on an empty Grid");
 	}
 
-	int nProcsPerDirection = Max((int)ISqrt(nPatchCount / 6), 1);
+	const int nResolution = GetABaseResolution();
+
+	const long lTotalElements =
+		6 * static_cast<long>(nResolution) * static_cast<long>(nResolution);
+
+	if (static_cast<long>(nPatchCount) > lTotalElements) {
+		_EXCEPTION2("nPatchCount (%i) exceeds the number of elements (%li)",
+			nPatchCount, lTotalElements);
+	}
 
-	int nProcsPerPanel = nProcsPerDirection * nProcsPerDirection;
+	// Each panel is divided into bands of rows of elements, with the
+	// band height chosen so that each partition is approximately square.
+	// For 6 k^2 partitions with resolution divisible by k this recovers
+	// the uniform k x k layout on each panel.
+	double dElementsPerPartition =
+		static_cast<double>(lTotalElements)
+		/ static_cast<double>(nPatchCount);
 
-	int nDistributedPatches = 6 * nProcsPerPanel;
+	int nBands = static_cast<int>(
+		static_cast<double>(nResolution) / sqrt(dElementsPerPartition) + 0.5);
 
-	if (nDistributedPatches < nPatchCount) {
-		Announce("WARNING: Patch / thread mismatch: "
-			"%i threads will be unutilized",
-			nPatchCount - nDistributedPatches);
+	if (nBands < 1) {
+		nBands = 1;
 	}
+	if (nBands > nResolution) {
+		nBands = nResolution;
+	}
+
+	// Each partition adds one patch for every band boundary it crosses
+	ReservePatchBoxes(nPatchCount + 6 * nBands);
 
-	// Determine arrangement of elements on processors
-	if (GetABaseResolution() % nProcsPerDirection != 0) {
-		_EXCEPTIONT("\n(UNIMPLEMENTED) Currently elements must be "
-			"equally divided among processors.");
+	DataArray1D<int> iBandBegin(nBands + 1);
+	for (int k = 0; k <= nBands; k++) {
+		iBandBegin[k] = (k * nResolution) / nBands;
 	}
 
-	int nElementsPerDirection = GetABaseResolution() / nProcsPerDirection;
-	DataArray1D<int> iBoxBegin(nProcsPerDirection + 1);
+	// Panels are visited along a chain in which consecutive panels share
+	// an edge, with the bands on each panel visited from bottom to top or
+	// top to bottom so that most transitions between panels are local.
+	// Each band is traversed one column of elements at a time, in
+	// alternating directions, giving a space-filling curve over the sphere.
+	const int nPanelChain[6] = {4, 0, 1, 2, 3, 5};
+	const bool fPanelBandsReversed[6] = {true, true, false, true, false, false};
 
-	iBoxBegin[0] = 0;
-	for (int n = 1; n < nProcsPerDirection; n++) {
-		iBoxBegin[n] = n * nElementsPerDirection;
+	int nColumns = 6 * nBands * nResolution;
+
+	std::vector<long> vecColumnWeight(nColumns);
+	for (int n = 0; n < 6; n++) {
+	for (int k = 0; k < nBands; k++) {
+	for (int a = 0; a < nResolution; a++) {
+		int ixColumn = (n * nBands + k) * nResolution + a;
+		vecColumnWeight[ixColumn] = iBandBegin[k+1] - iBandBegin[k];
 	}
-	iBoxBegin[nProcsPerDirection] = GetABaseResolution();
+	}
+	}
+
+	// Divide the curve into partitions of equal numbers of elements
+	std::vector<int> vecPartBegin;
+	PartitionContiguous(vecColumnWeight, nPatchCount, vecPartBegin);
 
-	// Create master patch for each panel
+	// Each partition is split into one rectangular patch for every band
+	// it intersects.  Patches are numbered along the curve so that
+	// DistributePatches() recovers the same partitions.
 	int ixPatch = 0;
 
-	for (int n = 0; n < 6; n++) {
-	for (int i = 0; i < nProcsPerDirection; i++) {
-	for (int j = 0; j < nProcsPerDirection; j++) {
+	for (int p = 0; p < nPatchCount; p++) {
+		int ixColumn = vecPartBegin[p];
 
-		m_aPatchBoxes[ixPatch] = PatchBox(
-			n, 0, m_model.GetHaloElements(),
-			m_nHorizontalOrder * iBoxBegin[i],
-			m_nHorizontalOrder * iBoxBegin[i+1],
-			m_nHorizontalOrder * iBoxBegin[j],
-			m_nHorizontalOrder * iBoxBegin[j+1]);
+		while (ixColumn < vecPartBegin[p+1]) {
+			int ixBand = ixColumn / nResolution;
+			int ixBandEnd = Min((ixBand + 1) * nResolution, vecPartBegin[p+1]);
 
-		ixPatch++;
-	}
-	}
+			int n = nPanelChain[ixBand / nBands];
+			int k = ixBand % nBands;
+			if (fPanelBandsReversed[ixBand / nBands]) {
+				k = nBands - 1 - k;
+			}
+
+			// Column range of this patch within the band
+			int iBegin = ixColumn - ixBand * nResolution;
+			int iEnd = ixBandEnd - ixBand * nResolution;
+
+			if ((ixBand % 2) == 1) {
+				int iTemp = nResolution - iEnd;
+				iEnd = nResolution - iBegin;
+				iBegin = iTemp;
+			}
+
+			if (ixPatch >= m_aPatchBoxes.GetRows()) {
+				_EXCEPTION1("Default patch layout requires more than "
+					"nMaxPatchCount (%i) patches", m_aPatchBoxes.GetRows());
+			}
+
+			m_aPatchBoxes[ixPatch] = PatchBox(
+				n, 0, m_model.GetHaloElements(),
+				m_nHorizontalOrder * iBegin,
+				m_nHorizontalOrder * iEnd,
+				m_nHorizontalOrder * iBandBegin[k],
+				m_nHorizontalOrder * iBandBegin[k+1]);
+
+			ixPatch++;
+
+			ixColumn = ixBandEnd;
+		}
 	}
 
 	m_nInitializedPatchBoxes = ixPatch;
@@ -150,10 +215,9 @@ void GridCSGLL::ApplyDefaultPatchLayout(
 ///////////////////////////////////////////////////////////////////////////////
 
 GridPatch * GridCSGLL::NewPatch(
-	int ixPatch
+	int ixPatch,
+	const PatchBox & box
 ) {
-	const PatchBox & box = GetPatchBox(ixPatch);
-
 	return (
 		new GridPatchCSGLL(
 			(*this),
@@ -432,12 +496,143 @@ void GridCSGLL::GetOpposingDirection(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void GridCSGLL::ApplyDSS(
+void GridCSGLL::InitializeConnectivity() {
+
+	// Allocate all ExchangeBuffers
+	Grid::InitializeConnectivity();
+
+	// Shared nodes for the direct stiffness summation
+	InitializeDSSNodeGroups();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridCSGLL::InitializeDSSNodeGroups() {
+
+	m_vecDSSNodeGroups.clear();
+	m_vecDSSNodeGroups.resize(GetActivePatchCount());
+
+	for (int n = 0; n < GetActivePatchCount(); n++) {
+		GridPatchCSGLL * pPatch =
+			dynamic_cast<GridPatchCSGLL*>(GetActivePatch(n));
+
+		const PatchBox & box = pPatch->GetPatchBox();
+
+		DSSNodeGroups & groups = m_vecDSSNodeGroups[n];
+
+		// Patch-specific quantities
+		const int nElementCountA = pPatch->GetElementCountA();
+		const int nElementCountB = pPatch->GetElementCountB();
+
+		const int nHaloElements = box.GetHaloElements();
+		const int nBTotalWidth = box.GetBTotalWidth();
+
+		// Cubed-sphere corners are nodes of connectivity 3
+		const bool fTopRightCorner =
+			(pPatch->GetNeighborPanel(Direction_TopRight) == InvalidPanel);
+		const bool fTopLeftCorner =
+			(pPatch->GetNeighborPanel(Direction_TopLeft) == InvalidPanel);
+		const bool fBottomLeftCorner =
+			(pPatch->GetNeighborPanel(Direction_BottomLeft) == InvalidPanel);
+		const bool fBottomRightCorner =
+			(pPatch->GetNeighborPanel(Direction_BottomRight) == InvalidPanel);
+
+		// Element edges in the alpha direction, including patch edges.  The
+		// nodes iA-1 and iA on either side of each edge coincide.
+		for (int a = 0; a <= nElementCountA; a++) {
+			const int iA = a * m_nHorizontalOrder + nHaloElements;
+
+			// Nodes along the edge, away from element corners
+			for (int b = 0; b < nElementCountB; b++) {
+				const int iB = b * m_nHorizontalOrder + nHaloElements;
+
+				for (int j = iB+1; j < iB+m_nHorizontalOrder-1; j++) {
+					groups.vecPairs.push_back(iA * nBTotalWidth + j);
+					groups.vecPairs.push_back((iA-1) * nBTotalWidth + j);
+				}
+			}
+
+			// Element corners
+			for (int b = 0; b <= nElementCountB; b++) {
+				const int iB = b * m_nHorizontalOrder + nHaloElements;
+
+				int iCornerA = (-1);
+				int iCornerB = (-1);
+				int iOffsetA = 0;
+				int iOffsetB = 0;
+
+				if ((a == 0) && (b == 0) && fBottomLeftCorner) {
+					iCornerA = iA;
+					iCornerB = iB;
+					iOffsetA = -1;
+					iOffsetB = -1;
+				}
+				if ((a == nElementCountA) && (b == 0) && fBottomRightCorner) {
+					iCornerA = iA-1;
+					iCornerB = iB;
+					iOffsetA = +1;
+					iOffsetB = -1;
+				}
+				if ((a == 0) && (b == nElementCountB) && fTopLeftCorner) {
+					iCornerA = iA;
+					iCornerB = iB-1;
+					iOffsetA = -1;
+					iOffsetB = +1;
+				}
+				if ((a == nElementCountA) && (b == nElementCountB)
+					&& fTopRightCorner
+				) {
+					iCornerA = iA-1;
+					iCornerB = iB-1;
+					iOffsetA = +1;
+					iOffsetB = +1;
+				}
+
+				if (iCornerA != (-1)) {
+					groups.vecTriples.push_back(
+						iCornerA * nBTotalWidth + iCornerB);
+					groups.vecTriples.push_back(
+						(iCornerA + iOffsetA) * nBTotalWidth + iCornerB);
+					groups.vecTriples.push_back(
+						iCornerA * nBTotalWidth + iCornerB + iOffsetB);
+
+				} else {
+					groups.vecQuads.push_back(iA * nBTotalWidth + iB-1);
+					groups.vecQuads.push_back((iA-1) * nBTotalWidth + iB-1);
+					groups.vecQuads.push_back(iA * nBTotalWidth + iB);
+					groups.vecQuads.push_back((iA-1) * nBTotalWidth + iB);
+				}
+			}
+		}
+
+		// Element edges in the beta direction, away from element corners
+		for (int b = 0; b <= nElementCountB; b++) {
+			const int iB = b * m_nHorizontalOrder + nHaloElements;
+
+			for (int a = 0; a < nElementCountA; a++) {
+				const int iA = a * m_nHorizontalOrder + nHaloElements;
+
+				for (int i = iA+1; i < iA+m_nHorizontalOrder-1; i++) {
+					groups.vecPairs.push_back(i * nBTotalWidth + iB);
+					groups.vecPairs.push_back(i * nBTotalWidth + iB-1);
+				}
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridCSGLL::EndDSS(
 	int iDataUpdate,
 	DataType eDataType
 ) {
-	// Exchange data between nodes
-	Exchange(eDataType, iDataUpdate);
+	// Complete exchange of data between nodes
+	EndExchange(eDataType, iDataUpdate);
+
+	if (m_vecDSSNodeGroups.size() != GetActivePatchCount()) {
+		_EXCEPTIONT("DSS node groups not initialized");
+	}
 
 	// Post-process velocities across panel edges and
 	// perform direct stiffness summation (DSS)
@@ -445,42 +640,20 @@ void GridCSGLL::ApplyDSS(
 		GridPatchCSGLL * pPatch =
 			dynamic_cast<GridPatchCSGLL*>(GetActivePatch(n));
 
-		const PatchBox & box = pPatch->GetPatchBox();
-	
-	// Patch-specific quantities
-		const int nElementCountA = pPatch->GetElementCountA();
-		const int nElementCountB = pPatch->GetElementCountB();
-	
+		const DSSNodeGroups & groups = m_vecDSSNodeGroups[n];
+
+		const int nPairs = groups.vecPairs.size() / 2;
+		const int nTriples = groups.vecTriples.size() / 3;
+		const int nQuads = groups.vecQuads.size() / 4;
+
 		// Apply panel transforms to velocity data
 		if (eDataType == DataType_State) {
 			pPatch->TransformHaloVelocities(iDataUpdate);
 		}
 		if (eDataType == DataType_TopographyDeriv) {
 			pPatch->TransformTopographyDeriv();
-
-			const DataArray3D<double> & dataTopographyDeriv =
-				pPatch->GetTopographyDeriv();
 		}
 
-		// Panels in each coordinate direction
-		const int ixRightPanel =
-			pPatch->GetNeighborPanel(Direction_Right);
-		const int ixTopPanel =
-			pPatch->GetNeighborPanel(Direction_Top);
-		const int ixLeftPanel =
-			pPatch->GetNeighborPanel(Direction_Left);
-		const int ixBottomPanel =
-			pPatch->GetNeighborPanel(Direction_Bottom);
-
-		const int ixTopRightPanel =
-			pPatch->GetNeighborPanel(Direction_TopRight);
-		const int ixTopLeftPanel =
-			pPatch->GetNeighborPanel(Direction_TopLeft);
-		const int ixBottomLeftPanel =
-			pPatch->GetNeighborPanel(Direction_BottomLeft);
-		const int ixBottomRightPanel =
-			pPatch->GetNeighborPanel(Direction_BottomRight);
-
 		// Loop through all components associated with this DataType
 		int nComponents;
 		if (eDataType == DataType_State) {
@@ -500,282 +673,105 @@ void GridCSGLL::ApplyDSS(
 		// Perform Direct Stiffness Summation (DSS)
 		for (int c = 0; c < nComponents; c++) {
 
-			// Obtain the array of working data
+			// Obtain the working data
 			int nRElements = GetRElements();
 
-			DataArray3D<double> pDataUpdate;
-
-			if ((eDataType == DataType_State) &&
-				(GetVarLocation(c) == DataLocation_REdge)
-			) {
-				nRElements++;
-			}
-			if (eDataType == DataType_TopographyDeriv) {
-				nRElements = 2;
-			}
-
-			pDataUpdate.SetSize(
-				box.GetATotalWidth(),
-				box.GetBTotalWidth(),
-				nRElements);
+			double * pData = NULL;
 
 			// State data
 			if (eDataType == DataType_State) {
+				if (GetVarLocation(c) == DataLocation_REdge) {
+					nRElements++;
+				}
+
 				DataArray4D<double> & dState =
 					pPatch->GetDataState(iDataUpdate, GetVarLocation(c));
 
-				pDataUpdate.AttachToData(&(dState(c,0,0,0)));
+				pData = &(dState(c,0,0,0));
 
 			// Tracer data
 			} else if (eDataType == DataType_Tracers) {
 				DataArray4D<double> & dTracers =
 					pPatch->GetDataTracers(iDataUpdate);
 
-				pDataUpdate.AttachToData(&(dTracers(c,0,0,0)));
+				pData = &(dTracers(c,0,0,0));
 
 			// Vorticity data
 			} else if (eDataType == DataType_Vorticity) {
 				DataArray3D<double> & dVorticity =
 					pPatch->GetDataVorticity();
 
-				pDataUpdate.AttachToData(&(dVorticity(0,0,0)));
+				pData = &(dVorticity(0,0,0));
 
 			// Divergence data
 			} else if (eDataType == DataType_Divergence) {
 				DataArray3D<double> & dDivergence =
 					pPatch->GetDataDivergence();
 
-				pDataUpdate.AttachToData(&(dDivergence(0,0,0)));
+				pData = &(dDivergence(0,0,0));
 
 			// Topographic derivative data
 			} else if (eDataType == DataType_TopographyDeriv) {
+				nRElements = 2;
+
 				DataArray3D<double> & dTopographyDeriv =
 					pPatch->GetTopographyDeriv();
 
-				pDataUpdate.AttachToData(&(dTopographyDeriv(0,0,0)));
-			}
-
-			/// start of loop nest 1
-
-			// Average in the alpha direction (patch interior)
-			{
-				const int jBegin = box.GetBInteriorBegin()-1;
-				const int jEnd = box.GetBInteriorEnd()+1;
-
-				// Perform averaging across edge
-				for (int a = 1; a < nElementCountA; a++) {
-					const int iA = a * m_nHorizontalOrder + box.GetHaloElements();
-				    for (int j = jBegin; j < jEnd; j++) {
-#pragma simd
-						for (int k = 0; k < nRElements; k++) {
-						    pDataUpdate(iA,j,k) = 0.5 * (
-								pDataUpdate(iA,j,k)
-								+ pDataUpdate(iA-1,j,k));
-
-						    pDataUpdate(iA-1,j,k) =
-								pDataUpdate(iA,j,k);
-						}
-				    }
-				}
-			}
-
-			// Average in the alpha direction (left edge of patch)
-			{
-				const int iA = box.GetHaloElements();
-
-				// Do not average across cubed-sphere corners
-				int jBegin = box.GetBInteriorBegin()-1;
-				int jEnd = box.GetBInteriorEnd()+1;
-
-				if (ixTopLeftPanel  == InvalidPanel) {
-					jEnd -= 2;
-				}
-				if (ixBottomLeftPanel == InvalidPanel) {
-					jBegin += 2;
-				}
-
-				// Perform averaging across edge
-				for (int j = jBegin; j < jEnd; j++) {
-#pragma simd
-				    for (int k = 0; k < nRElements; k++) {
-						pDataUpdate(iA,j,k) = 0.5 * (
-							pDataUpdate(iA,j,k)
-							+ pDataUpdate(iA-1,j,k));
-
-						pDataUpdate(iA-1,j,k) =
-							pDataUpdate(iA,j,k);
-					}
-				}
-			}
-
-			// Average in the alpha direction (right edge of patch)
-			{
-				const int iA =
-					nElementCountA * m_nHorizontalOrder
-					+ box.GetHaloElements();
-
-				// Do not average across cubed-sphere corners
-				int jBegin = box.GetBInteriorBegin()-1;
-				int jEnd = box.GetBInteriorEnd()+1;
-
-				if (ixTopRightPanel == InvalidPanel) {
-					jEnd -= 2;
-				}
-				if (ixBottomRightPanel == InvalidPanel) {
-					jBegin += 2;
-				}
-
-			    // Perform averaging across edge
-				for (int j = jBegin; j < jEnd; j++) {
-#pragma simd
-				    for (int k = 0; k < nRElements; k++) {
-						pDataUpdate(iA,j,k) = 0.5 * (
-							pDataUpdate(iA,j,k)
-							+ pDataUpdate(iA-1,j,k));
-
-						pDataUpdate(iA-1,j,k) =
-							pDataUpdate(iA,j,k);
-					}
-				}
-			}
-			/// end of loop 1
-
-			/// start of loop nest 2
-
-			// Average in the beta direction (patch interior)
-			{
-				const int iBegin = box.GetAInteriorBegin()-1;
-				const int iEnd = box.GetAInteriorEnd()+1;
-				for (int b = 1; b < nElementCountB; b++) {
-					int iB = b * m_nHorizontalOrder + box.GetHaloElements();
-
-					for (int i = iBegin; i < iEnd; i++) {
-#pragma simd
-						for (int k = 0; k < nRElements; k++) {
-							pDataUpdate(i,iB,k) = 0.5 * (
-								pDataUpdate(i,iB,k)
-								+ pDataUpdate(i,iB-1,k));
-
-							pDataUpdate(i,iB-1,k) =
-								pDataUpdate(i,iB,k);
-						}
-					}
-				}
-			}
-
-			// Average in the beta direction (bottom edge of patch)
-			{
-				const int iB = box.GetHaloElements();
-
-				int iBegin = box.GetAInteriorBegin()-1;
-				int iEnd = box.GetAInteriorEnd()+1;
-
-				if (ixBottomLeftPanel == InvalidPanel) {
-					iBegin += 2;
-				}
-				if (ixBottomRightPanel == InvalidPanel) {
-					iEnd -= 2;
-				}
-
-				for (int i = iBegin; i < iEnd; i++) {
-#pragma simd
-					for (int k = 0; k < nRElements; k++) {
-						pDataUpdate(i,iB,k) = 0.5 * (
-							pDataUpdate(i,iB,k)
-							+ pDataUpdate(i,iB-1,k));
-						pDataUpdate(i,iB-1,k) =
-							pDataUpdate(i,iB,k);
-					}
-				}
-			}
-
-			// Average in the beta direction (top edge of patch)
-			{
-				const int iB =
-					nElementCountB * m_nHorizontalOrder
-					+ box.GetHaloElements();
-
-				int iBegin = box.GetAInteriorBegin()-1;
-				int iEnd = box.GetAInteriorEnd()+1;
-
-				if (ixTopLeftPanel == InvalidPanel) {
-					iBegin += 2;
-				}
-				if (ixTopRightPanel == InvalidPanel) {
-					iEnd -= 2;
-				}
-
-				for (int i = iBegin; i < iEnd; i++) {
-#pragma simd
-					for (int k = 0; k < nRElements; k++) {
-						pDataUpdate(i,iB,k) = 0.5 * (
-							pDataUpdate(i,iB,k)
-							+ pDataUpdate(i,iB-1,k));
-
-						pDataUpdate(i,iB-1,k) =
-							pDataUpdate(i,iB,k);
-					}
-				}
-			}
-
-			/// end of loop 2
-
-			/// start of loop nest 3
-
-			// Handle patch corners that are coincident with panel corners.
-			// These are also nodes of connectivity 3.
-			if (ixTopRightPanel == InvalidPanel) {
-				const int iA = box.GetAInteriorEnd()-1;
-				const int iB = box.GetBInteriorEnd()-1;
-
-#pragma simd
-				for (int k = 0; k < nRElements; k++) {
-					pDataUpdate(iA,iB,k) = (1.0/3.0) * (
-						+ pDataUpdate(iA  ,iB  ,k)
-						+ pDataUpdate(iA+1,iB  ,k)
-						+ pDataUpdate(iA  ,iB+1,k));
-				}
+				pData = &(dTopographyDeriv(0,0,0));
 			}
 
-			if (ixTopLeftPanel == InvalidPanel) {
-				const int iA = box.GetAInteriorBegin();
-				const int iB = box.GetBInteriorEnd()-1;
+			// Average across element edges
+			for (int g = 0; g < nPairs; g++) {
+				double * pNode0 = pData + groups.vecPairs[2*g  ] * nRElements;
+				double * pNode1 = pData + groups.vecPairs[2*g+1] * nRElements;
 
 #pragma simd
 				for (int k = 0; k < nRElements; k++) {
-					pDataUpdate(iA,iB,k) = (1.0/3.0) * (
-						+ pDataUpdate(iA  ,iB  ,k)
-						+ pDataUpdate(iA-1,iB  ,k)
-						+ pDataUpdate(iA  ,iB+1,k));
+					const double dAvg = 0.5 * (pNode0[k] + pNode1[k]);
+					pNode0[k] = dAvg;
+					pNode1[k] = dAvg;
 				}
 			}
 
-			if (ixBottomLeftPanel == InvalidPanel) {
-				const int iA = box.GetAInteriorBegin();
-				const int iB = box.GetBInteriorBegin();
+			// Average at element corners, as the average of the two
+			// averages across the alpha edge
+			for (int g = 0; g < nQuads; g++) {
+				double * pNode0 = pData + groups.vecQuads[4*g  ] * nRElements;
+				double * pNode1 = pData + groups.vecQuads[4*g+1] * nRElements;
+				double * pNode2 = pData + groups.vecQuads[4*g+2] * nRElements;
+				double * pNode3 = pData + groups.vecQuads[4*g+3] * nRElements;
 
 #pragma simd
 				for (int k = 0; k < nRElements; k++) {
-					pDataUpdate(iA,iB,k) = (1.0/3.0) * (
-						+ pDataUpdate(iA  ,iB  ,k)
-						+ pDataUpdate(iA-1,iB  ,k)
-						+ pDataUpdate(iA  ,iB-1,k));
+					const double dAvg = 0.5 * (
+						  0.5 * (pNode2[k] + pNode3[k])
+						+ 0.5 * (pNode0[k] + pNode1[k]));
+
+					pNode0[k] = dAvg;
+					pNode1[k] = dAvg;
+					pNode2[k] = dAvg;
+					pNode3[k] = dAvg;
 				}
 			}
 
-			if (ixBottomRightPanel == InvalidPanel) {
-				const int iA = box.GetAInteriorEnd()-1;
-				const int iB = box.GetBInteriorBegin();
+			// Average at cubed-sphere corners
+			for (int g = 0; g < nTriples; g++) {
+				double * pNode0 = pData + groups.vecTriples[3*g  ] * nRElements;
+				double * pNode1 = pData + groups.vecTriples[3*g+1] * nRElements;
+				double * pNode2 = pData + groups.vecTriples[3*g+2] * nRElements;
 
 #pragma simd
 				for (int k = 0; k < nRElements; k++) {
-					pDataUpdate(iA,iB,k) = (1.0/3.0) * (
-						+ pDataUpdate(iA  ,iB  ,k)
-						+ pDataUpdate(iA+1,iB  ,k)
-						+ pDataUpdate(iA  ,iB-1,k));
+					const double dAvg = (1.0/3.0) * (
+						+ pNode0[k]
+						+ pNode1[k]
+						+ pNode2[k]);
+
+					pNode0[k] = dAvg;
+					pNode1[k] = dAvg;
+					pNode2[k] = dAvg;
 				}
 			}
-			/// end of loop 3
 		}
 	}
 }
@@ -19,6 +19,8 @@
 
 #include "GridGLL.h"
 
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////
 
 ///	<summary>
@@ -56,7 +58,10 @@ public:
 
 public:
 	///	<summary>
-	///		Build the default patch layout.
+	///		Build the default patch layout.  The cubed-sphere is divided
+	///		along a space-filling curve into nPatchCount partitions with
+	///		equal numbers of elements (to within one column of a band),
+	///		each made up of one or more rectangular patches.
 	///	</summary>
 	virtual void ApplyDefaultPatchLayout(
 		int nPatchCount
@@ -66,7 +71,8 @@ public:
 	///		Return a pointer to a new GridPatchCSGLL.
 	///	</summary>
 	virtual GridPatch * NewPatch(
-		int ixPatch
+		int ixPatch,
+		const PatchBox & box
 	);
 
 	///	<summary>
@@ -118,12 +124,47 @@ public:
 
 public:
 	///	<summary>
-	///		Apply the direct stiffness summation (DSS) operation on the grid.
+	///		Initialize connectivity between patches and build the lists of
+	///		shared nodes used by the direct stiffness summation.
+	///	</summary>
+	virtual void InitializeConnectivity();
+
+	///	<summary>
+	///		Complete the direct stiffness summation (DSS) operation on the
+	///		grid once halo data has been received.  Nodes on patch edges
+	///		are summed with their copies in the halo, so every neighboring
+	///		patch, including those on the same rank, must have completed
+	///		its halo exchange.
 	///	</summary>
-	virtual void ApplyDSS(
+	virtual void EndDSS(
 		int iDataUpdate,
 		DataType eDataType = DataType_State
 	);
+
+protected:
+	///	<summary>
+	///		Build the lists of shared nodes on each active GridPatch.
+	///	</summary>
+	void InitializeDSSNodeGroups();
+
+protected:
+	///	<summary>
+	///		Nodes of a GridPatch that are shared between elements, grouped
+	///		by multiplicity.  Each entry is a 2D node offset (iA * width + iB)
+	///		into the patch, including the first ring of halo nodes.  Triples
+	///		occur only at cubed-sphere corners and list the interior corner
+	///		node first.
+	///	</summary>
+	struct DSSNodeGroups {
+		std::vector<int> vecPairs;
+		std::vector<int> vecTriples;
+		std::vector<int> vecQuads;
+	};
+
+	///	<summary>
+	///		Shared node groups of each active GridPatch.
+	///	</summary>
+	std::vector<DSSNodeGroups> m_vecDSSNodeGroups;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -210,6 +210,8 @@ void GridCartesianGLL::ApplyDefaultPatchLayout(
 	}
 */
 	// Create master patch for each panel
+	ReservePatchBoxes(nProcsADirection * nProcsBDirection);
+
 	int ixPatch = 0;
 
 	for (int i = 0; i < nProcsADirection; i++) {
@@ -232,10 +234,9 @@ void GridCartesianGLL::ApplyDefaultPatchLayout(
 ///////////////////////////////////////////////////////////////////////////////
 
 GridPatch * GridCartesianGLL::NewPatch(
-	int ixPatch
+	int ixPatch,
+	const PatchBox & box
 ) {
-	const PatchBox & box = GetPatchBox(ixPatch);
-
 	return (
 		new GridPatchCartesianGLL(
 			(*this),
@@ -505,12 +506,12 @@ void GridCartesianGLL::GetOpposingDirection(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void GridCartesianGLL::ApplyDSS(
+void GridCartesianGLL::EndDSS(
 	int iDataUpdate,
 	DataType eDataType
 ) {
-	// Exchange data between nodes
-	Exchange(eDataType, iDataUpdate);
+	// Complete exchange of data between nodes
+	EndExchange(eDataType, iDataUpdate);
 
 	// Post-process velocities across panel edges and
 	// perform direct stiffness summation (DSS)
@@ -81,7 +81,8 @@ public:
 	///		Return a pointer to a new GridPatchCartesianGLL.
 	///	</summary>
 	virtual GridPatch * NewPatch(
-		int ixPatch
+		int ixPatch,
+		const PatchBox & box
 	);
 
 	///	<summary>
@@ -131,9 +132,10 @@ public:
 	);
 
 	///	<summary>
-	///		Apply the direct stiffness summation (DSS) operation on the grid.
+	///		Complete the direct stiffness summation (DSS) operation on the
+	///		grid once halo data has been received.
 	///	</summary>
-	virtual void ApplyDSS(
+	virtual void EndDSS(
 		int iDataUpdate,
 		DataType eDataType = DataType_State
 	);
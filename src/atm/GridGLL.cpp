@@ -584,6 +584,36 @@ void GridGLL::PostProcessSubstage(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void GridGLL::BeginPostProcessSubstage(
+	int iDataUpdate,
+	DataType eDataType
+) {
+	// Block parallel exchanges
+	if (m_fBlockParallelExchange) {
+		return;
+	}
+
+	// Send data for Direct Stiffness Summation
+	BeginDSS(iDataUpdate, eDataType);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridGLL::EndPostProcessSubstage(
+	int iDataUpdate,
+	DataType eDataType
+) {
+	// Block parallel exchanges
+	if (m_fBlockParallelExchange) {
+		return;
+	}
+
+	// Complete Direct Stiffness Summation
+	EndDSS(iDataUpdate, eDataType);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridGLL::ComputeVorticityDivergence(
 	int iDataIndex
 ) {
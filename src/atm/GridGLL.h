@@ -89,10 +89,51 @@ public:
 		DataType eDataType = DataType_State
 	);
 
+	///	<summary>
+	///		Begin post-processing of variables on the grid after each
+	///		TimeStep substage by sending data on the patch edge.
+	///	</summary>
+	virtual void BeginPostProcessSubstage(
+		int iDataUpdate,
+		DataType eDataType = DataType_State
+	);
+
+	///	<summary>
+	///		Complete post-processing of variables on the grid after each
+	///		TimeStep substage.
+	///	</summary>
+	virtual void EndPostProcessSubstage(
+		int iDataUpdate,
+		DataType eDataType = DataType_State
+	);
+
 	///	<summary>
 	///		Apply the direct stiffness summation (DSS) operation on the grid.
 	///	</summary>
-	virtual void ApplyDSS(
+	void ApplyDSS(
+		int iDataUpdate,
+		DataType eDataType = DataType_State
+	) {
+		BeginDSS(iDataUpdate, eDataType);
+		EndDSS(iDataUpdate, eDataType);
+	}
+
+	///	<summary>
+	///		Begin the direct stiffness summation (DSS) operation on the grid
+	///		by sending data on the patch edge to neighboring patches.
+	///	</summary>
+	virtual void BeginDSS(
+		int iDataUpdate,
+		DataType eDataType = DataType_State
+	) {
+		BeginExchange(eDataType, iDataUpdate);
+	}
+
+	///	<summary>
+	///		Complete the direct stiffness summation (DSS) operation on the
+	///		grid once halo data has been received.
+	///	</summary>
+	virtual void EndDSS(
 		int iDataUpdate,
 		DataType eDataType = DataType_State
 	) {
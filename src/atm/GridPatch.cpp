@@ -20,6 +20,9 @@
 #include "EquationSet.h"
 #include "Defines.h"
 
+#include <algorithm>
+#include <cstring>
+
 #ifdef TEMPEST_MPIOMP
 #include <mpi.h>
 #endif
@@ -35,7 +38,8 @@ GridPatch::GridPatch(
 	m_ixPatch(ixPatch),
 	m_iProcessor(0),
 	m_box(box),
-	m_fContainsData(false)
+	m_fContainsData(false),
+	m_lComputeTime(0)
 {
 }
 
@@ -481,8 +485,126 @@ void GridPatch::InitializeDataLocal(
 
 #pragma message "Remove these two lines?"
 	// Mark Patch index
-	m_iGeometricPatchIx[0] = m_ixPatch;
-	m_iActiveStatePatchIx[0] = m_ixPatch;
+	if (fAllocateGeometric) {
+		m_iGeometricPatchIx[0] = m_ixPatch;
+	}
+	if (fAllocateActiveState) {
+		m_iActiveStatePatchIx[0] = m_ixPatch;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Copy a range of nodes between two arrays with leading dimensions
+///		(alpha, beta).  Each node stores nNodeSize contiguous values.
+///	</summary>
+static void CopyNodeRange(
+	const double * dSrc,
+	double * dDst,
+	int nSrcBWidth,
+	int nDstBWidth,
+	int iSrcA,
+	int iSrcB,
+	int iDstA,
+	int iDstB,
+	int nAWidth,
+	int nBWidth,
+	size_t sNodeSize
+) {
+	for (int i = 0; i < nAWidth; i++) {
+		memcpy(
+			dDst + ((iDstA + i) * nDstBWidth + iDstB) * sNodeSize,
+			dSrc + ((iSrcA + i) * nSrcBWidth + iSrcB) * sNodeSize,
+			nBWidth * sNodeSize * sizeof(double));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridPatch::CopyNodeData(
+	const GridPatch & patchSrc,
+	bool fInteriorOnly
+) {
+	const PatchBox & boxSrc = patchSrc.m_box;
+
+	if (boxSrc.GetPanel() != m_box.GetPanel()) {
+		return;
+	}
+	if (boxSrc.GetRefinementLevel() != m_box.GetRefinementLevel()) {
+		_EXCEPTIONT("Cannot copy data between refinement levels");
+	}
+	if (!patchSrc.m_dcActiveState.IsAttached() ||
+	    !m_dcActiveState.IsAttached()
+	) {
+		_EXCEPTIONT("Active state data must be allocated");
+	}
+	if (patchSrc.m_dcActiveState.GetDataChunkCount() !=
+	    m_dcActiveState.GetDataChunkCount()
+	) {
+		_EXCEPTIONT("Active state data mismatch");
+	}
+
+	// Global index range of nodes to copy
+	int iABegin = boxSrc.GetAGlobalBegin();
+	int iAEnd = boxSrc.GetAGlobalEnd();
+	int iBBegin = boxSrc.GetBGlobalBegin();
+	int iBEnd = boxSrc.GetBGlobalEnd();
+
+	if (fInteriorOnly) {
+		iABegin = boxSrc.GetAGlobalInteriorBegin();
+		iAEnd = boxSrc.GetAGlobalInteriorEnd();
+		iBBegin = boxSrc.GetBGlobalInteriorBegin();
+		iBEnd = boxSrc.GetBGlobalInteriorEnd();
+	}
+
+	iABegin = std::max(iABegin, m_box.GetAGlobalBegin());
+	iAEnd = std::min(iAEnd, m_box.GetAGlobalEnd());
+	iBBegin = std::max(iBBegin, m_box.GetBGlobalBegin());
+	iBEnd = std::min(iBEnd, m_box.GetBGlobalEnd());
+
+	if ((iABegin >= iAEnd) || (iBBegin >= iBEnd)) {
+		return;
+	}
+
+	const int nAWidth = iAEnd - iABegin;
+	const int nBWidth = iBEnd - iBBegin;
+
+	const int iSrcA = iABegin - boxSrc.GetAGlobalBegin();
+	const int iSrcB = iBBegin - boxSrc.GetBGlobalBegin();
+	const int iDstA = iABegin - m_box.GetAGlobalBegin();
+	const int iDstB = iBBegin - m_box.GetBGlobalBegin();
+
+	const int nSrcBWidth = boxSrc.GetBTotalWidth();
+	const int nDstBWidth = m_box.GetBTotalWidth();
+
+	// All active state data arrays have leading dimensions
+	// (component, alpha, beta)
+	for (size_t n = 0; n < m_dcActiveState.GetDataChunkCount(); n++) {
+		const DataArray4D<double> * pDataSrc =
+			dynamic_cast<const DataArray4D<double> *>(
+				patchSrc.m_dcActiveState.GetDataChunk(n));
+		DataArray4D<double> * pDataDst =
+			dynamic_cast<DataArray4D<double> *>(
+				m_dcActiveState.GetDataChunk(n));
+
+		if ((pDataSrc == NULL) || (pDataDst == NULL)) {
+			continue;
+		}
+		if ((pDataSrc->GetSize(0) != pDataDst->GetSize(0)) ||
+		    (pDataSrc->GetSize(3) != pDataDst->GetSize(3))
+		) {
+			_EXCEPTIONT("Active state data mismatch");
+		}
+
+		for (int c = 0; c < pDataSrc->GetSize(0); c++) {
+			CopyNodeRange(
+				&((*pDataSrc)[c][0][0][0]), &((*pDataDst)[c][0][0][0]),
+				nSrcBWidth, nDstBWidth,
+				iSrcA, iSrcB, iDstA, iDstB, nAWidth, nBWidth,
+				pDataSrc->GetSize(3));
+		}
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1399,6 +1521,73 @@ void GridPatch::UnpackExchangeBuffer(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void GridPatch::CopyExchangeBuffer(
+	DataType eDataType,
+	int iDataIndex,
+	ExchangeBuffer & exbuf,
+	GridPatch & patchTarget
+) {
+	// Check exchange buffer source and target
+	if (exbuf.m_ixSourcePatch != m_ixPatch) {
+		_EXCEPTIONT("ExchangeBuffer patch index mismatch");
+	}
+	if ((exbuf.GetLocalTarget() == NULL) ||
+	    (exbuf.GetLocalTarget()->m_ixSourcePatch != patchTarget.m_ixPatch)
+	) {
+		_EXCEPTIONT("ExchangeBuffer target patch index mismatch");
+	}
+
+	// State data
+	if (eDataType == DataType_State) {
+		if ((iDataIndex < 0) || (iDataIndex > m_datavecStateNode.size())) {
+			_EXCEPTIONT("Invalid state data instance.");
+		}
+
+		exbuf.Copy(m_grid,
+			m_datavecStateNode[iDataIndex],
+			patchTarget.m_datavecStateNode[iDataIndex]);
+		exbuf.Copy(m_grid,
+			m_datavecStateREdge[iDataIndex],
+			patchTarget.m_datavecStateREdge[iDataIndex]);
+
+	// Tracer data
+	} else if (eDataType == DataType_Tracers) {
+		if ((iDataIndex < 0) || (iDataIndex > m_datavecTracers.size())) {
+			_EXCEPTIONT("Invalid tracers data instance.");
+		}
+
+		exbuf.Copy(m_grid,
+			m_datavecTracers[iDataIndex],
+			patchTarget.m_datavecTracers[iDataIndex]);
+
+	// Vorticity data
+	} else if (eDataType == DataType_Vorticity) {
+		exbuf.Copy(m_dataVorticity, patchTarget.m_dataVorticity);
+
+	// Divergence data
+	} else if (eDataType == DataType_Divergence) {
+		exbuf.Copy(m_dataDivergence, patchTarget.m_dataDivergence);
+
+	// Temperature data
+	} else if (eDataType == DataType_Temperature) {
+		exbuf.Copy(m_dataTemperature, patchTarget.m_dataTemperature);
+
+	// Richardson data
+	} else if (eDataType == DataType_Richardson) {
+		exbuf.Copy(m_dataRichardson, patchTarget.m_dataRichardson);
+
+	// Topography derivative data
+	} else if (eDataType == DataType_TopographyDeriv) {
+		exbuf.Copy(m_dataTopographyDeriv, patchTarget.m_dataTopographyDeriv);
+
+	// Invalid data
+	} else {
+		_EXCEPTIONT("Invalid DataType");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridPatch::CopyData(
 	int ixSource,
 	int ixDest,
@@ -1446,6 +1635,21 @@ void GridPatch::LinearCombineData(
 			ixDest, dCoeff.GetRows()-1);
 	}
 
+	// Nonzero terms other than the destination
+	std::vector<double> vecCoeff;
+
+	std::vector<int> vecIndex;
+	for (int m = 0; m < dCoeff.GetRows(); m++) {
+		if (m == ixDest) {
+			continue;
+		}
+		if (dCoeff[m] == 0.0) {
+			continue;
+		}
+		vecIndex.push_back(m);
+		vecCoeff.push_back(dCoeff[m]);
+	}
+
 	// Check bounds on ixDest for State data
 	if (eDataType == DataType_State) {
 		if ((ixDest < 0) || (ixDest >= m_datavecStateNode.size())) {
@@ -1455,29 +1659,18 @@ void GridPatch::LinearCombineData(
 			_EXCEPTIONT("Too many elements in coefficient vector.");
 		}
 
-		// Premultiply
-		if (dCoeff[ixDest] == 0.0) {
-			m_datavecStateNode [ixDest].Zero();
-			m_datavecStateREdge[ixDest].Zero();
-		} else {
-			m_datavecStateNode [ixDest].Scale(dCoeff[ixDest]);
-			m_datavecStateREdge[ixDest].Scale(dCoeff[ixDest]);
+		// Combine all terms in a single pass
+		std::vector<const DataArray4D<double> *> vecNode;
+		std::vector<const DataArray4D<double> *> vecREdge;
+		for (int t = 0; t < vecIndex.size(); t++) {
+			vecNode .push_back(&(m_datavecStateNode [vecIndex[t]]));
+			vecREdge.push_back(&(m_datavecStateREdge[vecIndex[t]]));
 		}
 
-		// Consider all other terms
-		for (int m = 0; m < dCoeff.GetRows(); m++) {
-			if (m == ixDest) {
-				continue;
-			}
-			if (dCoeff[m] == 0.0) {
-				continue;
-			}
-
-			m_datavecStateNode[ixDest].AddProduct(
-				m_datavecStateNode[m], dCoeff[m]);
-			m_datavecStateREdge[ixDest].AddProduct(
-				m_datavecStateREdge[m], dCoeff[m]);
-		}
+		m_datavecStateNode [ixDest].LinearCombine(
+			dCoeff[ixDest], vecNode, vecCoeff);
+		m_datavecStateREdge[ixDest].LinearCombine(
+			dCoeff[ixDest], vecREdge, vecCoeff);
 
 	// Check bounds on ixDest for Tracers data
 	} else if (eDataType == DataType_Tracers) {
@@ -1493,25 +1686,14 @@ void GridPatch::LinearCombineData(
 			return;
 		}
 
-		// Premultiply
-		if (dCoeff[ixDest] == 0.0) {
-			m_datavecTracers[ixDest].Zero();
-		} else {
-			m_datavecTracers[ixDest].Scale(dCoeff[ixDest]);
+		// Combine all terms in a single pass
+		std::vector<const DataArray4D<double> *> vecTracers;
+		for (int t = 0; t < vecIndex.size(); t++) {
+			vecTracers.push_back(&(m_datavecTracers[vecIndex[t]]));
 		}
 
-		// Consider all other terms
-		for (int m = 0; m < dCoeff.GetRows(); m++) {
-			if (m == ixDest) {
-				continue;
-			}
-			if (dCoeff[m] == 0.0) {
-				continue;
-			}
-
-			m_datavecTracers[ixDest].AddProduct(
-				m_datavecTracers[m], dCoeff[m]);
-		}
+		m_datavecTracers[ixDest].LinearCombine(
+			dCoeff[ixDest], vecTracers, vecCoeff);
 
 	// Invalid datatype; only State or Tracers expected
 	} else {
@@ -1584,12 +1766,21 @@ void GridPatch::AddReferenceState(
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void GridPatch::InterpolateData(
-	DataType eDataType,
-	const DataArray1D<double> & dREta,
+void GridPatch::InitializeInterpStencil(
 	const DataArray1D<double> & dAlpha,
 	const DataArray1D<double> & dBeta,
 	const DataArray1D<int> & iPatch,
+	PatchInterpStencil & stencil
+) const {
+	_EXCEPTIONT("Unimplemented.");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void GridPatch::InterpolateData(
+	DataType eDataType,
+	const DataArray1D<double> & dREta,
+	const PatchInterpStencil & stencil,
 	DataArray3D<double> & dInterpData,
 	DataLocation eOnlyVariablesAt,
 	bool fIncludeReferenceState,
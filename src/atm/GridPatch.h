@@ -27,6 +27,7 @@
 #include "ChecksumType.h"
 #include "DataContainer.h"
 #include "Connectivity.h"
+#include "InterpStencil.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -109,6 +110,17 @@ public:
 	///	</summary>
 	virtual void DeinitializeData();
 
+	///	<summary>
+	///		Copy active state data from another GridPatch on the same
+	///		panel over the nodes that both patches contain.  If
+	///		fInteriorOnly is true, only nodes in the interior of patchSrc
+	///		are copied.
+	///	</summary>
+	void CopyNodeData(
+		const GridPatch & patchSrc,
+		bool fInteriorOnly
+	);
+
 	///	<summary>
 	///		Initialize coordinate data on patch.
 	///	</summary>
@@ -192,6 +204,18 @@ public:
 	virtual void ComputeSurfacePressure(
 		int iDataIndex
 	);
+
+	///	<summary>
+	///		Compute the maximum horizontal Courant number on the GridPatch
+	///		for a time step of dDeltaT seconds, accounting for advection
+	///		and the fastest horizontally propagating wave.
+	///	</summary>
+	virtual double ComputeMaximumCourantNumber(
+		int iDataIndex,
+		double dDeltaT
+	) const {
+		_EXCEPTIONT("Unimplemented");
+	}
 /*
 	///	<summary>
 	///		Compute Richardson number on the GridPatch.
@@ -252,6 +276,17 @@ public:
 		ExchangeBuffer & exbuf
 	);
 
+	///	<summary>
+	///		Copy data sent through the ExchangeBuffer directly into the
+	///		halo of the target patch on this processor.
+	///	</summary>
+	void CopyExchangeBuffer(
+		DataType eDataType,
+		int iDataIndex,
+		ExchangeBuffer & exbuf,
+		GridPatch & patchTarget
+	);
+
 public:
 	///	<summary>
 	///		Copy data from one data index to another.
@@ -305,14 +340,24 @@ public:
 
 public:
 	///	<summary>
-	///		Linearly interpolate data horizontally to the specified points.
+	///		Build horizontal interpolation stencils for the points with
+	///		iPatch equal to the index of this patch.
 	///	</summary>
-	virtual void InterpolateData(
-		DataType eDataType,
-		const DataArray1D<double> & dREta,
+	virtual void InitializeInterpStencil(
 		const DataArray1D<double> & dAlpha,
 		const DataArray1D<double> & dBeta,
 		const DataArray1D<int> & iPatch,
+		PatchInterpStencil & stencil
+	) const;
+
+	///	<summary>
+	///		Linearly interpolate data horizontally to the points of the
+	///		given stencil.
+	///	</summary>
+	virtual void InterpolateData(
+		DataType eDataType,
+		const DataArray1D<double> & dREta,
+		const PatchInterpStencil & stencil,
 		DataArray3D<double> & dInterpData,
 		DataLocation eOnlyVariablesAt = DataLocation_None,
 		bool fIncludeReferenceState = true,
@@ -341,6 +386,28 @@ public:
 		return m_iProcessor;
 	}
 
+	///	<summary>
+	///		Add to the measured compute time on this patch (in
+	///		microseconds), used for load balancing.
+	///	</summary>
+	void AddComputeTime(unsigned long lTime) {
+		m_lComputeTime += lTime;
+	}
+
+	///	<summary>
+	///		Get the measured compute time on this patch (in microseconds).
+	///	</summary>
+	unsigned long GetComputeTime() const {
+		return m_lComputeTime;
+	}
+
+	///	<summary>
+	///		Reset the measured compute time on this patch.
+	///	</summary>
+	void ResetComputeTime() {
+		m_lComputeTime = 0;
+	}
+
 	///	<summary>
 	///		Get the PatchBox defining the location of this patch on the grid.
 	///	</summary>
@@ -1133,6 +1200,12 @@ protected:
 	///	</summary>
 	bool m_fContainsData;
 
+	///	<summary>
+	///		Measured compute time on this patch since the last reset
+	///		(in microseconds).
+	///	</summary>
+	unsigned long m_lComputeTime;
+
 protected:
 	///	<summary>
 	///		Geometric patch index.
@@ -1167,27 +1167,16 @@ void GridPatchCSGLL::ComputeVorticityDivergence(
 void GridPatchCSGLL::InterpolateData(
 	DataType eDataType,
 	const DataArray1D<double> & dREta,
-	const DataArray1D<double> & dAlpha,
-	const DataArray1D<double> & dBeta,
-	const DataArray1D<int> & iPatch,
+	const PatchInterpStencil & stencil,
 	DataArray3D<double> & dInterpData,
 	DataLocation eOnlyVariablesAt,
 	bool fIncludeReferenceState,
 	bool fConvertToPrimitive
 ) {
-	if ((dAlpha.GetRows() != dBeta.GetRows()) ||
-		(dAlpha.GetRows() != iPatch.GetRows())
-	) {
-		_EXCEPTIONT("Point vectors must have equivalent length.");
+	if (stencil.m_ixPatch != GetPatchIndex()) {
+		_EXCEPTIONT("Stencil does not correspond to this patch");
 	}
 
-	// Vector for storage interpolated points
-	DataArray1D<double> dAInterpCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dBInterpCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dADiffCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dBDiffCoeffs(m_nHorizontalOrder);
-	DataArray1D<double> dAInterpPt(m_nHorizontalOrder);
-
 	// Physical constants
 	const PhysicalConstants & phys = m_grid.GetModel().GetPhysicalConstants();
 
@@ -1385,126 +1374,64 @@ void GridPatchCSGLL::InterpolateData(
 			pData.AttachToData(&(m_dataUserData2D(c,0,0)));
 		}
 
-		// Loop throught all points
-		for (int i = 0; i < dAlpha.GetRows(); i++) {
+		// Loop through all points on this patch
+		const int nOrder2 = m_nHorizontalOrder * m_nHorizontalOrder;
 
-			// Element index
-			if (iPatch[i] != GetPatchIndex()) {
-				continue;
-			}
+		for (int j = 0; j < stencil.GetPointCount(); j++) {
 
-			// Verify point lies within domain of patch
-			const double Eps = 1.0e-10;
-			if ((dAlpha[i] < m_dAEdge[m_box.GetAInteriorBegin()] - Eps) ||
-				(dAlpha[i] > m_dAEdge[m_box.GetAInteriorEnd()] + Eps) ||
-				(dBeta[i] < m_dBEdge[m_box.GetBInteriorBegin()] - Eps) ||
-				(dBeta[i] > m_dBEdge[m_box.GetBInteriorEnd()] + Eps)
-			) {
-				_EXCEPTIONT("Point out of range");
-			}
-
-			// Determine finite element index
-			int iA =
-				(dAlpha[i] - m_dAEdge[m_box.GetAInteriorBegin()])
-					/ GetElementDeltaA();
+			const int iA = stencil.m_vecNodeA[j];
+			const int iB = stencil.m_vecNodeB[j];
 
-			int iB =
-				(dBeta[i] - m_dBEdge[m_box.GetBInteriorBegin()])
-					/ GetElementDeltaB();
+			const double * dCoeff = &(stencil.m_vecCoeff[j * nOrder2]);
 
-			// Bound the index within the element
-			if (iA < 0) {
-				iA = 0;
-			}
-			if (iA >= (m_box.GetAInteriorWidth() / m_nHorizontalOrder)) {
-				iA = m_box.GetAInteriorWidth() / m_nHorizontalOrder - 1;
-			}
-			if (iB < 0) {
-				iB = 0;
-			}
-			if (iB >= (m_box.GetBInteriorWidth() / m_nHorizontalOrder)) {
-				iB = m_box.GetBInteriorWidth() / m_nHorizontalOrder - 1;
-			}
-
-			iA = m_box.GetHaloElements() + iA * m_nHorizontalOrder;
-			iB = m_box.GetHaloElements() + iB * m_nHorizontalOrder;
-
-			// Compute interpolation coefficients
-			PolynomialInterp::LagrangianPolynomialCoeffs(
-				m_nHorizontalOrder,
-				&(m_dAEdge[iA]),
-				dAInterpCoeffs,
-				dAlpha[i]);
-
-			PolynomialInterp::LagrangianPolynomialCoeffs(
-				m_nHorizontalOrder,
-				&(m_dBEdge[iB]),
-				dBInterpCoeffs,
-				dBeta[i]);
-
-			// Perform interpolation on all levels
+			// Perform horizontal interpolation on all levels
 			for (int k = 0; k < nRElements; k++) {
-
 				dColumnData[k] = 0.0;
+			}
 
-				// Rescale vertical velocity
-				const int WIx = 3;
-				if ((c == WIx) && (fConvertToPrimitive)) {
-					if (m_grid.GetVarLocation(WIx) == DataLocation_REdge) {
-						for (int m = 0; m < m_nHorizontalOrder; m++) {
-						for (int n = 0; n < m_nHorizontalOrder; n++) {
+			for (int m = 0; m < m_nHorizontalOrder; m++) {
+			for (int n = 0; n < m_nHorizontalOrder; n++) {
+				const double dCoeffMN = dCoeff[m * m_nHorizontalOrder + n];
+				const double * dNodeData = &(pData(iA+m,iB+n,0));
 
-#if defined(PROGNOSTIC_CONTRAVARIANT_MOMENTA)
-							dColumnData[k] +=
-								  dAInterpCoeffs[m]
-								* dBInterpCoeffs[n]
-								* pData(iA+m,iB+n,k);
-#else
-							dColumnData[k] +=
-								  dAInterpCoeffs[m]
-								* dBInterpCoeffs[n]
-								* pData(iA+m,iB+n,k)
-								/ m_dataDerivRREdge(iA,iB,k,2);
-#endif
-						}
-						}
-
-					} else {
-						for (int m = 0; m < m_nHorizontalOrder; m++) {
-						for (int n = 0; n < m_nHorizontalOrder; n++) {
-							dColumnData[k] +=
-								  dAInterpCoeffs[m]
-								* dBInterpCoeffs[n]
-								* pData(iA+m,iB+n,k)
-								/ m_dataDerivRNode(iA,iB,k,2);
-						}
-						}
-					}
+				for (int k = 0; k < nRElements; k++) {
+					dColumnData[k] += dCoeffMN * dNodeData[k];
+				}
+			}
+			}
 
-				} else {
-					for (int m = 0; m < m_nHorizontalOrder; m++) {
-					for (int n = 0; n < m_nHorizontalOrder; n++) {
-						dColumnData[k] +=
-							  dAInterpCoeffs[m]
-							* dBInterpCoeffs[n]
-							* pData(iA+m,iB+n,k);
+			// Rescale vertical velocity
+			const int WIx = 3;
+			if ((c == WIx) && (fConvertToPrimitive)) {
+				if (m_grid.GetVarLocation(WIx) == DataLocation_REdge) {
+#if !defined(PROGNOSTIC_CONTRAVARIANT_MOMENTA)
+					for (int k = 0; k < nRElements; k++) {
+						dColumnData[k] /= m_dataDerivRREdge(iA,iB,k,2);
 					}
+#endif
+				} else {
+					for (int k = 0; k < nRElements; k++) {
+						dColumnData[k] /= m_dataDerivRNode(iA,iB,k,2);
 					}
 				}
+			}
 
-				// Do not include the reference state
-				if ((eDataType == DataType_State) &&
-					(!fIncludeReferenceState)
-				) {
-					for (int m = 0; m < m_nHorizontalOrder; m++) {
-					for (int n = 0; n < m_nHorizontalOrder; n++) {
-						dColumnData[k] -=
-							  dAInterpCoeffs[m]
-							* dBInterpCoeffs[n]
-							* pDataRef(iA+m,iB+n,k);
-					}
+			// Do not include the reference state
+			if ((eDataType == DataType_State) &&
+				(!fIncludeReferenceState)
+			) {
+				for (int m = 0; m < m_nHorizontalOrder; m++) {
+				for (int n = 0; n < m_nHorizontalOrder; n++) {
+					const double dCoeffMN =
+						dCoeff[m * m_nHorizontalOrder + n];
+					const double * dNodeDataRef =
+						&(pDataRef(iA+m,iB+n,0));
+
+					for (int k = 0; k < nRElements; k++) {
+						dColumnData[k] -= dCoeffMN * dNodeDataRef[k];
 					}
 				}
+				}
 			}
 
 			// Interpolate vertically
@@ -1513,6 +1440,8 @@ void GridPatchCSGLL::InterpolateData(
 				&(dColumnDataOut[0]));
 
 			// Store data
+			const int i = stencil.m_vecPoint[j];
+
 			for (int k = 0; k < dREta.GetRows(); k++) {
 				dInterpData(c,k,i) =
 					dColumnDataOut[k];
@@ -1536,10 +1465,8 @@ void GridPatchCSGLL::InterpolateData(
 			}
 		}
 
-		for (int i = 0; i < dAlpha.GetRows(); i++) { 
-			if (iPatch[i] != GetPatchIndex()) {
-				continue;
-			}
+		for (int j = 0; j < stencil.GetPointCount(); j++) {
+			const int i = stencil.m_vecPoint[j];
 
 			for (int k = 0; k < dREta.GetRows(); k++) {
 #if defined(PROGNOSTIC_CONTRAVARIANT_MOMENTA)
@@ -1553,8 +1480,8 @@ void GridPatchCSGLL::InterpolateData(
 					* phys.GetEarthRadius();
 
 				CubedSphereTrans::VecTransRLLFromABP(
-					tan(dAlpha[i]),
-					tan(dBeta[i]),
+					tan(stencil.m_vecAlpha[j]),
+					tan(stencil.m_vecBeta[j]),
 					GetPatchBox().GetPanel(),
 					dUalpha,
 					dUbeta,
@@ -1567,8 +1494,8 @@ void GridPatchCSGLL::InterpolateData(
 					dInterpData(VIx,k,i) / phys.GetEarthRadius();
 
 				CubedSphereTrans::CoVecTransRLLFromABP(
-					tan(dAlpha[i]),
-					tan(dBeta[i]),
+					tan(stencil.m_vecAlpha[j]),
+					tan(stencil.m_vecBeta[j]),
 					GetPatchBox().GetPanel(),
 					dUalpha,
 					dUbeta,
@@ -135,9 +135,7 @@ public:
 	virtual void InterpolateData(
 		DataType eDataType,
 		const DataArray1D<double> & dREta,
-		const DataArray1D<double> & dAlpha,
-		const DataArray1D<double> & dBeta,
-		const DataArray1D<int> & iPatch,
+		const PatchInterpStencil & stencil,
 		DataArray3D<double> & dInterpData,
 		DataLocation eOnlyVariablesAt = DataLocation_None,
 		bool fIncludeReferenceState = true,
@@ -20,6 +20,9 @@
 #include "EquationSet.h"
 #include "Defines.h"
 #include "DataArray1D.h"
+#include "PolynomialInterp.h"
+
+#include <cmath>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -144,6 +147,100 @@ void GridPatchGLL::InterpolateREdgeToNode(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void GridPatchGLL::InitializeInterpStencil(
+	const DataArray1D<double> & dAlpha,
+	const DataArray1D<double> & dBeta,
+	const DataArray1D<int> & iPatch,
+	PatchInterpStencil & stencil
+) const {
+	if ((dAlpha.GetRows() != dBeta.GetRows()) ||
+		(dAlpha.GetRows() != iPatch.GetRows())
+	) {
+		_EXCEPTIONT("Point vectors must have equivalent length.");
+	}
+
+	stencil = PatchInterpStencil();
+	stencil.m_ixPatch = GetPatchIndex();
+
+	// Vector for storage of interpolation coefficients
+	DataArray1D<double> dAInterpCoeffs(m_nHorizontalOrder);
+	DataArray1D<double> dBInterpCoeffs(m_nHorizontalOrder);
+
+	// Loop through all points
+	for (int i = 0; i < dAlpha.GetRows(); i++) {
+
+		// Element index
+		if (iPatch[i] != GetPatchIndex()) {
+			continue;
+		}
+
+		// Verify point lies within domain of patch
+		const double Eps = 1.0e-10;
+		if ((dAlpha[i] < m_dAEdge[m_box.GetAInteriorBegin()] - Eps) ||
+			(dAlpha[i] > m_dAEdge[m_box.GetAInteriorEnd()] + Eps) ||
+			(dBeta[i] < m_dBEdge[m_box.GetBInteriorBegin()] - Eps) ||
+			(dBeta[i] > m_dBEdge[m_box.GetBInteriorEnd()] + Eps)
+		) {
+			_EXCEPTIONT("Point out of range");
+		}
+
+		// Determine finite element index
+		int iA =
+			(dAlpha[i] - m_dAEdge[m_box.GetAInteriorBegin()])
+				/ GetElementDeltaA();
+
+		int iB =
+			(dBeta[i] - m_dBEdge[m_box.GetBInteriorBegin()])
+				/ GetElementDeltaB();
+
+		// Bound the index within the element
+		if (iA < 0) {
+			iA = 0;
+		}
+		if (iA >= (m_box.GetAInteriorWidth() / m_nHorizontalOrder)) {
+			iA = m_box.GetAInteriorWidth() / m_nHorizontalOrder - 1;
+		}
+		if (iB < 0) {
+			iB = 0;
+		}
+		if (iB >= (m_box.GetBInteriorWidth() / m_nHorizontalOrder)) {
+			iB = m_box.GetBInteriorWidth() / m_nHorizontalOrder - 1;
+		}
+
+		iA = m_box.GetHaloElements() + iA * m_nHorizontalOrder;
+		iB = m_box.GetHaloElements() + iB * m_nHorizontalOrder;
+
+		// Compute interpolation coefficients
+		PolynomialInterp::LagrangianPolynomialCoeffs(
+			m_nHorizontalOrder,
+			&(m_dAEdge[iA]),
+			dAInterpCoeffs,
+			dAlpha[i]);
+
+		PolynomialInterp::LagrangianPolynomialCoeffs(
+			m_nHorizontalOrder,
+			&(m_dBEdge[iB]),
+			dBInterpCoeffs,
+			dBeta[i]);
+
+		// Store the stencil
+		stencil.m_vecPoint.push_back(i);
+		stencil.m_vecAlpha.push_back(dAlpha[i]);
+		stencil.m_vecBeta.push_back(dBeta[i]);
+		stencil.m_vecNodeA.push_back(iA);
+		stencil.m_vecNodeB.push_back(iB);
+
+		for (int m = 0; m < m_nHorizontalOrder; m++) {
+		for (int n = 0; n < m_nHorizontalOrder; n++) {
+			stencil.m_vecCoeff.push_back(
+				dAInterpCoeffs[m] * dBInterpCoeffs[n]);
+		}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridPatchGLL::ComputeRichardson(
 	int iDataIndex,
 	DataLocation loc
@@ -322,3 +419,148 @@ void GridPatchGLL::ComputeRichardson(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+double GridPatchGLL::ComputeMaximumCourantNumber(
+	int iDataIndex,
+	double dDeltaT
+) const {
+	const PhysicalConstants & phys = m_grid.GetModel().GetPhysicalConstants();
+
+	const EquationSet & eqn = m_grid.GetModel().GetEquationSet();
+
+	// Number of radial elements
+	const int nRElements = m_grid.GetRElements();
+
+	// Indices of EquationSet variables
+	const int UIx = 0;
+	const int VIx = 1;
+	const int PIx = 2;
+	const int HIx = 2;
+	const int RIx = 4;
+
+	// Metric quantities
+	const DataArray3D<double> & dContraMetric2DA = GetContraMetric2DA();
+	const DataArray3D<double> & dContraMetric2DB = GetContraMetric2DB();
+
+	const DataArray2D<double> & dTopography = GetTopography();
+
+	// State data
+	const DataArray4D<double> & dataNode = m_datavecStateNode[iDataIndex];
+	const DataArray4D<double> & dataREdge = m_datavecStateREdge[iDataIndex];
+
+	const bool fShallowWater =
+		(eqn.GetType() == EquationSet::ShallowWaterEquations);
+
+	const bool fPressureOnREdge =
+		(!fShallowWater) && (m_grid.GetVarLocation(PIx) == DataLocation_REdge);
+	const bool fDensityOnREdge =
+		(!fShallowWater) && (m_grid.GetVarLocation(RIx) == DataLocation_REdge);
+
+	// Minimum GLL node spacing within an element, which limits the
+	// stable time step of the spectral element discretization
+	double dNodeDeltaA = m_dElementDeltaA;
+	double dNodeDeltaB = m_dElementDeltaB;
+	for (int i = 0; i < m_nHorizontalOrder - 1; i++) {
+		const int iA = m_box.GetAInteriorBegin() + i;
+		const int iB = m_box.GetBInteriorBegin() + i;
+
+		const double dDeltaA = fabs(m_dANode[iA+1] - m_dANode[iA]);
+		const double dDeltaB = fabs(m_dBNode[iB+1] - m_dBNode[iB]);
+
+		if (dDeltaA < dNodeDeltaA) {
+			dNodeDeltaA = dDeltaA;
+		}
+		if (dDeltaB < dNodeDeltaB) {
+			dNodeDeltaB = dDeltaB;
+		}
+	}
+
+	const double dInvNodeDeltaA = 1.0 / dNodeDeltaA;
+	const double dInvNodeDeltaB = 1.0 / dNodeDeltaB;
+
+	double dMaxCourantNumber = 0.0;
+
+	for (int i = m_box.GetAInteriorBegin(); i < m_box.GetAInteriorEnd(); i++) {
+	for (int j = m_box.GetBInteriorBegin(); j < m_box.GetBInteriorEnd(); j++) {
+	for (int k = 0; k < nRElements; k++) {
+
+		// Contravariant velocities
+		const double dCovUa = dataNode(UIx,i,j,k);
+		const double dCovUb = dataNode(VIx,i,j,k);
+
+		const double dConUa =
+			  dContraMetric2DA(i,j,0) * dCovUa
+			+ dContraMetric2DA(i,j,1) * dCovUb;
+
+		const double dConUb =
+			  dContraMetric2DB(i,j,0) * dCovUa
+			+ dContraMetric2DB(i,j,1) * dCovUb;
+
+		// Speed of the fastest horizontally propagating wave
+		double dWaveSpeed2;
+
+		if (fShallowWater) {
+			dWaveSpeed2 =
+				phys.GetG() * (dataNode(HIx,i,j,k) - dTopography(i,j));
+
+		} else {
+			double dP;
+			if (fPressureOnREdge) {
+				dP = 0.5 * (dataREdge(PIx,i,j,k) + dataREdge(PIx,i,j,k+1));
+			} else {
+				dP = dataNode(PIx,i,j,k);
+			}
+
+			double dRho;
+			if (fDensityOnREdge) {
+				dRho = 0.5 * (dataREdge(RIx,i,j,k) + dataREdge(RIx,i,j,k+1));
+			} else {
+				dRho = dataNode(RIx,i,j,k);
+			}
+
+#ifdef FORMULATION_PRESSURE
+			const double dPressure = dP;
+#endif
+#if defined(FORMULATION_RHOTHETA_PI) || defined(FORMULATION_RHOTHETA_P)
+			const double dPressure = phys.PressureFromRhoTheta(dP);
+#endif
+#if defined(FORMULATION_THETA) || defined(FORMULATION_THETA_FLUX)
+			const double dPressure = phys.PressureFromRhoTheta(dRho * dP);
+#endif
+			dWaveSpeed2 = phys.GetGamma() * dPressure / dRho;
+		}
+
+		double dWaveSpeed = 0.0;
+		if (dWaveSpeed2 > 0.0) {
+			dWaveSpeed = sqrt(dWaveSpeed2);
+		}
+
+		// Contravariant metric scaled by the node spacing
+		const double dScaledMetricAA =
+			dContraMetric2DA(i,j,0) * dInvNodeDeltaA * dInvNodeDeltaA;
+		const double dScaledMetricAB =
+			dContraMetric2DA(i,j,1) * dInvNodeDeltaA * dInvNodeDeltaB;
+		const double dScaledMetricBB =
+			dContraMetric2DB(i,j,1) * dInvNodeDeltaB * dInvNodeDeltaB;
+
+		// Advection through both coordinate directions, plus a wave whose
+		// wavenumber is at the grid scale in both coordinate directions
+		const double dCourantNumber =
+			  fabs(dConUa) * dInvNodeDeltaA
+			+ fabs(dConUb) * dInvNodeDeltaB
+			+ dWaveSpeed * sqrt(
+				  dScaledMetricAA
+				+ dScaledMetricBB
+				+ 2.0 * fabs(dScaledMetricAB));
+
+		if (dCourantNumber > dMaxCourantNumber) {
+			dMaxCourantNumber = dCourantNumber;
+		}
+	}
+	}
+	}
+
+	return (dDeltaT * dMaxCourantNumber);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
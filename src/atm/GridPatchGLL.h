@@ -63,6 +63,18 @@ public:
 		int iDataIndex
 	);
 
+public:
+	///	<summary>
+	///		Build horizontal interpolation stencils for the points with
+	///		iPatch equal to the index of this patch.
+	///	</summary>
+	virtual void InitializeInterpStencil(
+		const DataArray1D<double> & dAlpha,
+		const DataArray1D<double> & dBeta,
+		const DataArray1D<int> & iPatch,
+		PatchInterpStencil & stencil
+	) const;
+
 public:
 	///	<summary>
 	///		Transform vectors received from other panels to this panel's
@@ -111,6 +123,15 @@ public:
 		DataLocation loc = DataLocation_REdge
 	);
 
+	///	<summary>
+	///		Compute the maximum horizontal Courant number on the GridPatch,
+	///		measured relative to the minimum GLL node spacing.
+	///	</summary>
+	virtual double ComputeMaximumCourantNumber(
+		int iDataIndex,
+		double dDeltaT
+	) const;
+
 protected:
 	///	<summary>
 	///		Order of accuracy of this patch.
@@ -18,6 +18,7 @@
 
 #include "Model.h"
 
+#include "FunctionTimer.h"
 #include "Announce.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -85,6 +86,8 @@ void HeldSuarezPhysics::Perform(
 	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
 		GridPatch * pPatch = pGrid->GetActivePatch(n);
 
+		FunctionTimer timerPatch;
+
 		const PatchBox & box = pPatch->GetPatchBox();
 
 		// Get latitude
@@ -273,6 +276,8 @@ void HeldSuarezPhysics::Perform(
 */
 		}
 		}
+
+		pPatch->AddComputeTime(timerPatch.Time());
 	}
 
 	// Call up the stack to update performance time
@@ -385,7 +385,9 @@ void HighSpeedDynamics::StepExplicitCombine(
 	}
 
 	// Start the function timer
-	FunctionTimer timer("CalculateTendencies");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("CalculateTendencies");
+	FunctionTimer timer(s_idTimer);
 
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
@@ -1029,7 +1031,9 @@ void HighSpeedDynamics::StepImplicitCombine(
 	}
 
 	// Start the function timer
-	FunctionTimer timer("AcousticLoop");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("AcousticLoop");
+	FunctionTimer timer(s_idTimer);
 
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
@@ -2329,7 +2333,9 @@ void HighSpeedDynamics::StepAfterSubCycleCombine(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("StepAfterSubCycle");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("StepAfterSubCycle");
+	FunctionTimer timer(s_idTimer);
 
 	// Check indices
 	if (iDataUpdate == iDataWorking) {
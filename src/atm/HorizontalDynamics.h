@@ -18,6 +18,7 @@
 #define _HORIZONTALDYNAMICS_H_
 
 #include "Exception.h"
+#include "ElementSubset.h"
 
 #include "DataArray1D.h"
 
@@ -85,6 +86,31 @@ public:
 	) {
 	}
 
+	///	<summary>
+	///		Determine if explicit time steps can be performed on a subset
+	///		of the elements on each patch using StepExplicitSubset().
+	///	</summary>
+	virtual bool SupportsElementSubsets() const {
+		return false;
+	}
+
+	///	<summary>
+	///		Perform one explicit time step on a subset of the elements on
+	///		each patch.
+	///	</summary>
+	virtual void StepExplicitSubset(
+		int iDataArgument,
+		int iDataUpdate,
+		const Time & time,
+		double dDeltaT,
+		ElementSubset eSubset
+	) {
+		if (eSubset != ElementSubset_All) {
+			_EXCEPTIONT("Unimplemented");
+		}
+		StepExplicit(iDataArgument, iDataUpdate, time, dDeltaT);
+	}
+
 	///	<summary>
 	///		Perform one explicit time step.
 	///	</summary>
@@ -24,6 +24,11 @@
 #include "Announce.h"
 #include "GridGLL.h"
 #include "GridPatchGLL.h"
+#include "FixedOrderMatrix.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 //#define DIFFERENTIAL_FORM
 
@@ -58,6 +63,14 @@ HorizontalDynamicsFEM::HorizontalDynamicsFEM(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+HorizontalDynamicsFEM::~HorizontalDynamicsFEM() {
+	for (int t = 0; t < m_vecElementWorkspaces.size(); t++) {
+		delete m_vecElementWorkspaces[t];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void HorizontalDynamicsFEM::Initialize() {
 
 #if defined(PROGNOSTIC_CONTRAVARIANT_MOMENTA)
@@ -206,12 +219,35 @@ void HorizontalDynamicsFEM::Initialize() {
 	m_dBufferState.Allocate(
 		nHorizontalOrder,
 		nHorizontalOrder);
+
+	// Element workspaces for the threaded element loops.  Each workspace
+	// is a copy of this object, so all element buffers are thread private.
+	for (int t = 0; t < m_vecElementWorkspaces.size(); t++) {
+		delete m_vecElementWorkspaces[t];
+	}
+	m_vecElementWorkspaces.clear();
+
+	int nThreads = 1;
+#ifdef _OPENMP
+	nThreads = omp_get_max_threads();
+#endif
+
+	std::vector<HorizontalDynamicsFEM *> vecElementWorkspaces;
+	for (int t = 1; t < nThreads; t++) {
+		vecElementWorkspaces.push_back(new HorizontalDynamicsFEM(*this));
+	}
+	m_vecElementWorkspaces = vecElementWorkspaces;
+
+	if (nThreads > 1) {
+		Announce("Horizontal element loops using %i threads", nThreads);
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void HorizontalDynamicsFEM::FilterNegativeTracers(
-	int iDataUpdate
+	int iDataUpdate,
+	ElementSubset eSubset
 ) {
 #ifdef POSITIVE_DEFINITE_FILTER_TRACERS
 	// Get a copy of the GLL grid
@@ -255,10 +291,16 @@ void HorizontalDynamicsFEM::FilterNegativeTracers(
 		int nElementCountA = pPatch->GetElementCountA();
 		int nElementCountB = pPatch->GetElementCountB();
 
-		// Loop over all elements
+		// Loop over all elements in the subset
 		for (int a = 0; a < nElementCountA; a++) {
 		for (int b = 0; b < nElementCountB; b++) {
 
+			if (!IsElementInSubset(
+				eSubset, a, b, nElementCountA, nElementCountB)
+			) {
+				continue;
+			}
+
 			// Loop overall tracers and vertical levels
 			for (int c = 0; c < nTracerCount; c++) {
 			for (int k = 0; k < nRElements; k++) {
@@ -652,11 +694,36 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 	int iDataInitial,
 	int iDataUpdate,
 	const Time & time,
-	double dDeltaT
+	double dDeltaT,
+	ElementSubset eSubset
 ) {
 	// Start the function timer
-	FunctionTimer timer("HorizontalStepNonhydrostaticPrimitive");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("HorizontalStepNonhydrostaticPrimitive");
+	FunctionTimer timer(s_idTimer);
+
+#if defined(FIXED_HORIZONTAL_ORDER)
+	if (m_nHorizontalOrder != FIXED_HORIZONTAL_ORDER) {
+		_EXCEPTIONT("Command line order must match FIXED_HORIZONTAL_ORDER");
+	}
+	StepNonhydrostaticPrimitiveOrder<FIXED_HORIZONTAL_ORDER>(
+		iDataInitial, iDataUpdate, time, dDeltaT, eSubset);
+#else
+	DISPATCH_FIXED_ORDER_KERNEL(m_nHorizontalOrder, StepNonhydrostaticPrimitiveOrder,
+		iDataInitial, iDataUpdate, time, dDeltaT, eSubset);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
 
+template <int NHorizontalOrder>
+void HorizontalDynamicsFEM::StepNonhydrostaticPrimitiveOrder(
+	int iDataInitial,
+	int iDataUpdate,
+	const Time & time,
+	double dDeltaT,
+	ElementSubset eSubset
+) {
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
 
@@ -683,14 +750,9 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 	const int UCrossZetaXIx = 7;
 	const int ExnerIx = 8;
 
-#if defined(FIXED_HORIZONTAL_ORDER)
-	const int nHorizontalOrder = FIXED_HORIZONTAL_ORDER;
-	if (nHorizontalOrder != m_nHorizontalOrder) {
-		_EXCEPTIONT("Command line order must match FIXED_HORIZONTAL_ORDER");
-	}
-#else
-	const int nHorizontalOrder = m_nHorizontalOrder;
-#endif
+	// Horizontal order (compile-time constant unless NHorizontalOrder is 0)
+	const int nHorizontalOrder =
+		(NHorizontalOrder != 0)?(NHorizontalOrder):(m_nHorizontalOrder);
 
 #if defined(FIXED_RELEMENTS)
 	const int nRElements = FIXED_RELEMENTS;
@@ -787,25 +849,90 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 		const double dInvElementDeltaA = 1.0 / dElementDeltaA;
 		const double dInvElementDeltaB = 1.0 / dElementDeltaB;
 
-		const DataArray2D<double> & dDxBasis1D = pGrid->GetDxBasis1D();
-		const DataArray2D<double> & dStiffness1D = pGrid->GetStiffness1D();
+		const FixedOrderMatrix<NHorizontalOrder>
+			dDxBasis1D(pGrid->GetDxBasis1D());
+		const FixedOrderMatrix<NHorizontalOrder>
+			dStiffness1D(pGrid->GetStiffness1D());
 
 		// Get number of finite elements in each coordinate direction
 		const int nElementCountA = pPatch->GetElementCountA();
 		const int nElementCountB = pPatch->GetElementCountB();
 
-		// Loop over all elements
-		for (int a = 0; a < nElementCountA; a++) {
-		for (int b = 0; b < nElementCountB; b++) {
+		// Loop over all elements in the subset, distributing them over
+		// the element workspaces
+		const int nThreads = m_vecElementWorkspaces.size() + 1;
+
+		std::vector<int> vecElements;
+		GetElementsInSubset(
+			eSubset, nElementCountA, nElementCountB, vecElements);
+
+		const int nElements = vecElements.size();
+
+#pragma omp parallel for schedule(static) num_threads(nThreads)
+		for (int ie = 0; ie < nElements; ie++) {
+
+			const int e = vecElements[ie];
+			const int a = e / nElementCountB;
+			const int b = e % nElementCountB;
+
+			int iThread = 0;
+#ifdef _OPENMP
+			iThread = omp_get_thread_num();
+#endif
+
+			// Element buffers of this thread
+			HorizontalDynamicsFEM * pWorkspace = GetElementWorkspace(iThread);
+
+			DataArray3D<double> & dAlphaMassFlux =
+				pWorkspace->m_dAlphaMassFlux;
+			DataArray3D<double> & dBetaMassFlux =
+				pWorkspace->m_dBetaMassFlux;
+			DataArray3D<double> & dAlphaPressureFlux =
+				pWorkspace->m_dAlphaPressureFlux;
+			DataArray3D<double> & dBetaPressureFlux =
+				pWorkspace->m_dBetaPressureFlux;
+			DataArray4D<double> & dAlphaTracerFlux =
+				pWorkspace->m_dAlphaTracerFlux;
+			DataArray4D<double> & dBetaTracerFlux =
+				pWorkspace->m_dBetaTracerFlux;
+			DataArray4D<double> & dAuxDataNode =
+				pWorkspace->m_dAuxDataNode;
+			DataArray4D<double> & dAuxDataREdge =
+				pWorkspace->m_dAuxDataREdge;
+			DataArray3D<double> & dDivergence =
+				pWorkspace->m_dDivergence;
+			DataArray2D<double> & dLocalCoriolisF =
+				pWorkspace->m_dLocalCoriolisF;
+			DataArray2D<double> & dLocalJacobian2D =
+				pWorkspace->m_dLocalJacobian2D;
+			DataArray3D<double> & dLocalJacobian =
+				pWorkspace->m_dLocalJacobian;
+			DataArray4D<double> & dLocalDerivR =
+				pWorkspace->m_dLocalDerivR;
+			DataArray4D<double> & dLocalContraMetric =
+				pWorkspace->m_dLocalContraMetric;
+
+#if defined(FIX_ELEMENT_MASS_NONHYDRO)
+			DataArray3D<double> & dAlphaElMassFlux =
+				pWorkspace->m_dAlphaElMassFlux;
+			DataArray3D<double> & dBetaElMassFlux =
+				pWorkspace->m_dBetaElMassFlux;
+			DataArray1D<double> & dElementMassFluxA =
+				pWorkspace->m_dElementMassFluxA;
+			DataArray1D<double> & dElementMassFluxB =
+				pWorkspace->m_dElementMassFluxB;
+			DataArray1D<double> & dElTotalArea =
+				pWorkspace->m_dElTotalArea;
+#endif
 
 			const int iElementA = a * nHorizontalOrder + box.GetHaloElements();
 			const int iElementB = b * nHorizontalOrder + box.GetHaloElements();
 
 #if defined(FIX_ELEMENT_MASS_NONHYDRO)
 			// Zero mass fixer arrays
-			m_dElementMassFluxA.Zero();
-			m_dElementMassFluxB.Zero();
-			m_dElTotalArea.Zero();
+			dElementMassFluxA.Zero();
+			dElementMassFluxB.Zero();
+			dElTotalArea.Zero();
 #endif
 
 			// Store 2D Jacobian
@@ -815,9 +942,9 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				const int iA = iElementA + i;
 				const int iB = iElementB + j;
 
-				m_dLocalCoriolisF(i,j) =
+				dLocalCoriolisF(i,j) =
 					dCoriolisF(iA,iB);
-				m_dLocalJacobian2D(i,j) =
+				dLocalJacobian2D(i,j) =
 					dJacobian2D(iA,iB);
 			}
 			}
@@ -836,53 +963,53 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				const double dCovUx = dataInitialNode(WIx,iA,iB,k);
 
 				// Store metric quantities
-				m_dLocalJacobian(i,j,k) =
+				dLocalJacobian(i,j,k) =
 					dJacobian(iA,iB,k);
 
-				m_dLocalDerivR(i,j,k,0) =
+				dLocalDerivR(i,j,k,0) =
 					dDerivRNode(iA,iB,k,0);
-				m_dLocalDerivR(i,j,k,1) =
+				dLocalDerivR(i,j,k,1) =
 					dDerivRNode(iA,iB,k,1);
-				m_dLocalDerivR(i,j,k,2) =
+				dLocalDerivR(i,j,k,2) =
 					dDerivRNode(iA,iB,k,2);
 
-				m_dLocalContraMetric(i,j,k,0) =
+				dLocalContraMetric(i,j,k,0) =
 					dContraMetricA(iA,iB,k,0);
-				m_dLocalContraMetric(i,j,k,1) =
+				dLocalContraMetric(i,j,k,1) =
 					dContraMetricA(iA,iB,k,1);
-				m_dLocalContraMetric(i,j,k,2) =
+				dLocalContraMetric(i,j,k,2) =
 					dContraMetricA(iA,iB,k,2);
-				m_dLocalContraMetric(i,j,k,3) =
+				dLocalContraMetric(i,j,k,3) =
 					dContraMetricB(iA,iB,k,1);
-				m_dLocalContraMetric(i,j,k,4) =
+				dLocalContraMetric(i,j,k,4) =
 					dContraMetricB(iA,iB,k,2);
-				m_dLocalContraMetric(i,j,k,5) =
+				dLocalContraMetric(i,j,k,5) =
 					dContraMetricXi(iA,iB,k,2);
 
 				// Calculate covariant xi velocity and store
-				m_dAuxDataNode(CovUxIx,i,j,k) = dCovUx;
+				dAuxDataNode(CovUxIx,i,j,k) = dCovUx;
 
 				// Contravariant velocities
-				m_dAuxDataNode(ConUaIx,i,j,k) =
-					  m_dLocalContraMetric(i,j,k,0) * dCovUa
-					+ m_dLocalContraMetric(i,j,k,1) * dCovUb
-					+ m_dLocalContraMetric(i,j,k,2) * dCovUx;
+				dAuxDataNode(ConUaIx,i,j,k) =
+					  dLocalContraMetric(i,j,k,0) * dCovUa
+					+ dLocalContraMetric(i,j,k,1) * dCovUb
+					+ dLocalContraMetric(i,j,k,2) * dCovUx;
 
-				m_dAuxDataNode(ConUbIx,i,j,k) =
-					  m_dLocalContraMetric(i,j,k,1) * dCovUa
-					+ m_dLocalContraMetric(i,j,k,3) * dCovUb
-					+ m_dLocalContraMetric(i,j,k,4) * dCovUx;
+				dAuxDataNode(ConUbIx,i,j,k) =
+					  dLocalContraMetric(i,j,k,1) * dCovUa
+					+ dLocalContraMetric(i,j,k,3) * dCovUb
+					+ dLocalContraMetric(i,j,k,4) * dCovUx;
 
-				m_dAuxDataNode(ConUxIx,i,j,k) =
-					  m_dLocalContraMetric(i,j,k,2) * dCovUa
-					+ m_dLocalContraMetric(i,j,k,4) * dCovUb
-					+ m_dLocalContraMetric(i,j,k,5) * dCovUx;
+				dAuxDataNode(ConUxIx,i,j,k) =
+					  dLocalContraMetric(i,j,k,2) * dCovUa
+					+ dLocalContraMetric(i,j,k,4) * dCovUb
+					+ dLocalContraMetric(i,j,k,5) * dCovUx;
 
 				// Specific kinetic energy
-				m_dAuxDataNode(KIx,i,j,k) = 0.5 * (
-					  m_dAuxDataNode(ConUaIx,i,j,k) * dCovUa
-					+ m_dAuxDataNode(ConUbIx,i,j,k) * dCovUb
-					+ m_dAuxDataNode(ConUxIx,i,j,k) * dCovUx);
+				dAuxDataNode(KIx,i,j,k) = 0.5 * (
+					  dAuxDataNode(ConUaIx,i,j,k) * dCovUa
+					+ dAuxDataNode(ConUbIx,i,j,k) * dCovUb
+					+ dAuxDataNode(ConUxIx,i,j,k) * dCovUx);
 
 #ifdef FORMULATION_RHOTHETA_P
 				// NOTE: For some reason using parenthetical notation on the
@@ -890,19 +1017,19 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				//       (observed with icpc 16.0.3)
 
 				// Pressure
-				m_dAuxDataNode[ExnerIx][i][j][k] =
+				dAuxDataNode[ExnerIx][i][j][k] =
 					phys.PressureFromRhoTheta(
 						dataInitialNode(PIx,iA,iB,k));
 #endif
 #ifdef FORMULATION_RHOTHETA_PI
 				// Exner pressure
-				m_dAuxDataNode[ExnerIx][i][j][k] =
+				dAuxDataNode[ExnerIx][i][j][k] =
 					phys.ExnerPressureFromRhoTheta(
 						dataInitialNode(PIx,iA,iB,k));
 #endif
 #if defined(FORMULATION_THETA) || defined(FORMULATION_THETA_FLUX)
 				// Exner pressure
-				m_dAuxDataNode[ExnerIx][i][j][k] =
+				dAuxDataNode[ExnerIx][i][j][k] =
 					phys.ExnerPressureFromRhoTheta(
 						  dataInitialNode(RIx,iA,iB,k)
 						* dataInitialNode(PIx,iA,iB,k));
@@ -946,7 +1073,7 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Derivative of covariant xi velocity wrt alpha
 					dCovDaUx +=
-						m_dAuxDataNode(CovUxIx,s,j,k)
+						dAuxDataNode(CovUxIx,s,j,k)
 						* dDxBasis1D(s,i);
 
 					// Derivative of covariant alpha velocity wrt beta
@@ -956,7 +1083,7 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Derivative of covariant xi velocity wrt beta
 					dCovDbUx +=
-						m_dAuxDataNode(CovUxIx,i,s,k)
+						dAuxDataNode(CovUxIx,i,s,k)
 						* dDxBasis1D(s,j);
 				}
 
@@ -966,9 +1093,9 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				dCovDbUx *= dInvElementDeltaB;
 
 				// Contravariant velocities
-				const double dConUa = m_dAuxDataNode(ConUaIx,i,j,k);
-				const double dConUb = m_dAuxDataNode(ConUbIx,i,j,k);
-				const double dConUx = m_dAuxDataNode(ConUxIx,i,j,k);
+				const double dConUa = dAuxDataNode(ConUaIx,i,j,k);
+				const double dConUb = dAuxDataNode(ConUbIx,i,j,k);
+				const double dConUx = dAuxDataNode(ConUxIx,i,j,k);
 
 				// Relative vorticity (contravariant)
 				const double dJZetaA = (dCovDbUx - dCovDxUb);
@@ -976,13 +1103,13 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				const double dJZetaX = (dCovDaUb - dCovDbUa);
 
 				// U cross Relative Vorticity (contravariant)
-				m_dAuxDataNode(UCrossZetaAIx,i,j,k) =
+				dAuxDataNode(UCrossZetaAIx,i,j,k) =
 					dConUb * dJZetaX - dConUx * dJZetaB;
 
-				m_dAuxDataNode(UCrossZetaBIx,i,j,k) =
+				dAuxDataNode(UCrossZetaBIx,i,j,k) =
 					dConUx * dJZetaA - dConUa * dJZetaX;
 
-				m_dAuxDataNode(UCrossZetaXIx,i,j,k) =
+				dAuxDataNode(UCrossZetaXIx,i,j,k) =
 					- dConUa * dCovDaUx - dConUb * dCovDbUx;
 			}
 			}
@@ -998,30 +1125,30 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 				// Base fluxes (area times velocity)
 				const double dAlphaBaseFlux =
-					m_dLocalJacobian(i,j,k)
-					* m_dAuxDataNode(ConUaIx,i,j,k);
+					dLocalJacobian(i,j,k)
+					* dAuxDataNode(ConUaIx,i,j,k);
 
 				const double dBetaBaseFlux =
-					m_dLocalJacobian(i,j,k)
-					* m_dAuxDataNode(ConUbIx,i,j,k);
+					dLocalJacobian(i,j,k)
+					* dAuxDataNode(ConUbIx,i,j,k);
 
 				// Density flux
-				m_dAlphaMassFlux(i,j,k) =
+				dAlphaMassFlux(i,j,k) =
 					  dAlphaBaseFlux
 					* dataInitialNode(RIx,iA,iB,k);
 
-				m_dBetaMassFlux(i,j,k) =
+				dBetaMassFlux(i,j,k) =
 					  dBetaBaseFlux
 					* dataInitialNode(RIx,iA,iB,k);
 
 #ifdef FORMULATION_PRESSURE
 				// Pressure flux
-				m_dAlphaPressureFlux(i,j,k) =
+				dAlphaPressureFlux(i,j,k) =
 					  dAlphaBaseFlux
 					* phys.GetGamma()
 					* dataInitialNode(PIx,iA,iB,k);
 
-				m_dBetaPressureFlux(i,j,k) =
+				dBetaPressureFlux(i,j,k) =
 					  dBetaBaseFlux
 					* phys.GetGamma()
 					* dataInitialNode(PIx,iA,iB,k);
@@ -1029,22 +1156,22 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #if defined(FORMULATION_RHOTHETA_PI) \
  || defined(FORMULATION_RHOTHETA_P)
 				// RhoTheta flux
-				m_dAlphaPressureFlux(i,j,k) =
+				dAlphaPressureFlux(i,j,k) =
 					  dAlphaBaseFlux
 					* dataInitialNode(PIx,iA,iB,k);
 
-				m_dBetaPressureFlux(i,j,k) =
+				dBetaPressureFlux(i,j,k) =
 					  dBetaBaseFlux
 					* dataInitialNode(PIx,iA,iB,k);
 #endif
 /*
 #pragma unroll
 				for (int c = 0; c < nTracerCount; c++) {
-					m_dAlphaTracerFlux(c,i,j,k) =
+					dAlphaTracerFlux(c,i,j,k) =
 						dAlphaBaseFlux
 						* dataInitialTracer(c,iA,iB,k);
 
-					m_dBetaTracerFlux(c,i,j,k) =
+					dBetaTracerFlux(c,i,j,k) =
 						dBetaBaseFlux
 						* dataInitialTracer(c,iA,iB,k);
 				}
@@ -1078,22 +1205,22 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 						// Gradient of tracer mixing ratio
 						double dConDaQ =
-							  m_dLocalContraMetric(i,j,k,0) * dCovDaQ
-							+ m_dLocalContraMetric(i,j,k,1) * dCovDbQ;
+							  dLocalContraMetric(i,j,k,0) * dCovDaQ
+							+ dLocalContraMetric(i,j,k,1) * dCovDbQ;
 
 						double dConDbQ =
-							  m_dLocalContraMetric(i,j,k,1) * dCovDaQ
-							+ m_dLocalContraMetric(i,j,k,3) * dCovDbQ;
+							  dLocalContraMetric(i,j,k,1) * dCovDaQ
+							+ dLocalContraMetric(i,j,k,3) * dCovDbQ;
 
-						m_dAlphaTracerFlux(c,i,j,k) -=
+						dAlphaTracerFlux(c,i,j,k) -=
 							pGrid->GetScalarUniformDiffusionCoeff()
-							* m_dLocalJacobian(i,j,k)
+							* dLocalJacobian(i,j,k)
 							* dataInitialNode(RIx,iA,iB,k)
 							* dConDaQ;
 
-						m_dBetaTracerFlux(c,i,j,k) -=
+						dBetaTracerFlux(c,i,j,k) -=
 							pGrid->GetScalarUniformDiffusionCoeff()
-							* m_dLocalJacobian(i,j,k)
+							* dLocalJacobian(i,j,k)
 							* dataInitialNode(RIx,iA,iB,k)
 							* dConDbQ;
 					}
@@ -1108,22 +1235,22 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				for (int s = 0; s < nHorizontalOrder; s++) {
 					// Alpha derivative of J U^a
 					dDaJUa +=
-						m_dLocalJacobian(s,j,k)
-						* m_dAuxDataNode(ConUaIx,s,j,k)
+						dLocalJacobian(s,j,k)
+						* dAuxDataNode(ConUaIx,s,j,k)
 						* dDxBasis1D(s,i);
 
 					// Beta derivative of J U^b
 					dDbJUb +=
-						m_dLocalJacobian(i,s,k)
-						* m_dAuxDataNode(ConUbIx,i,s,k)
+						dLocalJacobian(i,s,k)
+						* dAuxDataNode(ConUbIx,i,s,k)
 						* dDxBasis1D(s,j);
 				}
 
 				dDaJUa *= dInvElementDeltaA;
 				dDbJUb *= dInvElementDeltaB;
 
-				m_dDivergence(i,j,k) =
-					(dDaJUa + dDbJUb) / m_dLocalJacobian(i,j,k);
+				dDivergence(i,j,k) =
+					(dDaJUa + dDbJUb) / dLocalJacobian(i,j,k);
 #endif
 			}
 			}
@@ -1139,14 +1266,14 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 				// Inverse Jacobian
 				const double dInvJacobian =
-					1.0 / m_dLocalJacobian(i,j,k);
+					1.0 / dLocalJacobian(i,j,k);
 
 				// Aliases for alpha and beta velocities
-				const double dConUa = m_dAuxDataNode(ConUaIx,i,j,k);
-				const double dConUb = m_dAuxDataNode(ConUbIx,i,j,k);
-				const double dConUx = m_dAuxDataNode(ConUxIx,i,j,k);
+				const double dConUa = dAuxDataNode(ConUaIx,i,j,k);
+				const double dConUb = dAuxDataNode(ConUbIx,i,j,k);
+				const double dConUx = dAuxDataNode(ConUxIx,i,j,k);
 
-				const double dCovUx = m_dAuxDataNode(CovUxIx,i,j,k);
+				const double dCovUx = dAuxDataNode(CovUxIx,i,j,k);
 
 				// Derivative of the kinetic energy
 				double dDaKE = 0.0;
@@ -1173,12 +1300,12 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Update density: Variational formulation
 					dDaRhoFluxA -=
-						m_dAlphaMassFlux(s,j,k)
+						dAlphaMassFlux(s,j,k)
 						* dStiffness1D(i,s);
 
 					// Update pressure: Variational formulation
 					dDaPressureFluxA -=
-						m_dAlphaPressureFlux(s,j,k)
+						dAlphaPressureFlux(s,j,k)
 						* dStiffness1D(i,s);
 
 #if defined(FORMULATION_PRESSURE)
@@ -1193,18 +1320,18 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
  || defined(FORMULATION_THETA_FLUX)
 					// Derivative of (Exner) pressure with respect to alpha
 					dDaP +=
-						m_dAuxDataNode(ExnerIx,s,j,k)
+						dAuxDataNode(ExnerIx,s,j,k)
 						* dDxBasis1D(s,i);
 #endif
 
 					// Derivative of specific kinetic energy wrt alpha
 					dDaKE +=
-						m_dAuxDataNode(KIx,s,j,k)
+						dAuxDataNode(KIx,s,j,k)
 						* dDxBasis1D(s,i);
 
 #if defined(INSTEP_DIVERGENCE_DAMPING)
 					dDaDiv -=
-						m_dDivergence(s,j,k)
+						dDivergence(s,j,k)
 						* dStiffness1D(i,s);
 #endif
 				}
@@ -1214,12 +1341,12 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Update density: Variational formulation
 					dDbRhoFluxB -=
-						m_dBetaMassFlux(i,s,k)
+						dBetaMassFlux(i,s,k)
 						* dStiffness1D(j,s);
 
 					// Update pressure: Variational formulation
 					dDbPressureFluxB -=
-						m_dBetaPressureFlux(i,s,k)
+						dBetaPressureFlux(i,s,k)
 						* dStiffness1D(j,s);
 
 #if defined(FORMULATION_PRESSURE)
@@ -1234,18 +1361,18 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
  || defined(FORMULATION_THETA_FLUX)
 					// Derivative of (Exner) pressure with respect to beta
 					dDbP +=
-						m_dAuxDataNode(ExnerIx,i,s,k)
+						dAuxDataNode(ExnerIx,i,s,k)
 						* dDxBasis1D(s,j);
 #endif
 
 					// Derivative of specific kinetic energy wrt beta
 					dDbKE +=
-						m_dAuxDataNode(KIx,i,s,k)
+						dAuxDataNode(KIx,i,s,k)
 						* dDxBasis1D(s,j);
 
 #if defined(INSTEP_DIVERGENCE_DAMPING)
 					dDbDiv -=
-						m_dDivergence(i,s,k)
+						dDivergence(i,s,k)
 						* dStiffness1D(j,s);
 #endif
 				}
@@ -1273,18 +1400,18 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				double dLocalUpdateUb = 0.0;
 
 				// Updates due to rotational terms
-				dLocalUpdateUa += m_dAuxDataNode(UCrossZetaAIx,i,j,k);
-				dLocalUpdateUb += m_dAuxDataNode(UCrossZetaBIx,i,j,k);
+				dLocalUpdateUa += dAuxDataNode(UCrossZetaAIx,i,j,k);
+				dLocalUpdateUb += dAuxDataNode(UCrossZetaBIx,i,j,k);
 
 				// Coriolis terms
 				dLocalUpdateUa +=
-					m_dLocalCoriolisF(i,j)
-					* m_dLocalJacobian2D(i,j)
+					dLocalCoriolisF(i,j)
+					* dLocalJacobian2D(i,j)
 					* dConUb;
 
 				dLocalUpdateUb -=
-					m_dLocalCoriolisF(i,j)
-					* m_dLocalJacobian2D(i,j)
+					dLocalCoriolisF(i,j)
+					* dLocalJacobian2D(i,j)
 					* dConUa;
 
 				// Pressure gradient force
@@ -1310,8 +1437,8 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #endif
 
 				// Gravity
-				const double dDaPhi = phys.GetG() * m_dLocalDerivR(i,j,k,0);
-				const double dDbPhi = phys.GetG() * m_dLocalDerivR(i,j,k,1);
+				const double dDaPhi = phys.GetG() * dLocalDerivR(i,j,k,0);
+				const double dDbPhi = phys.GetG() * dLocalDerivR(i,j,k,1);
 
 				// Horizontal updates due to gradient terms
 				const double dDaUpdate =
@@ -1376,15 +1503,15 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 					// Calculate vertical velocity update
 					double dLocalUpdateUr =
-						m_dAuxDataNode(UCrossZetaXIx,i,j,k);
+						dAuxDataNode(UCrossZetaXIx,i,j,k);
 
 					if (k == 0) {
 						dLocalUpdateUr =
-							- ( m_dLocalContraMetric(iA,iB,0,2)
+							- ( dLocalContraMetric(iA,iB,0,2)
 									* dLocalUpdateUa
-							  + m_dLocalContraMetric(iA,iB,0,4)
+							  + dLocalContraMetric(iA,iB,0,4)
 							  		* dLocalUpdateUb)
-							/ m_dLocalContraMetric(iA,iB,0,5);
+							/ dLocalContraMetric(iA,iB,0,5);
 
 					} else if (k == nRElements-1) {
 						dLocalUpdateUr = 0.0;
@@ -1436,25 +1563,25 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #pragma unroll
 					for (int s = 0; s < nHorizontalOrder; s++) {
 						dDaJUa +=
-							m_dLocalJacobian(s,j,k)
-							* m_dAuxDataNode(ConUaIx,s,j,k)
+							dLocalJacobian(s,j,k)
+							* dAuxDataNode(ConUaIx,s,j,k)
 							* dDxBasis1D(s,i);
 
 						dDbJUb +=
-							m_dLocalJacobian(i,s,k)
-							* m_dAuxDataNode(ConUbIx,i,s,k)
+							dLocalJacobian(i,s,k)
+							* dAuxDataNode(ConUbIx,i,s,k)
 							* dDxBasis1D(s,j);
 
 						dDaJThetaUa +=
-							m_dLocalJacobian(s,j,k)
+							dLocalJacobian(s,j,k)
 							* dataInitialNode(PIx,iElementA+s,iB,k)
-							* m_dAuxDataNode(ConUaIx,s,j,k)
+							* dAuxDataNode(ConUaIx,s,j,k)
 							* dDxBasis1D(s,i);
 
 						dDbJThetaUb +=
-							m_dLocalJacobian(i,s,k)
+							dLocalJacobian(i,s,k)
 							* dataInitialNode(PIx,iA,iElementB+s,k)
-							* m_dAuxDataNode(ConUbIx,i,s,k)
+							* dAuxDataNode(ConUbIx,i,s,k)
 							* dDxBasis1D(s,j);
 					}
 
@@ -1485,11 +1612,11 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #pragma unroll
 					for (int s = 0; s < nHorizontalOrder; s++) {
 						dDaTracerFluxA -=
-							m_dAlphaTracerFlux(c,s,j,k)
+							dAlphaTracerFlux(c,s,j,k)
 							* dStiffness1D(i,s);
 
 						dDbTracerFluxB -=
-							m_dBetaTracerFlux(c,i,s,k)
+							dBetaTracerFlux(c,i,s,k)
 							* dStiffness1D(j,s);
 					}
 
@@ -1504,22 +1631,22 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 
 #if defined(FIX_ELEMENT_MASS_NONHYDRO)
 				// Integrate element mass fluxes
-				m_dElementMassFluxA[k] +=
+				dElementMassFluxA[k] +=
 					dInvJacobian
 					* dDaRhoFluxA
 					* dElementAreaNode(iA,iB,k);
 
-				m_dElementMassFluxB[k] +=
+				dElementMassFluxB[k] +=
 					dInvJacobian
 					* dDbRhoFluxB
 					* dElementAreaNode(iA,iB,k);
 
-				m_dElTotalArea[k] +=
+				dElTotalArea[k] +=
 					dElementAreaNode(iA,iB,k);
 
 				// Store the local element fluxes
-				m_dAlphaElMassFlux(i,j,k) = dDaRhoFluxA;
-				m_dBetaElMassFlux(i,j,k) = dDbRhoFluxB;
+				dAlphaElMassFlux(i,j,k) = dDaRhoFluxA;
+				dBetaElMassFlux(i,j,k) = dDbRhoFluxB;
 #endif
 			}
 			}
@@ -1527,8 +1654,8 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 #if defined(FIX_ELEMENT_MASS_NONHYDRO)
 			// Apply mass fixer
 			for (int k = 0; k < nRElements; k++) {
-				m_dElementMassFluxA[k] /= m_dElTotalArea[k];
-				m_dElementMassFluxB[k] /= m_dElTotalArea[k];
+				dElementMassFluxA[k] /= dElTotalArea[k];
+				dElementMassFluxB[k] /= dElTotalArea[k];
 			}
 
 			for (int i = 0; i < nHorizontalOrder; i++) {
@@ -1539,20 +1666,20 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 				const int iB = iElementB + j;
 
 				const double dInvJacobian =
-					1.0 / m_dLocalJacobian(i,j,k);
+					1.0 / dLocalJacobian(i,j,k);
 				const double dJacobian =
-					m_dLocalJacobian(i,j,k);
+					dLocalJacobian(i,j,k);
 
-				m_dAlphaElMassFlux(i,j,k) -=
-					dJacobian * m_dElementMassFluxA[k];
-				m_dBetaElMassFlux(i,j,k) -=
-					dJacobian * m_dElementMassFluxB[k];
+				dAlphaElMassFlux(i,j,k) -=
+					dJacobian * dElementMassFluxA[k];
+				dBetaElMassFlux(i,j,k) -=
+					dJacobian * dElementMassFluxB[k];
 
 				// Update density on model levels
 				dataUpdateNode(RIx,iA,iB,k) -=
 					dDeltaT * dInvJacobian * (
-						  m_dAlphaElMassFlux(i,j,k)
-						+ m_dBetaElMassFlux(i,j,k));
+						  dAlphaElMassFlux(i,j,k)
+						+ dBetaElMassFlux(i,j,k));
 			}
 			}
 			}
@@ -1598,7 +1725,7 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					// Interpolate U cross Zeta to interfaces
 					const double dUCrossZetaX =
 						pGrid->InterpolateNodeToREdge(
-							&(m_dAuxDataNode(UCrossZetaXIx,i,j,0)),
+							&(dAuxDataNode(UCrossZetaXIx,i,j,0)),
 							NULL, k, 0.0, 1); 
 
 					// Calculate vertical velocity update
@@ -1626,12 +1753,12 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					const double dCovUx = dataInitialREdge(WIx,iA,iB,k);
 
 					// Contravariant velocities on interfaces
-					m_dAuxDataREdge(ConUaIx,i,j,k) =
+					dAuxDataREdge(ConUaIx,i,j,k) =
 						  dContraMetricAREdge(iA,iB,k,0) * dCovUa
 						+ dContraMetricAREdge(iA,iB,k,1) * dCovUb
 						+ dContraMetricAREdge(iA,iB,k,2) * dCovUx;
 
-					m_dAuxDataREdge(ConUbIx,i,j,k) =
+					dAuxDataREdge(ConUbIx,i,j,k) =
 						  dContraMetricBREdge(iA,iB,k,0) * dCovUa
 						+ dContraMetricBREdge(iA,iB,k,1) * dCovUb
 						+ dContraMetricBREdge(iA,iB,k,2) * dCovUx;
@@ -1666,8 +1793,8 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					dDbTheta *= dInvElementDeltaB;
 
 					// Update Theta on interfaces
-					const double dConUa = m_dAuxDataREdge(ConUaIx,i,j,k);
-					const double dConUb = m_dAuxDataREdge(ConUbIx,i,j,k);
+					const double dConUa = dAuxDataREdge(ConUaIx,i,j,k);
+					const double dConUb = dAuxDataREdge(ConUbIx,i,j,k);
 
 					dataUpdateREdge(PIx,iA,iB,k) -=
 						dDeltaT * (dConUa * dDaTheta + dConUb * dDbTheta);
@@ -1684,24 +1811,24 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 					for (int s = 0; s < nHorizontalOrder; s++) {
 						dDaJUa +=
 							dJacobianREdge(iElementA+s,iB,k)
-							* m_dAuxDataREdge(ConUaIx,s,j,k)
+							* dAuxDataREdge(ConUaIx,s,j,k)
 							* dDxBasis1D(s,i);
 
 						dDbJUb +=
 							dJacobianREdge(iA,iElementB+s,k)
-							* m_dAuxDataREdge(ConUbIx,i,s,k)
+							* dAuxDataREdge(ConUbIx,i,s,k)
 							* dDxBasis1D(s,j);
 
 						dDaJThetaUa +=
 							dJacobianREdge(iElementA+s,iB,k)
 							* dataInitialREdge(PIx,iElementA+s,iB,k)
-							* m_dAuxDataREdge(ConUaIx,s,j,k)
+							* dAuxDataREdge(ConUaIx,s,j,k)
 							* dDxBasis1D(s,i);
 
 						dDbJThetaUb +=
 							dJacobianREdge(iA,iElementB+s,k)
 							* dataInitialREdge(PIx,iA,iElementB+s,k)
-							* m_dAuxDataREdge(ConUbIx,i,s,k)
+							* dAuxDataREdge(ConUbIx,i,s,k)
 							* dDxBasis1D(s,j);
 					}
 
@@ -1728,7 +1855,6 @@ void HorizontalDynamicsFEM::StepNonhydrostaticPrimitive(
 			}
 #endif
 		}
-		}
 	}
 }
 
@@ -1739,6 +1865,27 @@ void HorizontalDynamicsFEM::StepExplicit(
 	int iDataUpdate,
 	const Time & time,
 	double dDeltaT
+) {
+	StepExplicitSubset(
+		iDataInitial, iDataUpdate, time, dDeltaT, ElementSubset_All);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool HorizontalDynamicsFEM::SupportsElementSubsets() const {
+	const EquationSet & eqn = m_model.GetEquationSet();
+
+	return (eqn.GetType() == EquationSet::PrimitiveNonhydrostaticEquations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void HorizontalDynamicsFEM::StepExplicitSubset(
+	int iDataInitial,
+	int iDataUpdate,
+	const Time & time,
+	double dDeltaT,
+	ElementSubset eSubset
 ) {
 	if (iDataInitial == iDataUpdate) {
 		_EXCEPTIONT(
@@ -1753,10 +1900,15 @@ void HorizontalDynamicsFEM::StepExplicit(
 
 	// Step the primitive nonhydrostatic equations
 	if (eqn.GetType() == EquationSet::PrimitiveNonhydrostaticEquations) {
-		StepNonhydrostaticPrimitive(iDataInitial, iDataUpdate, time, dDeltaT);
+		StepNonhydrostaticPrimitive(
+			iDataInitial, iDataUpdate, time, dDeltaT, eSubset);
 
 	// Step the shallow water equations
 	} else if (eqn.GetType() == EquationSet::ShallowWaterEquations) {
+		if (eSubset != ElementSubset_All) {
+			_EXCEPTIONT("Element subsets not supported for "
+				"ShallowWaterEquations");
+		}
 		StepShallowWater(iDataInitial, iDataUpdate, time, dDeltaT);
 
 	// Invalid EquationSet
@@ -1773,7 +1925,8 @@ void HorizontalDynamicsFEM::StepExplicit(
 			dDeltaT,
 			- pGrid->GetVectorUniformDiffusionCoeff(),
 			- pGrid->GetVectorUniformDiffusionCoeff(),
-			false);
+			false,
+			eSubset);
 
 		ApplyVectorHyperdiffusion(
 			DATA_INDEX_REFERENCE,
@@ -1781,7 +1934,8 @@ void HorizontalDynamicsFEM::StepExplicit(
 			dDeltaT,
 			pGrid->GetVectorUniformDiffusionCoeff(),
 			pGrid->GetVectorUniformDiffusionCoeff(),
-			false);
+			false,
+			eSubset);
 
 		if (eqn.GetType() == EquationSet::PrimitiveNonhydrostaticEquations) {
 
@@ -1793,7 +1947,8 @@ void HorizontalDynamicsFEM::StepExplicit(
 				pGrid->GetScalarUniformDiffusionCoeff(),
 				false,
 				2,
-				true);
+				true,
+				eSubset);
 
 			// Uniform diffusion of W with vector diffusion coeff
 			ApplyScalarHyperdiffusion(
@@ -1803,13 +1958,14 @@ void HorizontalDynamicsFEM::StepExplicit(
 				pGrid->GetVectorUniformDiffusionCoeff(),
 				false,
 				3,
-				true);
+				true,
+				eSubset);
 		}
 	}
 #endif
 
 	// Apply positive definite filter to tracers
-	FilterNegativeTracers(iDataUpdate);
+	FilterNegativeTracers(iDataUpdate, eSubset);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1821,7 +1977,35 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 	double dNu,
 	bool fScaleNuLocally,
 	int iComponent,
-	bool fRemoveRefState
+	bool fRemoveRefState,
+	ElementSubset eSubset
+) {
+#if defined(FIXED_HORIZONTAL_ORDER)
+	if (m_nHorizontalOrder != FIXED_HORIZONTAL_ORDER) {
+		_EXCEPTIONT("Command line order must match FIXED_HORIZONTAL_ORDER");
+	}
+	ApplyScalarHyperdiffusionOrder<FIXED_HORIZONTAL_ORDER>(
+		iDataInitial, iDataUpdate, dDeltaT, dNu, fScaleNuLocally,
+		iComponent, fRemoveRefState, eSubset);
+#else
+	DISPATCH_FIXED_ORDER_KERNEL(m_nHorizontalOrder, ApplyScalarHyperdiffusionOrder,
+		iDataInitial, iDataUpdate, dDeltaT, dNu, fScaleNuLocally,
+		iComponent, fRemoveRefState, eSubset);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <int NHorizontalOrder>
+void HorizontalDynamicsFEM::ApplyScalarHyperdiffusionOrder(
+	int iDataInitial,
+	int iDataUpdate,
+	double dDeltaT,
+	double dNu,
+	bool fScaleNuLocally,
+	int iComponent,
+	bool fRemoveRefState,
+	ElementSubset eSubset
 ) {
 	// Indices of EquationSet variables
 	const int UIx = 0;
@@ -1833,14 +2017,9 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
 
-#if defined(FIXED_HORIZONTAL_ORDER)
-	const int nHorizontalOrder = FIXED_HORIZONTAL_ORDER;
-	if (nHorizontalOrder != m_nHorizontalOrder) {
-		_EXCEPTIONT("Command line order must match FIXED_HORIZONTAL_ORDER");
-	}
-#else
-	const int nHorizontalOrder = m_nHorizontalOrder;
-#endif
+	// Horizontal order (compile-time constant unless NHorizontalOrder is 0)
+	const int nHorizontalOrder =
+		(NHorizontalOrder != 0)?(NHorizontalOrder):(m_nHorizontalOrder);
 
 #if defined(FIXED_RELEMENTS)
 	const int nRElements = FIXED_RELEMENTS;
@@ -1907,8 +2086,10 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 		const double dInvElementDeltaA = 1.0 / dElementDeltaA;
 		const double dInvElementDeltaB = 1.0 / dElementDeltaB;
 
-		const DataArray2D<double> & dDxBasis1D = pGrid->GetDxBasis1D();
-		const DataArray2D<double> & dStiffness1D = pGrid->GetStiffness1D();
+		const FixedOrderMatrix<NHorizontalOrder>
+			dDxBasis1D(pGrid->GetDxBasis1D());
+		const FixedOrderMatrix<NHorizontalOrder>
+			dStiffness1D(pGrid->GetStiffness1D());
 
 		// Number of finite elements
 		int nElementCountA = pPatch->GetElementCountA();
@@ -1988,9 +2169,46 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 					pJacobian = &dJacobianNode;
 				}
 
-				// Loop over all finite elements
-				for (int a = 0; a < nElementCountA; a++) {
-				for (int b = 0; b < nElementCountB; b++) {
+				// Loop over all finite elements in the subset, distributing
+				// them over the element workspaces
+				const int nThreads = m_vecElementWorkspaces.size() + 1;
+
+				std::vector<int> vecElements;
+				GetElementsInSubset(
+					eSubset, nElementCountA, nElementCountB, vecElements);
+
+				const int nElements = vecElements.size();
+
+#pragma omp parallel for schedule(static) num_threads(nThreads)
+				for (int ie = 0; ie < nElements; ie++) {
+
+					const int e = vecElements[ie];
+					const int a = e / nElementCountB;
+					const int b = e % nElementCountB;
+
+					int iThread = 0;
+#ifdef _OPENMP
+					iThread = omp_get_thread_num();
+#endif
+
+					// Element buffers of this thread
+					HorizontalDynamicsFEM * pWorkspace =
+						GetElementWorkspace(iThread);
+
+					DataArray2D<double> & dBufferState =
+						pWorkspace->m_dBufferState;
+					DataArray2D<double> & dJGradientA =
+						pWorkspace->m_dJGradientA;
+					DataArray2D<double> & dJGradientB =
+						pWorkspace->m_dJGradientB;
+
+#ifdef FIX_ELEMENT_MASS_NONHYDRO
+					DataArray3D<double> & dAlphaElMassFlux =
+						pWorkspace->m_dAlphaElMassFlux;
+					DataArray3D<double> & dBetaElMassFlux =
+						pWorkspace->m_dBetaElMassFlux;
+#endif
+
 				for (int k = 0; k < nElementCountR; k++) {
 
 					int iElementA =
@@ -2004,7 +2222,7 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 						int iA = iElementA + i;
 						int iB = iElementB + j;
 
-						m_dBufferState(i,j) =
+						dBufferState(i,j) =
 							(*pDataInitial)(c,iA,iB,k);
 					}
 					}
@@ -2016,7 +2234,7 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 							int iA = iElementA + i;
 							int iB = iElementB + j;
 
-							m_dBufferState(i,j) -=
+							dBufferState(i,j) -=
 								(*pDataRef)(c,iA,iB,k);
 						}
 						}
@@ -2034,23 +2252,23 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 #pragma unroll
 						for (int s = 0; s < nHorizontalOrder; s++) {
 							dDaPsi +=
-								m_dBufferState(s,j)
+								dBufferState(s,j)
 								* dDxBasis1D(s,i);
 
 							dDbPsi +=
-								m_dBufferState(i,s)
+								dBufferState(i,s)
 								* dDxBasis1D(s,j);
 						}
 
 						dDaPsi *= dInvElementDeltaA;
 						dDbPsi *= dInvElementDeltaB;
 
-						m_dJGradientA(i,j) =
+						dJGradientA(i,j) =
 							(*pJacobian)(iA,iB,k) * (
 								+ dContraMetricA(iA,iB,0) * dDaPsi
 								+ dContraMetricA(iA,iB,1) * dDbPsi);
 
-						m_dJGradientB(i,j) =
+						dJGradientB(i,j) =
 							(*pJacobian)(iA,iB,k) * (
 								+ dContraMetricB(iA,iB,0) * dDaPsi
 								+ dContraMetricB(iA,iB,1) * dDbPsi);
@@ -2078,11 +2296,11 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 #pragma unroll
 						for (int s = 0; s < nHorizontalOrder; s++) {
 							dUpdateA +=
-								m_dJGradientA(s,j)
+								dJGradientA(s,j)
 								* dStiffness1D(i,s);
 
 							dUpdateB +=
-								m_dJGradientB(i,s)
+								dJGradientB(i,s)
 								* dStiffness1D(j,s);
 						}
 
@@ -2100,8 +2318,8 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 								dElTotalArea += dElementAreaNode(iA,iB,k);
 
 								// Store the local element fluxes
-								m_dAlphaElMassFlux(i,j,k) = dUpdateA;
-								m_dBetaElMassFlux(i,j,k) = dUpdateB;
+								dAlphaElMassFlux(i,j,k) = dUpdateA;
+								dBetaElMassFlux(i,j,k) = dUpdateB;
 							} else {
 								// Apply update
 								(*pDataUpdate)(c,iA,iB,k) -=
@@ -2132,21 +2350,20 @@ void HorizontalDynamicsFEM::ApplyScalarHyperdiffusion(
 							const double dInvJacobian = 1.0 / (*pJacobian)(iA,iB,k);
 							const double dJacobian = (*pJacobian)(iA,iB,k);
 
-							m_dAlphaElMassFlux(i,j,k) -= dJacobian * dMassFluxPerNodeA;
-							m_dBetaElMassFlux(i,j,k) -= dJacobian * dMassFluxPerNodeB;
+							dAlphaElMassFlux(i,j,k) -= dJacobian * dMassFluxPerNodeA;
+							dBetaElMassFlux(i,j,k) -= dJacobian * dMassFluxPerNodeB;
 
 							// Update fixed density on model levels
 							(*pDataUpdate)(c,iA,iB,k) -=
 								dDeltaT * dInvJacobian * dLocalNu *
-									(m_dAlphaElMassFlux(i,j,k)
-									+ m_dBetaElMassFlux(i,j,k));
+									(dAlphaElMassFlux(i,j,k)
+									+ dBetaElMassFlux(i,j,k));
 						}
 						}
 					}
 #endif
 				}
 				}
-				}
 			}
 		}
 	}
@@ -2160,7 +2377,34 @@ void HorizontalDynamicsFEM::ApplyVectorHyperdiffusion(
 	double dDeltaT,
 	double dNuDiv,
 	double dNuVort,
-	bool fScaleNuLocally
+	bool fScaleNuLocally,
+	ElementSubset eSubset
+) {
+#if defined(FIXED_HORIZONTAL_ORDER)
+	if (m_nHorizontalOrder != FIXED_HORIZONTAL_ORDER) {
+		_EXCEPTIONT("Command line order must match FIXED_HORIZONTAL_ORDER");
+	}
+	ApplyVectorHyperdiffusionOrder<FIXED_HORIZONTAL_ORDER>(
+		iDataInitial, iDataUpdate, dDeltaT, dNuDiv, dNuVort,
+		fScaleNuLocally, eSubset);
+#else
+	DISPATCH_FIXED_ORDER_KERNEL(m_nHorizontalOrder, ApplyVectorHyperdiffusionOrder,
+		iDataInitial, iDataUpdate, dDeltaT, dNuDiv, dNuVort,
+		fScaleNuLocally, eSubset);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <int NHorizontalOrder>
+void HorizontalDynamicsFEM::ApplyVectorHyperdiffusionOrder(
+	int iDataInitial,
+	int iDataUpdate,
+	double dDeltaT,
+	double dNuDiv,
+	double dNuVort,
+	bool fScaleNuLocally,
+	ElementSubset eSubset
 ) {
 	// Variable indices
 	const int UIx = 0;
@@ -2178,14 +2422,9 @@ void HorizontalDynamicsFEM::ApplyVectorHyperdiffusion(
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
 
-#if defined(FIXED_HORIZONTAL_ORDER)
-	const int nHorizontalOrder = FIXED_HORIZONTAL_ORDER;
-	if (nHorizontalOrder != m_nHorizontalOrder) {
-		_EXCEPTIONT("Command line order must match FIXED_HORIZONTAL_ORDER");
-	}
-#else
-	const int nHorizontalOrder = m_nHorizontalOrder;
-#endif
+	// Horizontal order (compile-time constant unless NHorizontalOrder is 0)
+	const int nHorizontalOrder =
+		(NHorizontalOrder != 0)?(NHorizontalOrder):(m_nHorizontalOrder);
 
 #if defined(FIXED_RELEMENTS)
 	const int nRElements = FIXED_RELEMENTS;
@@ -2233,8 +2472,10 @@ void HorizontalDynamicsFEM::ApplyVectorHyperdiffusion(
 		const double dInvElementDeltaA = 1.0 / dElementDeltaA;
 		const double dInvElementDeltaB = 1.0 / dElementDeltaB;
 
-		const DataArray2D<double> & dDxBasis1D = pGrid->GetDxBasis1D();
-		const DataArray2D<double> & dStiffness1D = pGrid->GetStiffness1D();
+		const FixedOrderMatrix<NHorizontalOrder>
+			dDxBasis1D(pGrid->GetDxBasis1D());
+		const FixedOrderMatrix<NHorizontalOrder>
+			dStiffness1D(pGrid->GetStiffness1D());
 
 		// Compute curl and divergence of U on the grid
 		DataArray3D<double> dataUa;
@@ -2290,9 +2531,22 @@ void HorizontalDynamicsFEM::ApplyVectorHyperdiffusion(
 		int nElementCountA = pPatch->GetElementCountA();
 		int nElementCountB = pPatch->GetElementCountB();
 
-		// Loop over all finite elements
-		for (int a = 0; a < nElementCountA; a++) {
-		for (int b = 0; b < nElementCountB; b++) {
+		// Loop over all finite elements in the subset
+		const int nThreads = m_vecElementWorkspaces.size() + 1;
+
+		std::vector<int> vecElements;
+		GetElementsInSubset(
+			eSubset, nElementCountA, nElementCountB, vecElements);
+
+		const int nElements = vecElements.size();
+
+#pragma omp parallel for schedule(static) num_threads(nThreads)
+		for (int ie = 0; ie < nElements; ie++) {
+
+			const int e = vecElements[ie];
+			const int a = e / nElementCountB;
+			const int b = e % nElementCountB;
+
 		for (int k = 0; k < nRElements; k++) {
 
 			const int iElementA = a * nHorizontalOrder + box.GetHaloElements();
@@ -2359,7 +2613,6 @@ void HorizontalDynamicsFEM::ApplyVectorHyperdiffusion(
 			}
 		}
 		}
-		}
 	}
 }
 
@@ -2592,7 +2845,9 @@ void HorizontalDynamicsFEM::StepAfterSubCycle(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("StepAfterSubCycle");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("StepAfterSubCycle");
+	FunctionTimer timer(s_idTimer);
 
 	// Check indices
 	if (iDataInitial == iDataWorking) {
@@ -23,6 +23,8 @@
 #include "DataArray3D.h"
 #include "DataArray4D.h"
 
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////
 
 class Time;
@@ -49,6 +51,11 @@ public:
 		double dInstepNuDiv
 	);
 
+	///	<summary>
+	///		Destructor.
+	///	</summary>
+	virtual ~HorizontalDynamicsFEM();
+
 	///	<summary>
 	///		Initializer.
 	///	</summary>
@@ -67,7 +74,8 @@ public:
 	///		Apply a positive definite filter to all tracers.
 	///	</summary>
 	void FilterNegativeTracers(
-		int iDataUpdate
+		int iDataUpdate,
+		ElementSubset eSubset = ElementSubset_All
 	);
 
 	///	<summary>
@@ -83,13 +91,29 @@ public:
 
 	///	<summary>
 	///		Perform one horizontal Forward Euler step for the interior terms of
-	///		the non-hydrostatic primitive equations.
+	///		the non-hydrostatic primitive equations.  The element kernel is
+	///		dispatched on the horizontal order.
 	///	</summary>
 	void StepNonhydrostaticPrimitive(
 		int iDataInitial,
 		int iDataUpdate,
 		const Time & time,
-		double dDeltaT
+		double dDeltaT,
+		ElementSubset eSubset = ElementSubset_All
+	);
+
+protected:
+	///	<summary>
+	///		Element kernel of StepNonhydrostaticPrimitive with compile-time
+	///		horizontal order, or the runtime order if NHorizontalOrder is 0.
+	///	</summary>
+	template <int NHorizontalOrder>
+	void StepNonhydrostaticPrimitiveOrder(
+		int iDataInitial,
+		int iDataUpdate,
+		const Time & time,
+		double dDeltaT,
+		ElementSubset eSubset
 	);
 
 public:
@@ -103,6 +127,24 @@ public:
 		double dDeltaT
 	);
 
+	///	<summary>
+	///		Explicit steps on a subset of elements are supported for the
+	///		primitive nonhydrostatic equations.
+	///	</summary>
+	virtual bool SupportsElementSubsets() const;
+
+	///	<summary>
+	///		Perform one horizontal Forward Euler step on a subset of the
+	///		elements on each patch.
+	///	</summary>
+	virtual void StepExplicitSubset(
+		int iDataInitial,
+		int iDataUpdate,
+		const Time & time,
+		double dDeltaT,
+		ElementSubset eSubset
+	);
+
 protected:
 	///	<summary>
 	///		Apply the scalar Laplacian operator.
@@ -114,7 +156,24 @@ protected:
 		double dNu,
 		bool fScaleNuLocally,
 		int iComponent = (-1),
-		bool fRemoveRefState = false
+		bool fRemoveRefState = false,
+		ElementSubset eSubset = ElementSubset_All
+	);
+
+	///	<summary>
+	///		Apply the scalar Laplacian operator with compile-time horizontal
+	///		order, or the runtime order if NHorizontalOrder is 0.
+	///	</summary>
+	template <int NHorizontalOrder>
+	void ApplyScalarHyperdiffusionOrder(
+		int iDataInitial,
+		int iDataUpdate,
+		double dDeltaT,
+		double dNu,
+		bool fScaleNuLocally,
+		int iComponent,
+		bool fRemoveRefState,
+		ElementSubset eSubset
 	);
 
 	///	<summary>
@@ -126,7 +185,23 @@ protected:
 		double dDeltaT,
 		double dNuDiff,
 		double dNuVort,
-		bool fScaleNuLocally
+		bool fScaleNuLocally,
+		ElementSubset eSubset = ElementSubset_All
+	);
+
+	///	<summary>
+	///		Apply the vector Laplacian operator with compile-time horizontal
+	///		order, or the runtime order if NHorizontalOrder is 0.
+	///	</summary>
+	template <int NHorizontalOrder>
+	void ApplyVectorHyperdiffusionOrder(
+		int iDataInitial,
+		int iDataUpdate,
+		double dDeltaT,
+		double dNuDiff,
+		double dNuVort,
+		bool fScaleNuLocally,
+		ElementSubset eSubset
 	);
 
 	///	<summary>
@@ -284,6 +359,23 @@ protected:
 	///	</summary>
 	DataArray4D<double> m_dLocalContraMetric;
 
+protected:
+	///	<summary>
+	///		Get an element workspace.  Workspace 0 is this object.
+	///	</summary>
+	HorizontalDynamicsFEM * GetElementWorkspace(int iWorkspace) {
+		if (iWorkspace == 0) {
+			return this;
+		}
+		return m_vecElementWorkspaces[iWorkspace-1];
+	}
+
+	///	<summary>
+	///		Element workspaces other than this object used in the threaded
+	///		element loops.
+	///	</summary>
+	std::vector<HorizontalDynamicsFEM *> m_vecElementWorkspaces;
+
 protected:
 	///	<summary>
 	///		Viscosity / hyperviscosity order.
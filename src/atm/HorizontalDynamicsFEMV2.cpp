@@ -24,6 +24,7 @@
 #include "Announce.h"
 #include "GridGLL.h"
 #include "GridPatchGLL.h"
+#include "FixedOrderMatrix.h"
 
 //#define DIFFERENTIAL_FORM
 
@@ -594,7 +595,9 @@ void HorizontalDynamicsFEMV2::StepNonhydrostaticPrimitive(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("HorizontalStepNonhydrostaticPrimitive");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("HorizontalStepNonhydrostaticPrimitive");
+	FunctionTimer timer(s_idTimer);
 
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
@@ -710,8 +713,10 @@ void HorizontalDynamicsFEMV2::StepNonhydrostaticPrimitive(
 		const double dInvElementDeltaA = 1.0 / dElementDeltaA;
 		const double dInvElementDeltaB = 1.0 / dElementDeltaB;
 
-		const DataArray2D<double> & dDxBasis1D = pGrid->GetDxBasis1D();
-		const DataArray2D<double> & dStiffness1D = pGrid->GetStiffness1D();
+		const FixedOrderMatrix<nHorizontalOrder>
+			dDxBasis1D(pGrid->GetDxBasis1D());
+		const FixedOrderMatrix<nHorizontalOrder>
+			dStiffness1D(pGrid->GetStiffness1D());
 
 		// Get number of finite elements in each coordinate direction
 		const int nElementCountA = pPatch->GetElementCountA();
@@ -1571,8 +1576,10 @@ void HorizontalDynamicsFEMV2::ApplyVectorHyperdiffusion(
 		const double dInvElementDeltaA = 1.0 / dElementDeltaA;
 		const double dInvElementDeltaB = 1.0 / dElementDeltaB;
 
-		const DataArray2D<double> & dDxBasis1D = pGrid->GetDxBasis1D();
-		const DataArray2D<double> & dStiffness1D = pGrid->GetStiffness1D();
+		const FixedOrderMatrix<nHorizontalOrder>
+			dDxBasis1D(pGrid->GetDxBasis1D());
+		const FixedOrderMatrix<nHorizontalOrder>
+			dStiffness1D(pGrid->GetStiffness1D());
 
 		// Compute new hyperviscosity coefficient
 		double dLocalNuDiv  = dNuDiv;
@@ -1951,7 +1958,9 @@ void HorizontalDynamicsFEMV2::StepAfterSubCycle(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("StepAfterSubCycle");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("StepAfterSubCycle");
+	FunctionTimer timer(s_idTimer);
 
 	// Check indices
 	if (iDataInitial == iDataWorking) {
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    InterpStencil.h
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _INTERPSTENCIL_H_
+#define _INTERPSTENCIL_H_
+
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Horizontal interpolation stencils from the nodes of one GridPatch
+///		to the points of a fixed point set that lie on the patch.  The
+///		value at each point is a tensor product of Lagrange polynomial
+///		coefficients applied to the nodes of a single finite element.
+///	</summary>
+class PatchInterpStencil {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	PatchInterpStencil() :
+		m_ixPatch(-1)
+	{ }
+
+	///	<summary>
+	///		Number of points interpolated from this patch.
+	///	</summary>
+	int GetPointCount() const {
+		return static_cast<int>(m_vecPoint.size());
+	}
+
+public:
+	///	<summary>
+	///		Index of the patch.
+	///	</summary>
+	int m_ixPatch;
+
+	///	<summary>
+	///		Index of each point in the interpolated data array.
+	///	</summary>
+	std::vector<int> m_vecPoint;
+
+	///	<summary>
+	///		Alpha coordinate of each point.
+	///	</summary>
+	std::vector<double> m_vecAlpha;
+
+	///	<summary>
+	///		Beta coordinate of each point.
+	///	</summary>
+	std::vector<double> m_vecBeta;
+
+	///	<summary>
+	///		Alpha index of the first node of the element containing each
+	///		point (including halo nodes).
+	///	</summary>
+	std::vector<int> m_vecNodeA;
+
+	///	<summary>
+	///		Beta index of the first node of the element containing each
+	///		point (including halo nodes).
+	///	</summary>
+	std::vector<int> m_vecNodeB;
+
+	///	<summary>
+	///		Interpolation coefficients of each point, stored as
+	///		(order x order) blocks with the beta index varying fastest.
+	///	</summary>
+	std::vector<double> m_vecCoeff;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Interpolation stencils from all active patches on this processor
+///		to a fixed point set, along with the processor that owns each
+///		point.  Built by Grid::InitializeInterpStencil() and applied by
+///		Grid::ReduceInterpolate().
+///	</summary>
+class GridInterpStencil {
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	GridInterpStencil() :
+		m_iGridStamp(-1),
+		m_nLocalPoints(0)
+	{ }
+
+public:
+	///	<summary>
+	///		Grid stamp at the time the stencils were built.
+	///	</summary>
+	int m_iGridStamp;
+
+	///	<summary>
+	///		Number of points interpolated on this processor.
+	///	</summary>
+	int m_nLocalPoints;
+
+	///	<summary>
+	///		Processor that owns each point, or (-1) if no patch contains it.
+	///	</summary>
+	std::vector<int> m_vecPointProcessor;
+
+	///	<summary>
+	///		Number of points owned by each processor.
+	///	</summary>
+	std::vector<int> m_vecPointCount;
+
+	///	<summary>
+	///		Stencils for each active patch, in order of active patches.
+	///	</summary>
+	std::vector<PatchInterpStencil> m_vecPatchStencils;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -1718,9 +1718,6 @@ void LinearColumnDiscPenaltyFEM::Initialize(
 			iRightPenaltyEnd[ax + i] = (a+1) * nVerticalOrder;
 		}
 	}
-
-	// Allocate buffer array
-	m_dBuffer.Allocate(dREtaNode.GetRows());
 /*
 	// DEBUGGING
 	m_opLeft.DebugOutput(&dREtaNode, &dREtaREdge, "L", false);
@@ -1848,9 +1845,6 @@ void LinearColumnDiscPenaltyFEM::InitializeReconstructed(
 			dRightPenaltyCoeff[k][j] /= dDeltaVolume;
 		}
 	}
-
-	// Allocate buffer array
-	m_dBuffer.Allocate(dREtaNode.GetRows());
 /*
 	// DEBUGGING
 	m_opLeft.DebugOutput(&dREtaNode, &dREtaREdge, "L", false);
@@ -1868,20 +1862,22 @@ void LinearColumnDiscPenaltyFEM::Apply(
 	int nStrideOut
 ) const {
 	// Apply distribution of penalty to left of finite element edge
-	m_opLeft.Apply(dDataIn, &(m_dBuffer[0]), nStrideIn, 1);
+	// (evaluated level-by-level so that Apply is safe to call from
+	// multiple threads)
 	for (int a = 0; a < m_nRFiniteElements-1; a++) {
 		int ax = a * m_nVerticalOrder;
 		for (int i = 0; i < m_nVerticalOrder; i++) {
-			dDataOut[(ax+i)*nStrideOut] += m_dBuffer[ax+i] * dWeight[a];
+			dDataOut[(ax+i)*nStrideOut] +=
+				m_opLeft.Apply(dDataIn, ax+i, nStrideIn) * dWeight[a];
 		}
 	}
 
 	// Apply distribution of penalty to right of finite element edge
-	m_opRight.Apply(dDataIn, &(m_dBuffer[0]), nStrideIn, 1);
 	for (int a = 1; a < m_nRFiniteElements; a++) {
 		int ax = a * m_nVerticalOrder;
 		for (int i = 0; i < m_nVerticalOrder; i++) {
-			dDataOut[(ax+i)*nStrideOut] += m_dBuffer[ax+i] * dWeight[a-1];
+			dDataOut[(ax+i)*nStrideOut] +=
+				m_opRight.Apply(dDataIn, ax+i, nStrideIn) * dWeight[a-1];
 		}
 	}
 }
@@ -309,11 +309,6 @@ private:
 	///	</summary>
 	LinearColumnOperator m_opRight;
 
-	///	<summary>
-	///		Buffer array.
-	///	</summary>
-	mutable DataArray1D<double> m_dBuffer;
-
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17,6 +17,7 @@
 #include "Model.h"
 
 #include "Grid.h"
+#include "GridGLL.h"
 #include "TestCase.h"
 #include "OutputManager.h"
 #include "OutputManagerComposite.h"
@@ -33,13 +34,19 @@ Model::Model(
 	EquationSet::Type eEquationSetType
 ) :
 	m_fGridFromRestartFile(false),
+	m_fGridRepartitioned(false),
 	m_pGrid(NULL),
 	m_pTimestepScheme(NULL),
 	m_pHorizontalDynamics(NULL),
 	m_pVerticalDynamics(NULL),
 	m_pTestCase(NULL),
 	m_eqn(eEquationSetType),
-	m_time()
+	m_time(),
+	m_nRebalanceSteps(0),
+	m_dCourantNumber(0.0),
+	m_eProfileFormat(FunctionTimer::ReportFormat_CSV),
+	m_ePerformanceLogFormat(PerformanceLog::Format_CSV),
+	m_nPerformanceLogWindow(10)
 {
 }
 
@@ -49,6 +56,7 @@ Model::Model(
 	const EquationSet & eqn
 ) :
 	m_fGridFromRestartFile(false),
+	m_fGridRepartitioned(false),
 	m_pGrid(NULL),
 	m_pTimestepScheme(NULL),
 	m_pHorizontalDynamics(NULL),
@@ -56,7 +64,12 @@ Model::Model(
 	m_pTestCase(NULL),
 	m_eqn(eqn),
 	m_metaUserData(),
-	m_time()
+	m_time(),
+	m_nRebalanceSteps(0),
+	m_dCourantNumber(0.0),
+	m_eProfileFormat(FunctionTimer::ReportFormat_CSV),
+	m_ePerformanceLogFormat(PerformanceLog::Format_CSV),
+	m_nPerformanceLogWindow(10)
 {
 }
 
@@ -67,6 +80,7 @@ Model::Model(
 	const UserDataMeta & metaUserData
 ) :
 	m_fGridFromRestartFile(false),
+	m_fGridRepartitioned(false),
 	m_pGrid(NULL),
 	m_pTimestepScheme(NULL),
 	m_pHorizontalDynamics(NULL),
@@ -74,7 +88,12 @@ Model::Model(
 	m_pTestCase(NULL),
 	m_eqn(eqn),
 	m_metaUserData(metaUserData),
-	m_time()
+	m_time(),
+	m_nRebalanceSteps(0),
+	m_dCourantNumber(0.0),
+	m_eProfileFormat(FunctionTimer::ReportFormat_CSV),
+	m_ePerformanceLogFormat(PerformanceLog::Format_CSV),
+	m_nPerformanceLogWindow(10)
 {
 }
 
@@ -147,7 +166,8 @@ void Model::SetGrid(
 
 void Model::SetGridFromRestartFile(
 	Grid * pGrid,
-	const std::string & strRestartFile
+	const std::string & strRestartFile,
+	int nPatchCount
 ) {
 	if (pGrid == NULL) {
 		_EXCEPTIONT("Invalid Grid (NULL)");
@@ -159,11 +179,23 @@ void Model::SetGridFromRestartFile(
 	// Attach the grid
 	m_pGrid = pGrid;
 
+	// Number of patches in the Grid, which may differ from the number
+	// of patches in the restart file
+#ifdef TEMPEST_MPIOMP
+	if (nPatchCount == (-1)) {
+		MPI_Comm_size(MPI_COMM_WORLD, &nPatchCount);
+	}
+#endif
+
 	// Load the Grid data from the file
 	OutputManagerComposite ompComposite(*m_pGrid, Time(), "", "", "");
 
+	ompComposite.SetInputPatchCount(nPatchCount);
+
 	m_time = ompComposite.Input(strRestartFile);
 
+	m_fGridRepartitioned = ompComposite.IsRepartitioned();
+
 	m_timeStart = m_time;
 
 	// Initialize the grid
@@ -240,6 +272,12 @@ void Model::SetTestCase(
 
 		// Initialize the topography and data
 		m_pGrid->EvaluateTestCase(*pTestCase, m_timeStart);
+
+	// Geometric data is not carried over from a repartitioned restart
+	// file, so initialize the topography again.  The state from the
+	// file is kept by evaluating the test case into a buffer instance.
+	} else if (m_fGridRepartitioned) {
+		m_pGrid->EvaluateTestCase(*pTestCase, m_timeStart, 1);
 	}
 }
 
@@ -269,11 +307,80 @@ void Model::AttachWorkflowProcess(WorkflowProcess * pWorkflowProcess) {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+Time Model::ComputeAdaptiveDeltaT(
+	double dCourantNumber,
+	const Time & timePrevDeltaT
+) {
+	// The time step is only increased if the stable time step exceeds the
+	// previous time step by this fraction, so that small fluctuations do
+	// not invalidate data that depends on the time step size
+	static const double MinimumIncrease = 0.05;
+
+	// Maximum factor by which the time step may increase in one step
+	static const double MaximumIncrease = 1.2;
+
+	// Courant number for a time step of one second
+	double dUnitCourantNumber = m_pGrid->ComputeMaximumCourantNumber(0, 1.0);
+
+	double dDeltaT = DBL_MAX;
+	if (dUnitCourantNumber > 0.0) {
+		dDeltaT = dCourantNumber / dUnitCourantNumber;
+	}
+
+	// Limit changes relative to the previous time step
+	double dPrevDeltaT = timePrevDeltaT.GetSeconds();
+	if ((dPrevDeltaT > 0.0) && (dDeltaT > dPrevDeltaT)) {
+		if (dDeltaT < (1.0 + MinimumIncrease) * dPrevDeltaT) {
+			dDeltaT = dPrevDeltaT;
+		} else if (dDeltaT > MaximumIncrease * dPrevDeltaT) {
+			dDeltaT = MaximumIncrease * dPrevDeltaT;
+		}
+	}
+
+	// Apply bounds on the time step size
+	if ((!m_timeDeltaTMax.IsZero()) &&
+	    (dDeltaT > m_timeDeltaTMax.GetSeconds())
+	) {
+		dDeltaT = m_timeDeltaTMax.GetSeconds();
+	}
+	if (dDeltaT == DBL_MAX) {
+		_EXCEPTIONT("Stable time step size is unbounded: "
+			"Maximum time step size required");
+	}
+	if ((!m_timeDeltaTMin.IsZero()) &&
+	    (dDeltaT < m_timeDeltaTMin.GetSeconds())
+	) {
+		_EXCEPTION2("Stable time step size (%1.6es) is smaller than "
+			"the minimum time step size (%1.6es)",
+			dDeltaT, m_timeDeltaTMin.GetSeconds());
+	}
+
+	// Round down to the resolution of Time
+	long long lMicroSeconds = static_cast<long long>(dDeltaT * 1.0e6);
+	if (lMicroSeconds < 1) {
+		_EXCEPTION1("Stable time step size (%1.6es) is too small", dDeltaT);
+	}
+
+	return Time(
+		0, 0, 0,
+		static_cast<int>(lMicroSeconds / 1000000),
+		static_cast<int>(lMicroSeconds % 1000000),
+		timePrevDeltaT.GetCalendarType(),
+		Time::TypeDelta);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void Model::SubStep(
 	bool fFirstStep,
 	bool fLastStep,
 	int iSubStep
 ) {
+	// Check time step
+	if (m_timeDeltaT.IsZero()) {
+		_EXCEPTIONT("Adaptive time stepping not supported by SubStep");
+	}
+
 	// Next time step
 	double dDeltaT;
 
@@ -321,12 +428,44 @@ void Model::Go() {
 		_EXCEPTIONT("TestCase not specified.");
 	}
 
-	// Check time step
-	if (m_timeDeltaT.IsZero()) {
-		_EXCEPTIONT("Dynamic timestepping not implemented. "
-		            "DeltaT must be non-zero.");
+	// Adaptive time stepping is used if no time step size is specified
+	bool fAdaptiveDeltaT = m_timeDeltaT.IsZero();
+
+	double dCourantNumber = m_dCourantNumber;
+
+	if (fAdaptiveDeltaT) {
+		if (dCourantNumber == 0.0) {
+			GridGLL * pGridGLL = dynamic_cast<GridGLL*>(m_pGrid);
+			if (pGridGLL == NULL) {
+				_EXCEPTIONT("Logic error: Courant number required for "
+					"adaptive time stepping on non-GLL grid");
+			}
+			dCourantNumber =
+				m_pTimestepScheme->GetMaximumStableCourantNumber(
+					TimestepScheme::ContinuousPart,
+					pGridGLL->GetHorizontalOrder());
+		}
+		if (dCourantNumber <= 0.0) {
+			_EXCEPTIONT("Maximum stable Courant number not available for "
+				"TimestepScheme: Courant number required for adaptive "
+				"time stepping");
+		}
+		if ((!m_timeDeltaTMin.IsZero()) &&
+		    (!m_timeDeltaTMax.IsZero()) &&
+		    (m_timeDeltaTMax < m_timeDeltaTMin)
+		) {
+			_EXCEPTIONT("Maximum time step size must not be smaller than "
+				"minimum time step size");
+		}
+
+		Announce("Adaptive time stepping with Courant number %1.6f",
+			dCourantNumber);
 	}
 
+	// Size of the most recent adaptive time step
+	Time timeAdaptiveDeltaT(
+		m_timeDeltaT.GetCalendarType(), Time::TypeDelta);
+
 	// Evaluate geometric terms in the grid
 	// NOTE: This needs to be called after EvaluateTestCase, since it relies
 	// on information about topographic derivatives.
@@ -375,14 +514,39 @@ void Model::Go() {
 	bool fFirstStep = true;
 
 	// Reset the communication timer
-	FunctionTimer::ResetGroupTimeRecord("Communicate");
+	if (FunctionTimer::GetNumberOfEntries("Communicate") != 0) {
+		FunctionTimer::ResetGroupTimeRecord("Communicate");
+	}
+
+	// Reset the communication statistics
+	m_pGrid->GetExchangeStatistics().Reset();
+
+	// Loop and communication time accumulated since the last rebalance
+	unsigned long lRebalanceLoopTime = 0;
+	unsigned long lRebalanceCommTime =
+		FunctionTimer::GetTotalGroupTime("Communicate");
+
+	// Performance log of each time step
+	PerformanceLog perflog;
+	if (m_strPerformanceLogFile != "") {
+		perflog.Open(
+			m_strPerformanceLogFile,
+			m_ePerformanceLogFormat,
+			m_nPerformanceLogWindow);
+	}
 
 	// Loop
 	for(int iStep = 0;; iStep++) {
 
 		//PrintMemoryLine();
 
-		FunctionTimer timerLoop("Loop");
+		static const FunctionTimer::GroupId s_idTimerLoop =
+			FunctionTimer::RegisterGroup("Loop");
+		FunctionTimer timerLoop(s_idTimerLoop);
+
+		if (perflog.IsOpen()) {
+			perflog.BeginStep(m_pGrid->GetExchangeBufferRegistry());
+		}
 
 		// Last time step
 		bool fLastStep = false;
@@ -391,7 +555,42 @@ void Model::Go() {
 		double dDeltaT;
 
 		Time timeNext = m_time;
-		timeNext += m_timeDeltaT;
+
+		if (fAdaptiveDeltaT) {
+			timeAdaptiveDeltaT =
+				ComputeAdaptiveDeltaT(dCourantNumber, timeAdaptiveDeltaT);
+
+			timeNext += timeAdaptiveDeltaT;
+
+			// Shorten the time step to end at the next output or
+			// WorkflowProcess activation
+			for (int om = 0; om < m_vecOutMan.size(); om++) {
+				const Time & timeNextOutput =
+					m_vecOutMan[om]->GetNextOutputTime();
+
+				if ((!m_vecOutMan[om]->GetOutputFrequency().IsZero()) &&
+				    (timeNextOutput > m_time) &&
+				    (timeNextOutput < timeNext)
+				) {
+					timeNext = timeNextOutput;
+				}
+			}
+
+			for (int wfp = 0; wfp < m_vecWorkflowProcess.size(); wfp++) {
+				const Time & timeNextPerform =
+					m_vecWorkflowProcess[wfp]->GetNextPerformTime();
+
+				if ((!m_vecWorkflowProcess[wfp]->GetFrequency().IsZero()) &&
+				    (timeNextPerform > m_time) &&
+				    (timeNextPerform < timeNext)
+				) {
+					timeNext = timeNextPerform;
+				}
+			}
+
+		} else {
+			timeNext += m_timeDeltaT;
+		}
 
 		if (timeNext >= m_timeEnd) {
 			dDeltaT = m_timeEnd - m_time;
@@ -402,8 +601,19 @@ void Model::Go() {
 		}
 
 		// Perform one time step
-		Announce("Step %s", m_time.ToString().c_str());
-		m_pTimestepScheme->Step(fFirstStep, fLastStep, m_time, dDeltaT);
+		if (fAdaptiveDeltaT) {
+			Announce("Step %s (dt = %1.6fs)",
+				m_time.ToString().c_str(), dDeltaT);
+		} else {
+			Announce("Step %s", m_time.ToString().c_str());
+		}
+		{
+			static const FunctionTimer::GroupId s_idTimerDynamics =
+				FunctionTimer::RegisterGroup("Dynamics");
+			FunctionTimer timerDynamics(s_idTimerDynamics);
+
+			m_pTimestepScheme->Step(fFirstStep, fLastStep, m_time, dDeltaT);
+		}
 /*
 		// Energy and enstrophy
 		{
@@ -459,14 +669,24 @@ void Model::Go() {
 			m_time = timeNext;
 		}
 
-		// Check for WorkflowProcesses
-		for (int wfp = 0; wfp < m_vecWorkflowProcess.size(); wfp++) {
-			if (m_vecWorkflowProcess[wfp]->IsReady(m_time)) {
-				m_vecWorkflowProcess[wfp]->Perform(m_time);
+		// Check for WorkflowProcesses (physical parameterizations)
+		{
+			static const FunctionTimer::GroupId s_idTimerPhysics =
+				FunctionTimer::RegisterGroup("Physics");
+			FunctionTimer timerPhysics(s_idTimerPhysics);
+
+			for (int wfp = 0; wfp < m_vecWorkflowProcess.size(); wfp++) {
+				if (m_vecWorkflowProcess[wfp]->IsReady(m_time)) {
+					m_vecWorkflowProcess[wfp]->Perform(m_time);
+				}
 			}
 		}
 
 		// Check for output
+		static const FunctionTimer::GroupId s_idTimerOutput =
+			FunctionTimer::RegisterGroup("Output");
+		FunctionTimer timerOutput(s_idTimerOutput);
+
 		for (int om = 0; om < m_vecOutMan.size(); om++) {
 			if (fLastStep) {
 /* COMMENT IN FOR MASS, ENERGY, AND MOMENTUM OUTPUTS
@@ -494,186 +714,56 @@ void Model::Go() {
 			}
 		}
 
+		timerOutput.StopTime();
+
+		// Log the performance of this time step
+		if (perflog.IsOpen()) {
+			perflog.EndStep(iStep, m_time, dDeltaT, timerLoop.Time(),
+				m_pGrid->GetExchangeBufferRegistry());
+		}
+
 		// Exit on last step
 		if (fLastStep) {
 			break;
 		}
 
-		// No longer first time step
-		fFirstStep = false;
-	}
+		// Rebalance patches among processors using the compute time
+		// measured since the last rebalance
+		if (m_nRebalanceSteps > 0) {
+			lRebalanceLoopTime += timerLoop.Time();
 
-#if defined(TEMPEST_MPIOMP)
-	{
-		int nCommSize;
-		MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
-
-		long lGlobalTimeLoop[3];
-		long lTimeLoop =
-			FunctionTimer::GetAverageGroupTime("Loop");
-
-#if defined(PROGNOSTIC_CONTRAVARIANT_MOMENTA)
-		long lGlobalTimeTend[3];
-		long lTimeTend =
-			FunctionTimer::GetAverageGroupTime(
-				"CalculateTendencies");
-
-		long lGlobalTimeAcLo[3];
-		long lTimeAcLo =
-			FunctionTimer::GetAverageGroupTime(
-				"AcousticLoop");
-#else
-		long lGlobalTimeSNHP[3];
-		long lTimeHSNP =
-			FunctionTimer::GetAverageGroupTime(
-				"HorizontalStepNonhydrostaticPrimitive");
-
-		long lGlobalTimeVSEx[3];
-		long lTimeVSEx =
-			FunctionTimer::GetAverageGroupTime(
-				"VerticalStepExplicit");
-
-		long lGlobalTimeVSIm[3];
-		long lTimeVSIm =
-			FunctionTimer::GetAverageGroupTime(
-				"VerticalStepImplicit");
-#endif
-		long lGlobalTimeSaSc[3];
-		long lTimeSaSc =
-			FunctionTimer::GetAverageGroupTime(
-				"StepAfterSubCycle");
-
-		long lGlobalTimeComm[3];
-		long lTimeComm =
-			FunctionTimer::GetAverageGroupTime(
-				"Communicate");
-
-		MPI_Reduce(&lTimeLoop, &lGlobalTimeLoop[0],
-			1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeLoop, &lGlobalTimeLoop[1],
-			1, MPI_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeLoop, &lGlobalTimeLoop[2],
-			1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
-
-		lGlobalTimeLoop[0] /= static_cast<long>(nCommSize);
-
-#if defined(PROGNOSTIC_CONTRAVARIANT_MOMENTA)
-		MPI_Reduce(&lTimeTend, &lGlobalTimeTend[0],
-			1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeTend, &lGlobalTimeTend[1],
-			1, MPI_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeTend, &lGlobalTimeTend[2],
-			1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
-
-		lGlobalTimeTend[0] /= static_cast<long>(nCommSize);
-
-		MPI_Reduce(&lTimeAcLo, &lGlobalTimeAcLo[0],
-			1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeAcLo, &lGlobalTimeAcLo[1],
-			1, MPI_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeAcLo, &lGlobalTimeAcLo[2],
-			1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
-
-		lGlobalTimeAcLo[0] /= static_cast<long>(nCommSize);
+			if ((iStep + 1) % m_nRebalanceSteps == 0) {
+				unsigned long lCommTime =
+					FunctionTimer::GetTotalGroupTime("Communicate")
+					- lRebalanceCommTime;
 
-#else
-		MPI_Reduce(&lTimeHSNP, &lGlobalTimeSNHP[0],
-			1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeHSNP, &lGlobalTimeSNHP[1],
-			1, MPI_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeHSNP, &lGlobalTimeSNHP[2],
-			1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
-
-		lGlobalTimeSNHP[0] /= static_cast<long>(nCommSize);
-
-		MPI_Reduce(&lTimeVSEx, &lGlobalTimeVSEx[0],
-			1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeVSEx, &lGlobalTimeVSEx[1],
-			1, MPI_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeVSEx, &lGlobalTimeVSEx[2],
-			1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
-
-		lGlobalTimeVSEx[0] /= static_cast<long>(nCommSize);
-
-		MPI_Reduce(&lTimeVSIm, &lGlobalTimeVSIm[0],
-			1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeVSIm, &lGlobalTimeVSIm[1],
-			1, MPI_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeVSIm, &lGlobalTimeVSIm[2],
-			1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
-
-		lGlobalTimeVSIm[0] /= static_cast<long>(nCommSize);
-#endif
+				unsigned long lComputeTime = 0;
+				if (lRebalanceLoopTime > lCommTime) {
+					lComputeTime = lRebalanceLoopTime - lCommTime;
+				}
 
-		MPI_Reduce(&lTimeSaSc, &lGlobalTimeSaSc[0],
-			1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeSaSc, &lGlobalTimeSaSc[1],
-			1, MPI_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeSaSc, &lGlobalTimeSaSc[2],
-			1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
-
-		lGlobalTimeSaSc[0] /= static_cast<long>(nCommSize);
-
-		MPI_Reduce(&lTimeComm, &lGlobalTimeComm[0],
-			1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeComm, &lGlobalTimeComm[1],
-			1, MPI_LONG, MPI_MIN, 0, MPI_COMM_WORLD);
-		MPI_Reduce(&lTimeComm, &lGlobalTimeComm[2],
-			1, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
-
-		lGlobalTimeComm[0] /= static_cast<long>(nCommSize);
-
-		int nEntriesLoop =
-			FunctionTimer::GetNumberOfEntries("Loop");
-		Announce("Time [Loop]: %li [%li, %li] (%i)",
-			lGlobalTimeLoop[0], lGlobalTimeLoop[1], lGlobalTimeLoop[2], nEntriesLoop);
-
-#if defined(PROGNOSTIC_CONTRAVARIANT_MOMENTA)
-		int nEntriesTend =
-			FunctionTimer::GetNumberOfEntries(
-				"CalculateTendencies");
-		Announce("Time [Tend]: %li [%li, %li] (%i)",
-			lGlobalTimeTend[0], lGlobalTimeTend[1], lGlobalTimeTend[2], nEntriesTend);
-
-		int nEntriesAcLo =
-			FunctionTimer::GetNumberOfEntries(
-				"AcousticLoop");
-		Announce("Time [AcLo]: %li [%li, %li] (%i)",
-			lGlobalTimeAcLo[0], lGlobalTimeAcLo[1], lGlobalTimeAcLo[2], nEntriesAcLo);
+				bool fRebalanced =
+					m_pGrid->RebalancePatches(lComputeTime);
 
-#else
-		int nEntriesSNHP =
-			FunctionTimer::GetNumberOfEntries(
-				"HorizontalStepNonhydrostaticPrimitive");
-		Announce("Time [SNHP]: %li [%li, %li] (%i)",
-			lGlobalTimeSNHP[0], lGlobalTimeSNHP[1], lGlobalTimeSNHP[2], nEntriesSNHP);
-
-		int nEntriesVSEx =
-			FunctionTimer::GetNumberOfEntries(
-				"VerticalStepExplicit");
-		Announce("Time [VSEx]: %li [%li, %li] (%i)",
-			lGlobalTimeVSEx[0], lGlobalTimeVSEx[1], lGlobalTimeVSEx[2], nEntriesVSEx);
-
-		int nEntriesVSIm =
-			FunctionTimer::GetNumberOfEntries(
-				"VerticalStepImplicit");
-		Announce("Time [VSIm]: %li [%li, %li] (%i)",
-			lGlobalTimeVSIm[0], lGlobalTimeVSIm[1], lGlobalTimeVSIm[2], nEntriesVSIm);
-#endif
+				if (fRebalanced) {
+					m_pVerticalDynamics->ResetActivePatchData();
+				}
 
-		int nEntriesSaSc =
-			FunctionTimer::GetNumberOfEntries(
-				"StepAfterSubCycle");
-		Announce("Time [SaSc]: %li [%li, %li] (%i)",
-			lGlobalTimeSaSc[0], lGlobalTimeSaSc[1], lGlobalTimeSaSc[2], nEntriesSaSc);
+				lRebalanceLoopTime = 0;
+				lRebalanceCommTime =
+					FunctionTimer::GetTotalGroupTime("Communicate");
+			}
+		}
 
-		int nEntriesComm =
-			FunctionTimer::GetNumberOfEntries(
-				"Communicate");
-		Announce("Time [Comm]: %li [%li, %li] (%i)",
-			lGlobalTimeComm[0], lGlobalTimeComm[1], lGlobalTimeComm[2], nEntriesComm);
+		// No longer first time step
+		fFirstStep = false;
 	}
-#endif
+
+	// Report the profile of all timed regions
+	FunctionTimer::ReportProfile(m_strProfileFile, m_eProfileFormat);
+
+	// Report communication statistics of all exchanges
+	m_pGrid->GetExchangeStatistics().Report(m_strExchangeStatisticsFile);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
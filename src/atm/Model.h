@@ -28,6 +28,8 @@
 #include "VerticalDynamics.h"
 #include "OutputManager.h"
 #include "WorkflowProcess.h"
+#include "FunctionTimer.h"
+#include "PerformanceLog.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -73,10 +75,13 @@ public:
 
 	///	<summary>
 	///		Set the Grid from a pointer to empty Grid and restart file.
+	///		The data in the file is redistributed among nPatchCount
+	///		patches, or one patch per processor if nPatchCount is (-1).
 	///	</summary>
 	void SetGridFromRestartFile(
 		Grid * pGrid,
-		const std::string & strRestartFile
+		const std::string & strRestartFile,
+		int nPatchCount = (-1)
 	);
 
 	///	<summary>
@@ -322,12 +327,99 @@ public:
 		m_timeEnd = timeEnd;
 	}
 
+	///	<summary>
+	///		Get the number of time steps between patch rebalancing.
+	///	</summary>
+	int GetRebalanceSteps() const {
+		return m_nRebalanceSteps;
+	}
+
+	///	<summary>
+	///		Set the number of time steps between patch rebalancing
+	///		(0 to disable rebalancing).
+	///	</summary>
+	void SetRebalanceSteps(int nRebalanceSteps) {
+		m_nRebalanceSteps = nRebalanceSteps;
+	}
+
+	///	<summary>
+	///		Set the parameters of adaptive time stepping, which is used
+	///		when the time step size is zero.  Each time step is chosen so
+	///		the maximum horizontal Courant number equals dCourantNumber,
+	///		or the maximum stable Courant number of the TimestepScheme if
+	///		dCourantNumber is zero.  Nonzero timeDeltaTMin and
+	///		timeDeltaTMax bound the time step size.
+	///	</summary>
+	void SetAdaptiveTimestep(
+		double dCourantNumber,
+		const Time & timeDeltaTMin,
+		const Time & timeDeltaTMax
+	) {
+		m_dCourantNumber = dCourantNumber;
+		m_timeDeltaTMin = timeDeltaTMin;
+		m_timeDeltaTMax = timeDeltaTMax;
+	}
+
+	///	<summary>
+	///		Set the file that the profile of all FunctionTimer regions is
+	///		written to at the end of the run (empty for no file).
+	///	</summary>
+	void SetProfileFile(
+		const std::string & strProfileFile,
+		FunctionTimer::ReportFormat eProfileFormat
+	) {
+		m_strProfileFile = strProfileFile;
+		m_eProfileFormat = eProfileFormat;
+	}
+
+	///	<summary>
+	///		Set the file that the communication statistics of each rank are
+	///		written to at the end of the run (empty for no file).
+	///	</summary>
+	void SetExchangeStatisticsFile(
+		const std::string & strExchangeStatisticsFile
+	) {
+		m_strExchangeStatisticsFile = strExchangeStatisticsFile;
+	}
+
+	///	<summary>
+	///		Set the file that the performance of each time step is logged
+	///		to (empty for no log).  Throughput is computed over the last
+	///		nWindowSteps steps.
+	///	</summary>
+	void SetPerformanceLogFile(
+		const std::string & strPerformanceLogFile,
+		PerformanceLog::Format ePerformanceLogFormat,
+		int nPerformanceLogWindow
+	) {
+		m_strPerformanceLogFile = strPerformanceLogFile;
+		m_ePerformanceLogFormat = ePerformanceLogFormat;
+		m_nPerformanceLogWindow = nPerformanceLogWindow;
+	}
+
+protected:
+	///	<summary>
+	///		Compute the size of the next adaptive time step, given the
+	///		target Courant number and the size of the previous step (or
+	///		zero on the first step).
+	///	</summary>
+	Time ComputeAdaptiveDeltaT(
+		double dCourantNumber,
+		const Time & timePrevDeltaT
+	);
+
 protected:
 	///	<summary>
 	///		Flag indicating the Grid has been initialized from a restart file.
 	///	</summary>
 	bool m_fGridFromRestartFile;
 
+	///	<summary>
+	///		Flag indicating the data in the restart file has been
+	///		redistributed among a different patch layout.
+	///	</summary>
+	bool m_fGridRepartitioned;
+
 protected:
 	///	<summary>
 	///		Pointer to grid
@@ -399,6 +491,57 @@ private:
 	///		End time of the simulation.
 	///	</summary>
 	Time m_timeEnd;
+
+	///	<summary>
+	///		Number of time steps between patch rebalancing.
+	///	</summary>
+	int m_nRebalanceSteps;
+
+	///	<summary>
+	///		Target Courant number for adaptive time stepping.
+	///	</summary>
+	double m_dCourantNumber;
+
+	///	<summary>
+	///		Minimum time step size for adaptive time stepping.
+	///	</summary>
+	Time m_timeDeltaTMin;
+
+	///	<summary>
+	///		Maximum time step size for adaptive time stepping.
+	///	</summary>
+	Time m_timeDeltaTMax;
+
+	///	<summary>
+	///		File that the profile is written to at the end of the run.
+	///	</summary>
+	std::string m_strProfileFile;
+
+	///	<summary>
+	///		Format of the profile file.
+	///	</summary>
+	FunctionTimer::ReportFormat m_eProfileFormat;
+
+	///	<summary>
+	///		File that communication statistics are written to at the end
+	///		of the run.
+	///	</summary>
+	std::string m_strExchangeStatisticsFile;
+
+	///	<summary>
+	///		File that the performance of each time step is logged to.
+	///	</summary>
+	std::string m_strPerformanceLogFile;
+
+	///	<summary>
+	///		Format of the performance log.
+	///	</summary>
+	PerformanceLog::Format m_ePerformanceLogFormat;
+
+	///	<summary>
+	///		Number of steps in the throughput window of the performance log.
+	///	</summary>
+	int m_nPerformanceLogWindow;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -78,6 +78,21 @@ protected:
 	void PerformOutput(const Time & time);
 
 public:
+	///	<summary>
+	///		Get the time between successive outputs, or zero if output is
+	///		only performed at the initial and final time.
+	///	</summary>
+	const Time & GetOutputFrequency() const {
+		return m_timeOutputFrequency;
+	}
+
+	///	<summary>
+	///		Get the time of the next output.
+	///	</summary>
+	const Time & GetNextOutputTime() const {
+		return m_timeNextOutput;
+	}
+
 	///	<summary>
 	///		Determine if an output is needed.
 	///	</summary>
@@ -31,10 +31,91 @@
 #include <cstdio>
 #include <cmath>
 #include <cfloat>
+#include <vector>
+#include <algorithm>
 #include <sys/stat.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Determine if two PatchBoxes cover the same nodes.
+///	</summary>
+static bool IsSamePatchBox(
+	const PatchBox & box1,
+	const PatchBox & box2
+) {
+	return (
+		(box1.GetPanel() == box2.GetPanel()) &&
+		(box1.GetRefinementLevel() == box2.GetRefinementLevel()) &&
+		(box1.GetHaloElements() == box2.GetHaloElements()) &&
+		(box1.GetAGlobalBegin() == box2.GetAGlobalBegin()) &&
+		(box1.GetAGlobalEnd() == box2.GetAGlobalEnd()) &&
+		(box1.GetBGlobalBegin() == box2.GetBGlobalBegin()) &&
+		(box1.GetBGlobalEnd() == box2.GetBGlobalEnd()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Determine if two PatchBoxes on the same panel have any nodes
+///		(including halo nodes) in common.
+///	</summary>
+static bool DoPatchBoxesOverlap(
+	const PatchBox & box1,
+	const PatchBox & box2
+) {
+	return (
+		(box1.GetPanel() == box2.GetPanel()) &&
+		(box1.GetAGlobalBegin() < box2.GetAGlobalEnd()) &&
+		(box2.GetAGlobalBegin() < box1.GetAGlobalEnd()) &&
+		(box1.GetBGlobalBegin() < box2.GetBGlobalEnd()) &&
+		(box2.GetBGlobalBegin() < box1.GetBGlobalEnd()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEMPEST_MPIOMP
+///	<summary>
+///		Write (at this processor only) or read (collectively) all
+///		DataChunks of a DataContainer at the given offset.  DataChunks are
+///		stored in the file without the padding used in memory.
+///	</summary>
+///	<returns>
+///		The number of bytes accessed in the file.
+///	</returns>
+static MPI_Offset TransferDataContainer(
+	MPI_File fh,
+	MPI_Offset offset,
+	DataContainer & dc,
+	bool fWrite
+) {
+	MPI_Offset offsetBegin = offset;
+
+	MPI_Status status;
+
+	for (size_t i = 0; i < dc.GetDataChunkCount(); i++) {
+		int nByteSize = static_cast<int>(dc.GetDataChunkByteSize(i));
+
+		unsigned char * pData =
+			dc.GetPointer() + dc.GetDataChunkOffset(i);
+
+		if (fWrite) {
+			MPI_File_write_at(fh, offset,
+				pData, nByteSize, MPI_BYTE, &status);
+		} else {
+			MPI_File_read_at_all(fh, offset,
+				pData, nByteSize, MPI_BYTE, &status);
+		}
+
+		offset += nByteSize;
+	}
+
+	return (offset - offsetBegin);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
 OutputManagerComposite::OutputManagerComposite(
 	Grid & grid,
 	const Time & timeOutputFrequency,
@@ -50,6 +131,14 @@ OutputManagerComposite::OutputManagerComposite(
 		1)
 {
 	m_iCheck = 171456;
+
+	m_nInputPatchCount = (-1);
+
+	m_fRepartitioned = false;
+
+#ifdef TEMPEST_MPIOMP
+	m_fhActiveOutput = MPI_FILE_NULL;
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -64,31 +153,29 @@ bool OutputManagerComposite::OpenFile(
 	const std::string & strFileName
 ) {
 #ifdef TEMPEST_MPIOMP
-	// Determine processor rank
-	int nRank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
-
-	// Open file at root
-	if (nRank == 0) {
+	// Check for existing file
+	if (m_fhActiveOutput != MPI_FILE_NULL) {
+		_EXCEPTIONT("Restart file already open");
+	}
 
-		// Check for existing file
-		if (m_ofsActiveOutput.is_open()) {
-			_EXCEPTIONT("Restart file already open");
-		}
+	// Open new binary output file on all processors
+	std::string strRestartFileName = strFileName + ".restart.dat";
 
-		// Open new binary output stream
-		std::string strRestartFileName = strFileName + ".restart.dat";
-		m_ofsActiveOutput.open(
-			strRestartFileName.c_str(), std::ios::binary | std::ios::out);
+	int iError =
+		MPI_File_open(
+			MPI_COMM_WORLD,
+			const_cast<char *>(strRestartFileName.c_str()),
+			MPI_MODE_CREATE | MPI_MODE_WRONLY,
+			MPI_INFO_NULL,
+			&m_fhActiveOutput);
 
-		if (!m_ofsActiveOutput) {
-			_EXCEPTION1("Error opening output file \"%s\"",
-				strRestartFileName.c_str());
-		}
+	if (iError != MPI_SUCCESS) {
+		_EXCEPTION1("Error opening output file \"%s\"",
+			strRestartFileName.c_str());
 	}
 
-	// Wait for all processes to complete
-	MPI_Barrier(MPI_COMM_WORLD);
+	// Discard the contents of any existing file
+	MPI_File_set_size(m_fhActiveOutput, 0);
 
 	return true;
 #else
@@ -100,319 +187,261 @@ bool OutputManagerComposite::OpenFile(
 ///////////////////////////////////////////////////////////////////////////////
 
 void OutputManagerComposite::CloseFile() {
-	m_ofsActiveOutput.close();
+#ifdef TEMPEST_MPIOMP
+	if (m_fhActiveOutput != MPI_FILE_NULL) {
+		MPI_File_close(&m_fhActiveOutput);
+	}
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void OutputManagerComposite::Output(
-	const Time & time
-) {
-#ifdef TEMPEST_MPIOMP
-	// Check for open file
-	if (!IsFileOpen()) {
-		_EXCEPTIONT("No file available for output");
+void OutputManagerComposite::InitializeGridPatchByteLoc() {
+
+	// Determine space allocation for each GridPatch from a stub
+	// GridPatch, which sizes its DataContainers without allocating them
+	m_vecGridPatchByteSize.Allocate(m_grid.GetPatchCount(), 2);
+
+	for (int i = 0; i < m_grid.GetPatchCount(); i++) {
+		GridPatch * pPatch = m_grid.NewPatch(i);
+
+		pPatch->InitializeDataLocal(false, false, false, false);
+
+		m_vecGridPatchByteSize[i][0] =
+			pPatch->GetDataContainerGeometric().GetUnpaddedByteSize();
+		m_vecGridPatchByteSize[i][1] =
+			pPatch->GetDataContainerActiveState().GetUnpaddedByteSize();
+
+		delete pPatch;
 	}
 
-	// Verify that only one output has been performed
-	if (m_ixOutputTime != 0) {
-		_EXCEPTIONT("Only one Composite output allowed per file");
+	// Initialize byte location for each GridPatch
+	m_vecGridPatchByteLoc.Allocate(m_grid.GetPatchCount(), 2);
+	m_vecGridPatchByteLoc[0][0] = 0;
+	m_vecGridPatchByteLoc[0][1] = m_vecGridPatchByteSize[0][0];
+	for (int i = 1; i < m_vecGridPatchByteSize.GetRows(); i++) { 
+		m_vecGridPatchByteLoc[i][0] =
+			m_vecGridPatchByteLoc[i-1][1]
+			+ m_vecGridPatchByteSize[i-1][1];
+
+		m_vecGridPatchByteLoc[i][1] =
+			m_vecGridPatchByteLoc[i][0]
+			+ m_vecGridPatchByteSize[i][0];
 	}
+}
 
-	// Determine processor rank
-	int nRank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+///////////////////////////////////////////////////////////////////////////////
 
-	// Data types
-	const int ExchangeDataType_Geometric = 0;
-	const int ExchangeDataType_ActiveState = 1;
-	const int ExchangeDataType_Count = 2;
+#ifdef TEMPEST_MPIOMP
+void OutputManagerComposite::TransferGridPatchData(
+	MPI_File fh,
+	MPI_Offset offsetGridPatchData,
+	const std::vector<GridPatch *> & vecGridPatches,
+	bool fWrite
+) {
+	// File views must be monotonically nondecreasing, so GridPatches
+	// are accessed in order of patch index
+	std::vector<GridPatch *> vecPatchOrder(vecGridPatches);
 
-	// Determine space allocation for each GridPatch
-	m_vecGridPatchByteSize.Allocate(m_grid.GetPatchCount(), 2);
+	std::sort(vecPatchOrder.begin(), vecPatchOrder.end(),
+		[](const GridPatch * pPatchA, const GridPatch * pPatchB) {
+			return (pPatchA->GetPatchIndex() < pPatchB->GetPatchIndex());
+		});
 
-	for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
-		const GridPatch * pPatch = m_grid.GetActivePatch(i);
+	// Build memory and file block lists for all DataChunks, which are
+	// padded in memory and contiguous in the file
+	std::vector<int> vecBlockLength;
+	std::vector<MPI_Aint> vecMemoryDisp;
+	std::vector<MPI_Aint> vecFileDisp;
+
+	for (int i = 0; i < vecPatchOrder.size(); i++) {
+		GridPatch * pPatch = vecPatchOrder[i];
 
 		int iPatchIx = pPatch->GetPatchIndex();
-		if (iPatchIx > m_grid.GetPatchCount()) {
+		if ((iPatchIx < 0) ||
+		    (iPatchIx >= m_vecGridPatchByteSize.GetRows())
+		) {
 			_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-				iPatchIx, m_grid.GetPatchCount());
+				iPatchIx, m_vecGridPatchByteSize.GetRows());
 		}
 
-		const DataContainer & dcGeometric =
-			pPatch->GetDataContainerGeometric();
-		m_vecGridPatchByteSize[iPatchIx][0] =
-			dcGeometric.GetTotalByteSize();
-
-		const DataContainer & dcActiveState =
-			pPatch->GetDataContainerActiveState();
-		m_vecGridPatchByteSize[iPatchIx][1] =
-			dcActiveState.GetTotalByteSize();
-	}
-
-	// Reduce GridPatch byte size
-	if (nRank != 0) {
-		MPI_Reduce(
-			&(m_vecGridPatchByteSize[0][0]),
-			&(m_vecGridPatchByteSize[0][0]),
-			m_vecGridPatchByteSize.GetTotalSize(),
-			MPI_INT,
-			MPI_MAX,
-			0,
-			MPI_COMM_WORLD);
-
-	// Reduce GridPatch byte size and write Grid information
-	} else if (nRank == 0) {
-
-		// Reduce
-		MPI_Reduce(
-			MPI_IN_PLACE,
-			&(m_vecGridPatchByteSize[0][0]),
-			m_vecGridPatchByteSize.GetTotalSize(),
-			MPI_INT,
-			MPI_MAX,
-			0,
-			MPI_COMM_WORLD);
+		DataContainer * pDataContainer[2] = {
+			&(pPatch->GetDataContainerGeometric()),
+			&(pPatch->GetDataContainerActiveState())
+		};
 
-		// The active Model
-		const Model & model = m_grid.GetModel();
-
-		// Get maximum byte size for exchange
-		int sMaxRecvBufferByteSize = 0;
-		for (int i = 0; i < m_vecGridPatchByteSize.GetRows(); i++) {
-			if (m_vecGridPatchByteSize[i][0] > sMaxRecvBufferByteSize) {
-				sMaxRecvBufferByteSize = m_vecGridPatchByteSize[i][0];
+		for (int d = 0; d < 2; d++) {
+			if (!pDataContainer[d]->IsAttached()) {
+				continue;
 			}
-			if (m_vecGridPatchByteSize[i][1] > sMaxRecvBufferByteSize) {
-				sMaxRecvBufferByteSize = m_vecGridPatchByteSize[i][1];
+			if (pDataContainer[d]->GetUnpaddedByteSize() !=
+				m_vecGridPatchByteSize[iPatchIx][d]
+			) {
+				_EXCEPTION1("GridPatch (%i) byte size mismatch", iPatchIx);
 			}
-		}
 
-		// Allocate Recv buffer at root
-		if (m_vecRecvBuffer.GetRows() < sMaxRecvBufferByteSize) {
-			m_vecRecvBuffer.Allocate(sMaxRecvBufferByteSize);
-		}
+			MPI_Aint dispFile =
+				static_cast<MPI_Aint>(m_vecGridPatchByteLoc[iPatchIx][d]);
 
-		// Initialize byte location for each GridPatch
-		m_vecGridPatchByteLoc.Allocate(m_grid.GetPatchCount(), 2);
-		m_vecGridPatchByteLoc[0][0] = 0;
-		m_vecGridPatchByteLoc[0][1] = m_vecGridPatchByteSize[0][0];
-		for (int i = 1; i < m_vecGridPatchByteSize.GetRows(); i++) { 
-			m_vecGridPatchByteLoc[i][0] =
-				m_vecGridPatchByteLoc[i-1][1]
-				+ m_vecGridPatchByteSize[i-1][1];
-
-			m_vecGridPatchByteLoc[i][1] =
-				m_vecGridPatchByteLoc[i][0]
-				+ m_vecGridPatchByteSize[i][0];
-		}
+			for (size_t c = 0; c < pDataContainer[d]->GetDataChunkCount(); c++) {
+				int nByteSize =
+					static_cast<int>(
+						pDataContainer[d]->GetDataChunkByteSize(c));
 
-		// Write check bits
-		m_ofsActiveOutput.write((const char *)(&m_iCheck), sizeof(int));
+				MPI_Aint dispMemory;
+				MPI_Get_address(
+					pDataContainer[d]->GetPointer()
+						+ pDataContainer[d]->GetDataChunkOffset(c),
+					&dispMemory);
 
-		// Write current time
-		const Time & timeCurrent = model.GetCurrentTime();
-		m_ofsActiveOutput.write((const char *)(&(timeCurrent)), sizeof(Time));
+				vecBlockLength.push_back(nByteSize);
+				vecMemoryDisp.push_back(dispMemory);
+				vecFileDisp.push_back(dispFile);
 
-		// Write Grid information to file
-		const DataContainer & dcGridParameters =
-			m_grid.GetDataContainerParameters();
-		int nGridParametersByteSize =
-			dcGridParameters.GetTotalByteSize();
-		const char * pGridParameters =
-			(const char *)(dcGridParameters.GetPointer());
-
-		m_ofsActiveOutput.write(
-			pGridParameters, nGridParametersByteSize);
-
-		const DataContainer & dcGridPatchData =
-			m_grid.GetDataContainerPatchData();
-		int nGridPatchDataByteSize =
-			dcGridPatchData.GetTotalByteSize();
-		const char * pGridPatchData =
-			(const char *)(dcGridPatchData.GetPointer());
-
-		m_ofsActiveOutput.write(
-			pGridPatchData, nGridPatchDataByteSize);
+				dispFile += nByteSize;
+			}
+		}
 	}
 
-	// Send data from GridPatches to root
-	if (nRank != 0) {
+	int nBlocks = static_cast<int>(vecBlockLength.size());
+
+	// Create derived datatypes describing the blocks in memory and on file
+	MPI_Datatype typeMemory;
+	MPI_Datatype typeFile;
+
+	MPI_Type_create_hindexed(
+		nBlocks,
+		(nBlocks == 0)?(NULL):(&(vecBlockLength[0])),
+		(nBlocks == 0)?(NULL):(&(vecMemoryDisp[0])),
+		MPI_BYTE,
+		&typeMemory);
+
+	MPI_Type_create_hindexed(
+		nBlocks,
+		(nBlocks == 0)?(NULL):(&(vecBlockLength[0])),
+		(nBlocks == 0)?(NULL):(&(vecFileDisp[0])),
+		MPI_BYTE,
+		&typeFile);
+
+	MPI_Type_commit(&typeMemory);
+	MPI_Type_commit(&typeFile);
+
+	// Collective access to all GridPatch data
+	MPI_File_set_view(
+		fh,
+		offsetGridPatchData,
+		MPI_BYTE,
+		typeFile,
+		const_cast<char *>("native"),
+		MPI_INFO_NULL);
+
+	int iError;
+	MPI_Status status;
+
+	if (fWrite) {
+		iError = MPI_File_write_at_all(
+			fh, 0, MPI_BOTTOM, 1, typeMemory, &status);
+	} else {
+		iError = MPI_File_read_at_all(
+			fh, 0, MPI_BOTTOM, 1, typeMemory, &status);
+	}
 
-		int nActivePatches = m_grid.GetActivePatchCount();
-		if (nActivePatches == 0) {
-			_EXCEPTIONT("No GridPatches on processor");
-		}
+	if (iError != MPI_SUCCESS) {
+		_EXCEPTIONT("Error accessing GridPatch data in restart file");
+	}
 
-		DataArray1D<MPI_Request> vecSendReqGeo(nActivePatches);
-		DataArray1D<MPI_Request> vecSendReqAcS(nActivePatches);
-
-		for (int i = 0; i < nActivePatches; i++) {
-			const GridPatch * pPatch = m_grid.GetActivePatch(i);
-
-			const DataContainer & dcGeometric =
-				pPatch->GetDataContainerGeometric();
-			int nGeometricDataByteSize =
-				dcGeometric.GetTotalByteSize();
-			const unsigned char * pGeometricData =
-				dcGeometric.GetPointer();
-
-			MPI_Isend(
-				const_cast<unsigned char *>(pGeometricData),
-				nGeometricDataByteSize,
-				MPI_BYTE,
-				0,
-				ExchangeDataType_Geometric,
-				MPI_COMM_WORLD,
-				&(vecSendReqGeo[i]));
-
-			const DataContainer & dcActiveState =
-				pPatch->GetDataContainerActiveState();
-			int nActiveStateDataByteSize =
-				dcActiveState.GetTotalByteSize();
-			const unsigned char * pActiveStateData =
-				dcActiveState.GetPointer();
-
-			MPI_Isend(
-				const_cast<unsigned char *>(pActiveStateData),
-				nActiveStateDataByteSize,
-				MPI_BYTE,
-				0,
-				ExchangeDataType_ActiveState,
-				MPI_COMM_WORLD,
-				&(vecSendReqAcS[i]));
-/*
-			printf("Send Geo %i %i\n", pPatch->GetPatchIndex(), nGeometricDataByteSize);
-			printf("Send AcS %i %i\n", pPatch->GetPatchIndex(), nActiveStateDataByteSize);
-*/
-		}
+	// Restore the default file view
+	MPI_File_set_view(
+		fh,
+		0,
+		MPI_BYTE,
+		MPI_BYTE,
+		const_cast<char *>("native"),
+		MPI_INFO_NULL);
+
+	MPI_Type_free(&typeMemory);
+	MPI_Type_free(&typeFile);
+}
+#endif
 
-		int iWaitAllMsgGeo =
-			MPI_Waitall(
-				nActivePatches,
-				&(vecSendReqGeo[0]),
-				MPI_STATUSES_IGNORE);
+///////////////////////////////////////////////////////////////////////////////
 
-		if (iWaitAllMsgGeo == MPI_ERR_IN_STATUS) {
-			_EXCEPTIONT("MPI_Waitall returned MPI_ERR_IN_STATUS");
-		}
+void OutputManagerComposite::Output(
+	const Time & time
+) {
+#ifdef TEMPEST_MPIOMP
+	// Check for open file
+	if (!IsFileOpen()) {
+		_EXCEPTIONT("No file available for output");
+	}
 
-		int iWaitAllMsgAcS =
-			MPI_Waitall(
-				nActivePatches,
-				&(vecSendReqAcS[0]),
-				MPI_STATUSES_IGNORE);
+	// Verify that only one output has been performed
+	if (m_ixOutputTime != 0) {
+		_EXCEPTIONT("Only one Composite output allowed per file");
+	}
 
-		if (iWaitAllMsgAcS == MPI_ERR_IN_STATUS) {
-			_EXCEPTIONT("MPI_Waitall returned MPI_ERR_IN_STATUS");
-		}
+	// Determine processor rank
+	int nRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
 
-		//std::cout << "WAIT DONE" << std::endl;
+	// Determine byte size and location of each GridPatch
+	InitializeGridPatchByteLoc();
 
-	// Receive data and output to file 
-	} else {
+	// Grid information
+	DataContainer & dcGridParameters =
+		m_grid.GetDataContainerParameters();
+	int nGridParametersByteSize =
+		dcGridParameters.GetUnpaddedByteSize();
 
-		// Reference position
-		std::streampos posRefFile = m_ofsActiveOutput.tellp();
-		if (posRefFile == (-1)) {
-			_EXCEPTIONT("ActiveOutput::tellp() fail");
-		}
+	DataContainer & dcGridPatchData =
+		m_grid.GetDataContainerPatchData();
+	int nGridPatchDataByteSize =
+		dcGridPatchData.GetUnpaddedByteSize();
 
-		// Write my GridPatch data to file
-		for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
-			const GridPatch * pPatch = m_grid.GetActivePatch(i);
+	// Write check bits, current time and Grid information at root
+	if (nRank == 0) {
 
-			int iPatchIx = pPatch->GetPatchIndex();
-			if (iPatchIx > m_grid.GetPatchCount()) {
-				_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-					iPatchIx, m_grid.GetPatchCount());
-			}
-/*
-			printf("Write %i %i %i %i %i\n",
-				iPatchIx,
-				m_vecGridPatchByteLoc[iPatchIx][0],
-				m_vecGridPatchByteSize[iPatchIx][0],
-				m_vecGridPatchByteLoc[iPatchIx][1],
-				m_vecGridPatchByteSize[iPatchIx][1]);
-*/
-			const DataContainer & dcGeometric =
-				pPatch->GetDataContainerGeometric();
-			int nGeometricDataByteSize =
-				dcGeometric.GetTotalByteSize();
-			const char * pGeometricData =
-				(const char *)(dcGeometric.GetPointer());
-
-			m_ofsActiveOutput.seekp(
-				posRefFile + m_vecGridPatchByteLoc[iPatchIx][0]);
-			m_ofsActiveOutput.write(
-				pGeometricData, m_vecGridPatchByteSize[iPatchIx][0]);
-
-			const DataContainer & dcActiveState =
-				pPatch->GetDataContainerActiveState();
-			int nActiveStateDataByteSize =
-				dcActiveState.GetTotalByteSize();
-			const char * pActiveStateData =
-				(const char *)(dcActiveState.GetPointer());
-
-			m_ofsActiveOutput.seekp(
-				posRefFile + m_vecGridPatchByteLoc[iPatchIx][1]);
-			m_ofsActiveOutput.write(
-				pActiveStateData, m_vecGridPatchByteSize[iPatchIx][1]);
-		}
+		// The active Model
+		const Model & model = m_grid.GetModel();
 
-		// Recieve all data objects from neighbors
-		int nRemainingMessages =
-			2 * (m_grid.GetPatchCount() - m_grid.GetActivePatchCount());
+		const Time & timeCurrent = model.GetCurrentTime();
 
-		for (; nRemainingMessages > 0; nRemainingMessages--) {
+		MPI_Offset offset = 0;
+		MPI_Status status;
 
-			// Receive a consolidation message
-			MPI_Status status;
+		// Write check bits
+		MPI_File_write_at(m_fhActiveOutput, offset,
+			&m_iCheck, sizeof(int), MPI_BYTE, &status);
+		offset += sizeof(int);
 
-			MPI_Recv(
-				&(m_vecRecvBuffer[0]),
-				m_vecRecvBuffer.GetRows(),
-				MPI_CHAR,
-				MPI_ANY_SOURCE,
-				MPI_ANY_TAG,
-				MPI_COMM_WORLD,
-				&status);
+		// Write current time
+		MPI_File_write_at(m_fhActiveOutput, offset,
+			const_cast<Time *>(&timeCurrent), sizeof(Time), MPI_BYTE,
+			&status);
+		offset += sizeof(Time);
 
-			// Data type from TAG
-			int iDataType = status.MPI_TAG;
-			if ((iDataType < 0) || (iDataType >= ExchangeDataType_Count)) {
-				_EXCEPTION1("MPI_TAG (%i) out of range", iDataType);
-			}
+		// Write Grid information to file
+		offset += TransferDataContainer(
+			m_fhActiveOutput, offset, dcGridParameters, true);
 
-			// Check patch index
-			int iPatchIx = *((int*)(&(m_vecRecvBuffer[0])));
+		TransferDataContainer(
+			m_fhActiveOutput, offset, dcGridPatchData, true);
+	}
 
-			if (iPatchIx > m_vecGridPatchByteLoc.GetRows()) {
-				_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-					iPatchIx, m_vecGridPatchByteLoc.GetRows());
-			}
-/*
-			if (iDataType == 0) {
-				printf("Recv Geo %i %i\n",
-					pPatchIx[0],
-					m_vecGridPatchByteSize[pPatchIx[0]][iDataType]);
-			} else {
-				printf("Recv AcS %i %i\n",
-					pPatchIx[0],
-					m_vecGridPatchByteSize[pPatchIx[0]][iDataType]);
-			}
-*/
-			m_ofsActiveOutput.seekp(
-				posRefFile + m_vecGridPatchByteLoc[iPatchIx][iDataType]);
-			m_ofsActiveOutput.write(
-				(const char *)(&(m_vecRecvBuffer[0])),
-				m_vecGridPatchByteSize[iPatchIx][iDataType]);
-		}
+	// Write GridPatch data from all processors
+	MPI_Offset offsetGridPatchData =
+		sizeof(int)
+		+ sizeof(Time)
+		+ nGridParametersByteSize
+		+ nGridPatchDataByteSize;
+
+	std::vector<GridPatch *> vecActivePatches;
+	for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
+		vecActivePatches.push_back(m_grid.GetActivePatch(i));
 	}
 
-	// Barrier
-	MPI_Barrier(MPI_COMM_WORLD);
+	TransferGridPatchData(
+		m_fhActiveOutput, offsetGridPatchData, vecActivePatches, true);
 
 #else
 	_EXCEPTIONT("Not implemented without TEMPEST_MPIOMP");
@@ -430,149 +459,144 @@ Time OutputManagerComposite::Input(
 	// Set the flag indicating that output came from a restart file
 	m_fFromRestartFile = true;
 
-	// Determine processor rank
-	int nRank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
-
-	// The active model
-	const Model & model = m_grid.GetModel();
+	// Open binary input file on all processors
+	MPI_File fhActiveInput;
 
-	// Open binary input stream
-	std::ifstream ifsActiveInput;
-	ifsActiveInput.open(
-		strFileName.c_str(), std::ios::binary | std::ios::in);
+	int iError =
+		MPI_File_open(
+			MPI_COMM_WORLD,
+			const_cast<char *>(strFileName.c_str()),
+			MPI_MODE_RDONLY,
+			MPI_INFO_NULL,
+			&fhActiveInput);
 
-	if (!ifsActiveInput) {
+	if (iError != MPI_SUCCESS) {
 		_EXCEPTION1("Unable to open input file \"%s\"",
 			strFileName.c_str());
 	}
 
+	MPI_Offset offset = 0;
+	MPI_Status status;
+
 	// Read check bits
 	int iCheckInput;
-	ifsActiveInput.read((char *)(&iCheckInput), sizeof(int));
+	MPI_File_read_at_all(fhActiveInput, offset,
+		&iCheckInput, sizeof(int), MPI_BYTE, &status);
+	offset += sizeof(int);
+
 	if (iCheckInput != m_iCheck) {
 		_EXCEPTION1("Invalid or incompatible input file \"%s\"",
 			strFileName.c_str());
 	}
 
 	// Read current time
-	ifsActiveInput.read((char *)(&(timeCurrent)), sizeof(Time));
+	MPI_File_read_at_all(fhActiveInput, offset,
+		&timeCurrent, sizeof(Time), MPI_BYTE, &status);
+	offset += sizeof(Time);
 
 	// Read Grid parameters from file
 	DataContainer & dcGridParameters = m_grid.GetDataContainerParameters();
-	int nGridParametersByteSize =
-		dcGridParameters.GetTotalByteSize();
-	char * pGridParameters =
-		(char *)(dcGridParameters.GetPointer());
 
-	ifsActiveInput.read(pGridParameters, nGridParametersByteSize);
+	offset += TransferDataContainer(
+		fhActiveInput, offset, dcGridParameters, false);
 
 	// Initialize the Grid from specified parameters
 	m_grid.InitializeDataLocal();
 
 	// Load Grid data from file
 	DataContainer & dcGridPatchData = m_grid.GetDataContainerPatchData();
-	int nGridPatchDataByteSize =
-		dcGridPatchData.GetTotalByteSize();
-	char * pGridPatchData =
-		(char *)(dcGridPatchData.GetPointer());
 
-	ifsActiveInput.read(pGridPatchData, nGridPatchDataByteSize);
+	offset += TransferDataContainer(
+		fhActiveInput, offset, dcGridPatchData, false);
 
-	// Distribute GridPatches to processors
-	m_grid.DistributePatches();
+	// Determine byte size and location of each GridPatch in the file
+	InitializeGridPatchByteLoc();
 
-	// Determine space allocation for each GridPatch
-	m_vecGridPatchByteSize.Allocate(m_grid.GetPatchCount(), 2);
+	// Store the patch layout of the file and apply the new layout
+	m_fRepartitioned = false;
 
-	for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
-		const GridPatch * pPatch = m_grid.GetActivePatch(i);
+	std::vector<PatchBox> vecFilePatchBoxes;
+	for (int i = 0; i < m_grid.GetPatchCount(); i++) {
+		vecFilePatchBoxes.push_back(m_grid.GetPatchBox(i));
+	}
 
-		int iPatchIx = pPatch->GetPatchIndex();
-		if (iPatchIx > m_grid.GetPatchCount()) {
-			_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-				iPatchIx, m_grid.GetPatchCount());
+	if (m_nInputPatchCount != (-1)) {
+		m_grid.ReplaceDefaultPatchLayout(m_nInputPatchCount);
+
+		if (m_grid.GetPatchCount() != vecFilePatchBoxes.size()) {
+			m_fRepartitioned = true;
+		} else {
+			for (int i = 0; i < m_grid.GetPatchCount(); i++) {
+				if (!IsSamePatchBox(
+					m_grid.GetPatchBox(i), vecFilePatchBoxes[i])
+				) {
+					m_fRepartitioned = true;
+					break;
+				}
+			}
 		}
+	}
 
-		const DataContainer & dcGeometric =
-			pPatch->GetDataContainerGeometric();
-		m_vecGridPatchByteSize[iPatchIx][0] =
-			dcGeometric.GetTotalByteSize();
+	// Distribute GridPatches to processors
+	m_grid.DistributePatches();
 
-		const DataContainer & dcActiveState =
-			pPatch->GetDataContainerActiveState();
-		m_vecGridPatchByteSize[iPatchIx][1] =
-			dcActiveState.GetTotalByteSize();
-	}
+	// Load in GridPatch data from file
+	if (!m_fRepartitioned) {
+		std::vector<GridPatch *> vecActivePatches;
+		for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
+			vecActivePatches.push_back(m_grid.GetActivePatch(i));
+		}
 
-	MPI_Allreduce(
-		MPI_IN_PLACE,
-		&(m_vecGridPatchByteSize[0][0]),
-		m_vecGridPatchByteSize.GetTotalSize(),
-		MPI_INT,
-		MPI_MAX,
-		MPI_COMM_WORLD);
+		TransferGridPatchData(
+			fhActiveInput, offset, vecActivePatches, false);
 
-	// Initialize byte location for each GridPatch
-	m_vecGridPatchByteLoc.Allocate(m_grid.GetPatchCount(), 2);
-	m_vecGridPatchByteLoc[0][0] = 0;
-	m_vecGridPatchByteLoc[0][1] = m_vecGridPatchByteSize[0][0];
-	for (int i = 1; i < m_vecGridPatchByteSize.GetRows(); i++) { 
-		m_vecGridPatchByteLoc[i][0] =
-			m_vecGridPatchByteLoc[i-1][1]
-			+ m_vecGridPatchByteSize[i-1][1];
+	// Load the active state of GridPatches of the file that overlap
+	// active GridPatches and copy it into the new patch layout
+	} else {
+		Announce("Repartitioning %i patches in restart file into %i patches",
+			static_cast<int>(vecFilePatchBoxes.size()),
+			m_grid.GetPatchCount());
 
-		m_vecGridPatchByteLoc[i][1] =
-			m_vecGridPatchByteLoc[i][0]
-			+ m_vecGridPatchByteSize[i][0];
-	}
+		std::vector<GridPatch *> vecFilePatches;
 
-	// Reference position
-	std::streampos posRefFile = ifsActiveInput.tellg();
-	if (posRefFile == (-1)) {
-		_EXCEPTIONT("ActiveInput::tellg() fail");
-	}
+		for (int i = 0; i < vecFilePatchBoxes.size(); i++) {
+			const PatchBox & boxFile = vecFilePatchBoxes[i];
 
-	// Load in GridPatch data from file
-	for (int i = 0; i < m_grid.GetActivePatchCount(); i++) {
-		GridPatch * pPatch = m_grid.GetActivePatch(i);
+			for (int j = 0; j < m_grid.GetActivePatchCount(); j++) {
+				const PatchBox & box =
+					m_grid.GetActivePatch(j)->GetPatchBox();
 
-		int iPatchIx = pPatch->GetPatchIndex();
-		if (iPatchIx > m_grid.GetPatchCount()) {
-			_EXCEPTION2("PatchIndex (%i) out of range [0,%i)",
-				iPatchIx, m_grid.GetPatchCount());
+				if (DoPatchBoxesOverlap(box, boxFile)) {
+					GridPatch * pPatch = m_grid.NewPatch(i, boxFile);
+					pPatch->InitializeDataLocal(false, true, false, false);
+					vecFilePatches.push_back(pPatch);
+					break;
+				}
+			}
 		}
 
-		DataContainer & dcGeometric =
-			pPatch->GetDataContainerGeometric();
-		int nGeometricDataByteSize =
-			dcGeometric.GetTotalByteSize();
-		char * pGeometricData =
-			(char *)(dcGeometric.GetPointer());
-
-		ifsActiveInput.seekg(
-			posRefFile + m_vecGridPatchByteLoc[iPatchIx][0]);
-		ifsActiveInput.read(
-			pGeometricData, m_vecGridPatchByteSize[iPatchIx][0]);
-
-		DataContainer & dcActiveState =
-			pPatch->GetDataContainerActiveState();
-		int nActiveStateDataByteSize =
-			dcActiveState.GetTotalByteSize();
-		char * pActiveStateData =
-			(char *)(dcActiveState.GetPointer());
-
-		ifsActiveInput.seekg(
-			posRefFile + m_vecGridPatchByteLoc[iPatchIx][1]);
-		ifsActiveInput.read(
-			pActiveStateData, m_vecGridPatchByteSize[iPatchIx][1]);
+		TransferGridPatchData(
+			fhActiveInput, offset, vecFilePatches, false);
+
+		// Interior nodes of the file patches are copied last so that
+		// they take precedence over halo nodes
+		for (int j = 0; j < m_grid.GetActivePatchCount(); j++) {
+			GridPatch * pPatch = m_grid.GetActivePatch(j);
+			for (int i = 0; i < vecFilePatches.size(); i++) {
+				pPatch->CopyNodeData(*(vecFilePatches[i]), false);
+			}
+			for (int i = 0; i < vecFilePatches.size(); i++) {
+				pPatch->CopyNodeData(*(vecFilePatches[i]), true);
+			}
+		}
+
+		for (int i = 0; i < vecFilePatches.size(); i++) {
+			delete vecFilePatches[i];
+		}
 	}
 
 	// Close the file
-	ifsActiveInput.close();
-
-	// Barrier
-	MPI_Barrier(MPI_COMM_WORLD);
+	MPI_File_close(&fhActiveInput);
 
 #else
 	_EXCEPTIONT("Not implemented without TEMPEST_MPIOMP");
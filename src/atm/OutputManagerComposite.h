@@ -20,9 +20,15 @@
 #include "OutputManager.h"
 #include "DataArray1D.h"
 #include "DataArray2D.h"
-#include <fstream>
+#include <ios>
+#include <vector>
+
+#ifdef TEMPEST_MPIOMP
+#include <mpi.h>
+#endif
 
 class Time;
+class GridPatch;
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -95,6 +101,19 @@ protected:
 	}
 
 public:
+	///	<summary>
+	///		Set the number of patches used to partition the Grid on input.
+	///		If the default patch layout with this number of patches differs
+	///		from the layout in the file, the data in the file is
+	///		redistributed among the patches of the new layout.  If not set,
+	///		the patch layout in the file is used.
+	///	</summary>
+	void SetInputPatchCount(
+		int nInputPatchCount
+	) {
+		m_nInputPatchCount = nInputPatchCount;
+	}
+
 	///	<summary>
 	///		Initialize the grid data from a file.
 	///	</summary>
@@ -102,17 +121,64 @@ public:
 		const std::string & strFileName
 	);
 
+	///	<summary>
+	///		Check if the data in the input file has been redistributed among
+	///		a different patch layout.  Only the active state is taken from
+	///		the file in this case, and geometric data must be initialized
+	///		again.
+	///	</summary>
+	bool IsRepartitioned() const {
+		return m_fRepartitioned;
+	}
+
+private:
+	///	<summary>
+	///		Compute the byte size and byte location of the data of each
+	///		GridPatch in the restart file from the current patch layout.
+	///	</summary>
+	void InitializeGridPatchByteLoc();
+
+#ifdef TEMPEST_MPIOMP
+	///	<summary>
+	///		Write or read the geometric and active state data of the given
+	///		GridPatches at their byte locations in the file.  Each processor
+	///		only accesses data of its own GridPatches, and all accesses are
+	///		combined into a single collective operation.  DataContainers
+	///		that are not allocated are skipped.
+	///	</summary>
+	void TransferGridPatchData(
+		MPI_File fh,
+		MPI_Offset offsetGridPatchData,
+		const std::vector<GridPatch *> & vecGridPatches,
+		bool fWrite
+	);
+#endif
+
 protected:
 	///	<summary>
 	///		Check bits.
 	///	</summary>
 	int m_iCheck;
 
+	///	<summary>
+	///		Number of patches used to partition the Grid on input, or
+	///		(-1) to use the patch layout in the file.
+	///	</summary>
+	int m_nInputPatchCount;
+
+	///	<summary>
+	///		Flag indicating the data in the input file has been
+	///		redistributed among a different patch layout.
+	///	</summary>
+	bool m_fRepartitioned;
+
 protected:
+#ifdef TEMPEST_MPIOMP
 	///	<summary>
 	///		Active output file.
 	///	</summary>
-	std::ofstream m_ofsActiveOutput;
+	MPI_File m_fhActiveOutput;
+#endif
 
 private:
 	///	<summary>
@@ -124,11 +190,6 @@ private:
 	///		Byte location for each GridPatch.
 	///	</summary>
 	DataArray2D<std::streamoff> m_vecGridPatchByteLoc;
-
-	///	<summary>
-	///		Vector used at root node for storage of received data.
-	///	</summary>
-	DataArray1D<double> m_vecRecvBuffer;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
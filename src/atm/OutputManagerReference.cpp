@@ -35,6 +35,20 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Number of OutputManagerReference objects in this process.
+///	</summary>
+static int s_nReferenceOutputManagers = 0;
+
+///	<summary>
+///		The OutputManagerReference with asynchronous output, if any.
+///		NetCDF is not thread-safe, so no other OutputManagerReference may
+///		exist while its background thread is writing.
+///	</summary>
+static const OutputManagerReference * s_pAsynchronousOutputManager = NULL;
+
+///////////////////////////////////////////////////////////////////////////////
+
 OutputManagerReference::OutputManagerReference(
 	Grid & grid,
 	const Time & timeOutputFrequency,
@@ -59,6 +73,8 @@ OutputManagerReference::OutputManagerReference(
 	m_nYReference(nYReference),
 	m_nZReference(nZReference),
 	m_pActiveNcOutput(NULL),
+	m_vecOutputData(1),
+	m_ixActiveOutputData(0),
 	m_fOutputVorticity(false),
 	m_fOutputDivergence(false),
 	m_fOutputTemperature(false),
@@ -67,6 +83,12 @@ OutputManagerReference::OutputManagerReference(
 	m_fOutputAllVarsOnNodes(fOutputAllVarsOnNodes),
 	m_fRemoveReferenceProfile(fRemoveReferenceProfile)
 {
+	if (s_pAsynchronousOutputManager != NULL) {
+		_EXCEPTIONT("Asynchronous reference output must be the only "
+			"Reference OutputManager (NetCDF is not thread-safe)");
+	}
+	s_nReferenceOutputManagers++;
+
 	// Get the reference box
 	double dX0;
 	double dX1;
@@ -111,7 +133,21 @@ OutputManagerReference::OutputManagerReference(
 ///////////////////////////////////////////////////////////////////////////////
 
 OutputManagerReference::~OutputManagerReference() {
-	CloseFile();
+
+	// A failed background write is rethrown by CloseFile(), but must
+	// not propagate out of the destructor
+	try {
+		CloseFile();
+
+	} catch(Exception & e) {
+		std::cout << e.ToString() << std::endl;
+		CloseFile();
+	}
+
+	if (s_pAsynchronousOutputManager == this) {
+		s_pAsynchronousOutputManager = NULL;
+	}
+	s_nReferenceOutputManagers--;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -122,7 +158,9 @@ void OutputManagerReference::OutputVorticity(
 	m_fOutputVorticity = fOutputVorticity;
 
 	if (!fOutputVorticity) {
-		m_dataVorticity.Deallocate();
+		for (int i = 0; i < m_vecOutputData.size(); i++) {
+			m_vecOutputData[i].m_dataVorticity.Deallocate();
+		}
 	}
 }
 
@@ -134,9 +172,10 @@ void OutputManagerReference::OutputDivergence(
 	m_fOutputDivergence = fOutputDivergence;
 
 	if (!fOutputDivergence) {
-		m_dataDivergence.Deallocate();
+		for (int i = 0; i < m_vecOutputData.size(); i++) {
+			m_vecOutputData[i].m_dataDivergence.Deallocate();
+		}
 	}
-
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -147,7 +186,9 @@ void OutputManagerReference::OutputTemperature(
 	m_fOutputTemperature = fOutputTemperature;
 
 	if (!fOutputTemperature) {
-		m_dataTemperature.Deallocate();
+		for (int i = 0; i < m_vecOutputData.size(); i++) {
+			m_vecOutputData[i].m_dataTemperature.Deallocate();
+		}
 	}
 }
 
@@ -159,7 +200,9 @@ void OutputManagerReference::OutputSurfacePressure(
 	m_fOutputSurfacePressure = fOutputSurfacePressure;
 
 	if (!fOutputSurfacePressure) {
-		m_dataSurfacePressure.Deallocate();
+		for (int i = 0; i < m_vecOutputData.size(); i++) {
+			m_vecOutputData[i].m_dataSurfacePressure.Deallocate();
+		}
 	}
 }
 
@@ -171,7 +214,45 @@ void OutputManagerReference::OutputRichardson(
 	m_fOutputRichardson = fOutputRichardson;
 
 	if (!fOutputRichardson) {
-		m_dataRichardson.Deallocate();
+		for (int i = 0; i < m_vecOutputData.size(); i++) {
+			m_vecOutputData[i].m_dataRichardson.Deallocate();
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerReference::SetAsynchronousOutput(
+	int nMaxPendingOutputs
+) {
+	if (m_queueOutput.IsInitialized()) {
+		_EXCEPTIONT("Asynchronous output already enabled");
+	}
+	if (nMaxPendingOutputs < 1) {
+		_EXCEPTION1("Invalid number of pending outputs (%i)",
+			nMaxPendingOutputs);
+	}
+	if (s_nReferenceOutputManagers != 1) {
+		_EXCEPTIONT("Asynchronous reference output must be the only "
+			"Reference OutputManager (NetCDF is not thread-safe)");
+	}
+
+	s_pAsynchronousOutputManager = this;
+
+	// Snapshot buffers are reallocated on the next output
+	m_vecOutputData.clear();
+	m_vecOutputData.resize(nMaxPendingOutputs);
+	m_ixActiveOutputData = 0;
+	m_iGridStamp = -1;
+
+	// Only the root processor writes to file
+	int nRank = 0;
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+#endif
+
+	if (nRank == 0) {
+		m_queueOutput.Initialize(nMaxPendingOutputs);
 	}
 }
 
@@ -183,6 +264,9 @@ bool OutputManagerReference::CalculatePatchCoordinates() {
 		return false;
 	}
 
+	// Pending writes use the existing topography and snapshot buffers
+	m_queueOutput.Flush();
+
 	// Recalculate patch coordinates
 	Announce("..Recalculating patch coordinates");
 
@@ -218,85 +302,242 @@ bool OutputManagerReference::CalculatePatchCoordinates() {
 		m_dBeta,
 		m_iPatch);
 
+	// Build interpolation stencils for the reference points
+	m_grid.InitializeInterpStencil(
+		m_dAlpha,
+		m_dBeta,
+		m_iPatch,
+		m_stencilInterp);
+
 	// Allocate data arrays
-	m_dataTopography.Allocate(
-		1, 1, m_nXReference * m_nYReference);
+	AllocateReferenceData(m_dataTopography, 1, 1);
 
-	m_dataStateNode.Allocate(
-		m_grid.GetModel().GetEquationSet().GetComponents(),
-		m_dREtaCoord.GetRows(),
-		m_nXReference * m_nYReference);
+	for (int i = 0; i < m_vecOutputData.size(); i++) {
+		ReferenceOutputData & data = m_vecOutputData[i];
 
-	if (!m_fOutputAllVarsOnNodes) {
-		m_dataStateREdge.Allocate(
+		AllocateReferenceData(
+			data.m_dataStateNode,
 			m_grid.GetModel().GetEquationSet().GetComponents(),
-			m_grid.GetRElements() + 1,
+			m_dREtaCoord.GetRows());
+
+		if (!m_fOutputAllVarsOnNodes) {
+			AllocateReferenceData(
+				data.m_dataStateREdge,
+				m_grid.GetModel().GetEquationSet().GetComponents(),
+				m_grid.GetRElements() + 1);
+		}
+
+		if (eqn.GetTracers() != 0) {
+			AllocateReferenceData(
+				data.m_dataTracers,
+				m_grid.GetModel().GetEquationSet().GetTracers(),
+				m_dREtaCoord.GetRows());
+		}
+
+		if (metaUserData.GetUserData2DItemCount() != 0) {
+			AllocateReferenceData(
+				data.m_dataUserData2D,
+				metaUserData.GetUserData2DItemCount(),
+				1);
+		}
+
+		if (m_fOutputVorticity) {
+			AllocateReferenceData(
+				data.m_dataVorticity, 1, m_dREtaCoord.GetRows());
+		}
+
+		if (m_fOutputDivergence) {
+			AllocateReferenceData(
+				data.m_dataDivergence, 1, m_dREtaCoord.GetRows());
+		}
+
+		if (m_fOutputTemperature) {
+			AllocateReferenceData(
+				data.m_dataTemperature, 1, m_dREtaCoord.GetRows());
+		}
+
+		if (m_fOutputSurfacePressure) {
+			AllocateReferenceData(
+				data.m_dataSurfacePressure, 1, 1);
+		}
+
+		if (m_fOutputRichardson) {
+			AllocateReferenceData(
+				data.m_dataRichardson, 1, m_dREtaCoord.GetRows());
+		}
+	}
+
+	// Reduce/Interpolate topography array
+	m_grid.ReduceInterpolate(
+		DataType_Topography,
+		m_dREtaSurface,
+		m_stencilInterp,
+		m_dataTopography);
+
+	// Update grid stamp
+	m_iGridStamp = m_grid.GetGridStamp();
+
+	// Patch coordinates updated
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerReference::AllocateReferenceData(
+	DataArray3D<double> & data,
+	int nComponents,
+	int nLevels
+) {
+	int nRank = 0;
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+#endif
+
+	if (nRank == 0) {
+		data.Allocate(
+			nComponents,
+			nLevels,
+			m_nXReference * m_nYReference);
+
+	} else {
+		data.SetSize(
+			nComponents,
+			nLevels,
 			m_nXReference * m_nYReference);
 	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void OutputManagerReference::WriteOutputData(
+	int ixOutputData
+) {
+#ifdef TEMPEST_NETCDF
+	const ReferenceOutputData & data = m_vecOutputData[ixOutputData];
+
+	// Equation set
+	const EquationSet & eqn = m_grid.GetModel().GetEquationSet();
+
+	// User data metadata
+	const UserDataMeta & metaUserData = m_grid.GetModel().GetUserDataMeta();
+
+	// Initial outputs to a new Output file
+	if (data.m_fFreshOutputFile) {
+
+		// Output topography
+		m_varTopography->put(
+			&(m_dataTopography[0][0][0]),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
+	}
+
+	// Add new time
+	m_varTime->set_cur(data.m_ixOutputTime);
+	m_varTime->put(&(data.m_dTimeDays), 1);
+
+	// Store state variable data
+	for (int c = 0; c < eqn.GetComponents(); c++) {
+		if ((m_fOutputAllVarsOnNodes) ||
+			(m_grid.GetVarLocation(c) == DataLocation_Node)
+		) {
+			m_vecComponentVar[c]->set_cur(data.m_ixOutputTime, 0, 0, 0);
+			m_vecComponentVar[c]->put(
+				&(data.m_dataStateNode[c][0][0]),
+				1,
+				data.m_dataStateNode.GetColumns(),
+				m_dYCoord.GetRows(),
+				m_dXCoord.GetRows());
 
+		} else {
+			m_vecComponentVar[c]->set_cur(data.m_ixOutputTime, 0, 0, 0);
+			m_vecComponentVar[c]->put(
+				&(data.m_dataStateREdge[c][0][0]),
+				1,
+				data.m_dataStateREdge.GetColumns(),
+				m_dYCoord.GetRows(),
+				m_dXCoord.GetRows());
+		}
+	}
+
+	// Store tracer variable data
 	if (eqn.GetTracers() != 0) {
-		m_dataTracers.Allocate(
-			m_grid.GetModel().GetEquationSet().GetTracers(),
-			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+		for (int c = 0; c < eqn.GetTracers(); c++) {
+			m_vecTracersVar[c]->set_cur(data.m_ixOutputTime, 0, 0, 0);
+			m_vecTracersVar[c]->put(
+				&(data.m_dataTracers[c][0][0]),
+				1,
+				data.m_dataTracers.GetColumns(),
+				m_dYCoord.GetRows(),
+				m_dXCoord.GetRows());
+		}
 	}
 
+	// Store user data
 	if (metaUserData.GetUserData2DItemCount() != 0) {
-		m_dataUserData2D.Allocate(
-			metaUserData.GetUserData2DItemCount(),
-			1,
-			m_nXReference * m_nYReference);
+		for (int c = 0; c < metaUserData.GetUserData2DItemCount(); c++) {
+			m_vecUserData2DVar[c]->set_cur(data.m_ixOutputTime, 0, 0);
+			m_vecUserData2DVar[c]->put(
+				&(data.m_dataUserData2D[c][0][0]),
+				1,
+				m_dYCoord.GetRows(),
+				m_dXCoord.GetRows());
+		}
 	}
 
+	// Store vorticity data
 	if (m_fOutputVorticity) {
-		m_dataVorticity.Allocate(
+		m_varVorticity->set_cur(data.m_ixOutputTime, 0, 0, 0);
+		m_varVorticity->put(
+			&(data.m_dataVorticity[0][0][0]),
 			1,
-			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			data.m_dataVorticity.GetColumns(),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
 	}
 
+	// Store divergence data
 	if (m_fOutputDivergence) {
-		m_dataDivergence.Allocate(
+		m_varDivergence->set_cur(data.m_ixOutputTime, 0, 0, 0);
+		m_varDivergence->put(
+			&(data.m_dataDivergence[0][0][0]),
 			1,
-			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			data.m_dataDivergence.GetColumns(),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
 	}
 
+	// Store temperature data
 	if (m_fOutputTemperature) {
-		m_dataTemperature.Allocate(
+		m_varTemperature->set_cur(data.m_ixOutputTime, 0, 0, 0);
+		m_varTemperature->put(
+			&(data.m_dataTemperature[0][0][0]),
 			1,
-			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			data.m_dataTemperature.GetColumns(),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
 	}
 
+	// Store surface pressure data
 	if (m_fOutputSurfacePressure) {
-		m_dataSurfacePressure.Allocate(
+		m_varSurfacePressure->set_cur(data.m_ixOutputTime, 0, 0);
+		m_varSurfacePressure->put(
+			&(data.m_dataSurfacePressure[0][0][0]),
 			1,
-			1,
-			m_nXReference * m_nYReference);
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
 	}
 
+	// Store Richardson data
 	if (m_fOutputRichardson) {
-		m_dataRichardson.Allocate(
+		m_varRichardson->set_cur(data.m_ixOutputTime, 0, 0, 0);
+		m_varRichardson->put(
+			&(data.m_dataRichardson[0][0][0]),
 			1,
-			m_dREtaCoord.GetRows(),
-			m_nXReference * m_nYReference);
+			data.m_dataRichardson.GetColumns(),
+			m_dYCoord.GetRows(),
+			m_dXCoord.GetRows());
 	}
-
-	// Reduce/Interpolate topography array
-	m_grid.ReduceInterpolate(
-		DataType_Topography,
-		m_dREtaSurface,
-		m_dAlpha,
-		m_dBeta,
-		m_iPatch,
-		m_dataTopography);
-
-	// Update grid stamp
-	m_iGridStamp = m_grid.GetGridStamp();
-
-	// Patch coordinates updated
-	return true;
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -523,6 +764,10 @@ bool OutputManagerReference::OpenFile(
 ///////////////////////////////////////////////////////////////////////////////
 
 void OutputManagerReference::CloseFile() {
+
+	// Complete all pending writes to the active file
+	m_queueOutput.Flush();
+
 	if (m_pActiveNcOutput != NULL) {
 		delete(m_pActiveNcOutput);
 		m_pActiveNcOutput = NULL;
@@ -552,29 +797,21 @@ void OutputManagerReference::Output(
 	// Update reference grid
 	CalculatePatchCoordinates();
 
-	// Initial outputs to a new Output file
-	if ((nRank == 0) && (m_fFreshOutputFile)) {
-
-		// Output topography
-		m_varTopography->put(
-			&(m_dataTopography[0][0][0]),
-			m_dYCoord.GetRows(),
-			m_dXCoord.GetRows());
+	// Wait until a snapshot buffer is no longer being written
+	if (m_queueOutput.IsInitialized()) {
+		m_queueOutput.WaitForSlot();
 	}
 
-	// Equation set
-	const EquationSet & eqn = m_grid.GetModel().GetEquationSet();
+	ReferenceOutputData & data = m_vecOutputData[m_ixActiveOutputData];
 
 	// User data metadata
 	const UserDataMeta & metaUserData = m_grid.GetModel().GetUserDataMeta();
 
-	// Add new time
-	if (nRank == 0) {
+	// Position of this snapshot in the output file
 #pragma message "FIX: Doesn't give correct count of days"
-		double dTimeDays = (time - m_grid.GetModel().GetStartTime()) / 86400.0;
-		m_varTime->set_cur(m_ixOutputTime);
-		m_varTime->put(&dTimeDays, 1);
-	}
+	data.m_dTimeDays = (time - m_grid.GetModel().GetStartTime()) / 86400.0;
+	data.m_ixOutputTime = m_ixOutputTime;
+	data.m_fFreshOutputFile = m_fFreshOutputFile;
 /*
 	// Vertically interpolate data to model levels
 	if (m_fOutputAllVarsOnNodes) {
@@ -586,58 +823,42 @@ void OutputManagerReference::Output(
 	}
 */
 	// Perform Interpolate / Reduction on state data
-	m_dataStateNode.Zero();
-
 	m_grid.ReduceInterpolate(
 		DataType_State,
 		m_dREtaCoord,
-		m_dAlpha,
-		m_dBeta,
-		m_iPatch,
-		m_dataStateNode,
+		m_stencilInterp,
+		data.m_dataStateNode,
 		(m_fOutputAllVarsOnNodes)?(DataLocation_None):(DataLocation_Node),
 		!m_fRemoveReferenceProfile);
 
 	if (!m_fOutputAllVarsOnNodes) {
-		m_dataStateREdge.Zero();
-
 		m_grid.ReduceInterpolate(
 			DataType_State,
 			m_grid.GetREtaInterfaces(),
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
-			m_dataStateREdge,
+			m_stencilInterp,
+			data.m_dataStateREdge,
 			DataLocation_REdge,
 			!m_fRemoveReferenceProfile);
 	}
 
 	// Perform Interpolate / Reduction on tracers data
 	if (m_grid.GetModel().GetEquationSet().GetTracers() != 0) {
-		m_dataTracers.Zero();
-
 		m_grid.ReduceInterpolate(
 			DataType_Tracers,
 			m_dREtaCoord,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
-			m_dataTracers,
+			m_stencilInterp,
+			data.m_dataTracers,
 			DataLocation_None,
 			true);
 	}
 
 	// Perform Interpolate / Reduction on user data
 	if (metaUserData.GetUserData2DItemCount() != 0) {
-		m_dataUserData2D.Zero();
-
 		m_grid.ReduceInterpolate(
 			DataType_Auxiliary2D,
 			m_dREtaSurface,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
-			m_dataUserData2D);
+			m_stencilInterp,
+			data.m_dataUserData2D);
 	}
 
 	// Perform Interpolate / Reduction on computed vorticity
@@ -648,19 +869,15 @@ void OutputManagerReference::Output(
 			m_grid.ReduceInterpolate(
 				DataType_Vorticity,
 				m_dREtaCoord,
-				m_dAlpha,
-				m_dBeta,
-				m_iPatch,
-				m_dataVorticity);
+				m_stencilInterp,
+				data.m_dataVorticity);
 		}
 		if (m_fOutputDivergence) {
 			m_grid.ReduceInterpolate(
 				DataType_Divergence,
 				m_dREtaCoord,
-				m_dAlpha,
-				m_dBeta,
-				m_iPatch,
-				m_dataDivergence);
+				m_stencilInterp,
+				data.m_dataDivergence);
 		}
 	}
 
@@ -671,10 +888,8 @@ void OutputManagerReference::Output(
 		m_grid.ReduceInterpolate(
 			DataType_Temperature,
 			m_dREtaCoord,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
-			m_dataTemperature);
+			m_stencilInterp,
+			data.m_dataTemperature);
 	}
 
 	// Perform Interpolate / Reduction on temperature
@@ -684,10 +899,8 @@ void OutputManagerReference::Output(
 		m_grid.ReduceInterpolate(
 			DataType_SurfacePressure,
 			m_dREtaSurface,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
-			m_dataSurfacePressure);
+			m_stencilInterp,
+			data.m_dataSurfacePressure);
 	}
 
 	// Perform Interpolate / Reduction on Richardson number
@@ -697,117 +910,27 @@ void OutputManagerReference::Output(
 		m_grid.ReduceInterpolate(
 			DataType_Richardson,
 			m_dREtaCoord,
-			m_dAlpha,
-			m_dBeta,
-			m_iPatch,
-			m_dataRichardson);
+			m_stencilInterp,
+			data.m_dataRichardson);
 	}
 
-	// Store state variable data
+	// Write the snapshot on the root processor
 	if (nRank == 0) {
-		for (int c = 0; c < eqn.GetComponents(); c++) {
-			if ((m_fOutputAllVarsOnNodes) ||
-				(m_grid.GetVarLocation(c) == DataLocation_Node)
-			) {
-				m_vecComponentVar[c]->set_cur(m_ixOutputTime, 0, 0, 0);
-				m_vecComponentVar[c]->put(
-					&(m_dataStateNode[c][0][0]),
-					1,
-					m_dataStateNode.GetColumns(),
-					m_dYCoord.GetRows(),
-					m_dXCoord.GetRows());
-
-			} else {
-				m_vecComponentVar[c]->set_cur(m_ixOutputTime, 0, 0, 0);
-				m_vecComponentVar[c]->put(
-					&(m_dataStateREdge[c][0][0]),
-					1,
-					m_dataStateREdge.GetColumns(),
-					m_dYCoord.GetRows(),
-					m_dXCoord.GetRows());
-			}
-		}
-
-		// Store tracer variable data
-		if (eqn.GetTracers() != 0) {
-			for (int c = 0; c < eqn.GetTracers(); c++) {
-				m_vecTracersVar[c]->set_cur(m_ixOutputTime, 0, 0, 0);
-				m_vecTracersVar[c]->put(
-					&(m_dataTracers[c][0][0]),
-					1,
-					m_dataTracers.GetColumns(),
-					m_dYCoord.GetRows(),
-					m_dXCoord.GetRows());
-			}
-		}
-
-		// Store user data
-		if (metaUserData.GetUserData2DItemCount() != 0) {
-			for (int c = 0; c < metaUserData.GetUserData2DItemCount(); c++) {
-				m_vecUserData2DVar[c]->set_cur(m_ixOutputTime, 0, 0);
-				m_vecUserData2DVar[c]->put(
-					&(m_dataUserData2D[c][0][0]),
-					1,
-					m_dYCoord.GetRows(),
-					m_dXCoord.GetRows());
-			}
-		}
-
-		// Store vorticity data
-		if (m_fOutputVorticity) {
-			m_varVorticity->set_cur(m_ixOutputTime, 0, 0, 0);
-			m_varVorticity->put(
-				&(m_dataVorticity[0][0][0]),
-				1,
-				m_dataVorticity.GetColumns(),
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
-
-		// Store divergence data
-		if (m_fOutputDivergence) {
-			m_varDivergence->set_cur(m_ixOutputTime, 0, 0, 0);
-			m_varDivergence->put(
-				&(m_dataDivergence[0][0][0]),
-				1,
-				m_dataDivergence.GetColumns(),
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
-
-		// Store temperature data
-		if (m_fOutputTemperature) {
-			m_varTemperature->set_cur(m_ixOutputTime, 0, 0, 0);
-			m_varTemperature->put(
-				&(m_dataTemperature[0][0][0]),
-				1,
-				m_dataTemperature.GetColumns(),
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
-
-		// Store surface pressure data
-		if (m_fOutputSurfacePressure) {
-			m_varSurfacePressure->set_cur(m_ixOutputTime, 0, 0);
-			m_varSurfacePressure->put(
-				&(m_dataSurfacePressure[0][0][0]),
-				1,
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
-		}
-
-		// Store Richardson data
-		if (m_fOutputRichardson) {
-			m_varRichardson->set_cur(m_ixOutputTime, 0, 0, 0);
-			m_varRichardson->put(
-				&(m_dataRichardson[0][0][0]),
-				1,
-				m_dataRichardson.GetColumns(),
-				m_dYCoord.GetRows(),
-				m_dXCoord.GetRows());
+		if (m_queueOutput.IsInitialized()) {
+			int ixOutputData = m_ixActiveOutputData;
+			m_queueOutput.Push(
+				[this, ixOutputData]() {
+					WriteOutputData(ixOutputData);
+				});
+
+		} else {
+			WriteOutputData(m_ixActiveOutputData);
 		}
 	}
 
+	m_ixActiveOutputData =
+		(m_ixActiveOutputData + 1) % m_vecOutputData.size();
+
 	// No longer fresh file
 	m_fFreshOutputFile = false;
 #endif
@@ -20,6 +20,10 @@
 #include "OutputManager.h"
 
 #include "DataArray3D.h"
+#include "InterpStencil.h"
+#include "AsyncTaskQueue.h"
+
+#include <vector>
 
 class Time;
 
@@ -32,6 +36,76 @@ typedef int NcVar;
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		A snapshot of interpolated data on the reference grid, along with
+///		the position in the output file where it is to be written.
+///	</summary>
+class ReferenceOutputData {
+
+public:
+	///	<summary>
+	///		Time of this snapshot in days since the model start time.
+	///	</summary>
+	double m_dTimeDays;
+
+	///	<summary>
+	///		Index of this snapshot in the output file.
+	///	</summary>
+	int m_ixOutputTime;
+
+	///	<summary>
+	///		Flag indicating this is the first snapshot in the output file.
+	///	</summary>
+	bool m_fFreshOutputFile;
+
+	///	<summary>
+	///		Interpolated state data on nodes on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataStateNode;
+
+	///	<summary>
+	///		Interpolated state data on redges on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataStateREdge;
+
+	///	<summary>
+	///		Interpolated tracers data on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataTracers;
+
+	///	<summary>
+	///		Interpolated user data on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataUserData2D;
+
+	///	<summary>
+	///		Computed vorticity on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataVorticity;
+
+	///	<summary>
+	///		Computed divergence on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataDivergence;
+
+	///	<summary>
+	///		Computed temperature on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataTemperature;
+
+	///	<summary>
+	///		Computed surface pressure on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataSurfacePressure;
+
+	///	<summary>
+	///		Computed Richardson number on the reference grid.
+	///	</summary>
+	DataArray3D<double> m_dataRichardson;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
 ///	<summary>
 ///		OutputManager that handles interpolated output to the reference grid
 ///		(RLL grid on the sphere, Cartesian grid on the plane).
@@ -56,7 +130,8 @@ public:
 	);
 
 	///	<summary>
-	///		Destructor.
+	///		Destructor.  A failed asynchronous write that has not been
+	///		reported is printed rather than thrown.
 	///	</summary>
 	virtual ~OutputManagerReference();
 
@@ -107,12 +182,42 @@ public:
 		bool fOutputRichardson = true
 	);
 
+	///	<summary>
+	///		Write output files on a background thread of the root
+	///		processor.  Interpolation to the reference grid remains
+	///		synchronous, but the model may continue while up to
+	///		nMaxPendingOutputs snapshots are being written.  NetCDF is not
+	///		thread-safe, so this must be the only Reference OutputManager
+	///		and nothing else may access NetCDF while output is pending.
+	///	</summary>
+	void SetAsynchronousOutput(
+		int nMaxPendingOutputs = 2
+	);
+
 private:
 	///	<summary>
 	///		Calculate the patch coordinates of the reference points.
 	///	</summary>
 	bool CalculatePatchCoordinates();
 
+	///	<summary>
+	///		Allocate an array of interpolated data on the reference grid.
+	///		Interpolated data is only gathered on the root processor, so
+	///		on other processors only the array size is set.
+	///	</summary>
+	void AllocateReferenceData(
+		DataArray3D<double> & data,
+		int nComponents,
+		int nLevels
+	);
+
+	///	<summary>
+	///		Write a snapshot of interpolated data to the active file.
+	///	</summary>
+	void WriteOutputData(
+		int ixOutputData
+	);
+
 protected:
 	///	<summary>
 	///		Open a new NetCDF file.
@@ -206,6 +311,11 @@ protected:
 	///	</summary>
 	DataArray1D<int> m_iPatch;
 
+	///	<summary>
+	///		Interpolation stencils from the grid to the reference points.
+	///	</summary>
+	GridInterpStencil m_stencilInterp;
+
 	///	<summary>
 	///		Active output file.
 	///	</summary>
@@ -244,24 +354,19 @@ private:
 
 private:
 	///	<summary>
-	///		Interpolated state data on nodes on the reference grid.
+	///		Ring of snapshot buffers, one per pending output.
 	///	</summary>
-	DataArray3D<double> m_dataStateNode;
+	std::vector<ReferenceOutputData> m_vecOutputData;
 
 	///	<summary>
-	///		Interpolated state data on redges on the reference grid.
+	///		Index of the snapshot buffer used for the next output.
 	///	</summary>
-	DataArray3D<double> m_dataStateREdge;
+	int m_ixActiveOutputData;
 
 	///	<summary>
-	///		Interpolated tracers data on the reference grid.
+	///		Queue of pending writes when output is asynchronous.
 	///	</summary>
-	DataArray3D<double> m_dataTracers;
-
-	///	<summary>
-	///		Interpolated user data on the reference grid.
-	///	</summary>
-	DataArray3D<double> m_dataUserData2D;
+	AsyncTaskQueue m_queueOutput;
 
 private:
 	///	<summary>
@@ -274,11 +379,6 @@ private:
 	///	</summary>
 	NcVar * m_varVorticity;
 
-	///	<summary>
-	///		Computed vorticity on the reference grid.
-	///	</summary>
-	DataArray3D<double> m_dataVorticity;
-
 	///	<summary>
 	///		Flag indicating whether divergence should be computed and output.
 	///	</summary>
@@ -289,11 +389,6 @@ private:
 	///	</summary>
 	NcVar * m_varDivergence;
 
-	///	<summary>
-	///		Computed divergence on the reference grid.
-	///	</summary>
-	DataArray3D<double> m_dataDivergence;
-
 	///	<summary>
 	///		Flag indicating whether temperature should be computed and output.
 	///	</summary>
@@ -304,11 +399,6 @@ private:
 	///	</summary>
 	NcVar * m_varTemperature;
 
-	///	<summary>
-	///		Computed temperature on the reference grid.
-	///	</summary>
-	DataArray3D<double> m_dataTemperature;
-
 	///	<summary>
 	///		Flag indicating whether surface pressure should be computed
 	///		and output.
@@ -320,11 +410,6 @@ private:
 	///	</summary>
 	NcVar * m_varSurfacePressure;
 
-	///	<summary>
-	///		Computed surface pressure on the reference grid.
-	///	</summary>
-	DataArray3D<double> m_dataSurfacePressure;
-
 	///	<summary>
 	///		Flag indicating whether Richardson should be computed and output.
 	///	</summary>
@@ -335,11 +420,6 @@ private:
 	///	</summary>
 	NcVar * m_varRichardson;
 
-	///	<summary>
-	///		Computed Richardson number on the reference grid.
-	///	</summary>
-	DataArray3D<double> m_dataRichardson;
-
 };
 
 ///////////////////////////////////////////////////////////////////////////////
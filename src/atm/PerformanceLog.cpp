@@ -0,0 +1,312 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    PerformanceLog.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "PerformanceLog.h"
+#include "Connectivity.h"
+#include "TimeObj.h"
+#include "MemoryTools.h"
+#include "Exception.h"
+
+#ifdef TEMPEST_MPIOMP
+#include <mpi.h>
+#endif
+
+#include <cctype>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Days per year.
+///	</summary>
+static const double DaysPerYear = 365.0;
+
+///	<summary>
+///		Names of the FunctionTimer groups of each category.
+///	</summary>
+static const char * const CategoryGroupNames[] = {
+	"Dynamics",
+	"Physics",
+	"Output",
+	"Communicate"
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+PerformanceLog::PerformanceLog() :
+	m_fOpen(false),
+	m_fp(NULL),
+	m_eFormat(Format_CSV),
+	m_nWindowSteps(1)
+{
+	for (int c = 0; c < CategoryCount; c++) {
+		m_idGroup[c] = FunctionTimer::InvalidGroupId;
+		m_lBeginTime[c] = 0;
+	}
+	for (int t = 0; t < TransferCount; t++) {
+		m_sBeginTransfer[t] = 0;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+PerformanceLog::~PerformanceLog() {
+	Close();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PerformanceLog::Open(
+	const std::string & strFilename,
+	Format eFormat,
+	int nWindowSteps
+) {
+	if (m_fOpen) {
+		_EXCEPTIONT("PerformanceLog already open");
+	}
+	if (nWindowSteps < 1) {
+		_EXCEPTION1("Invalid throughput window (%i)", nWindowSteps);
+	}
+
+	m_eFormat = eFormat;
+	m_nWindowSteps = nWindowSteps;
+
+	m_dequeSimulatedTime.clear();
+	m_dequeWallTime.clear();
+
+	for (int c = 0; c < CategoryCount; c++) {
+		m_idGroup[c] = FunctionTimer::RegisterGroup(CategoryGroupNames[c]);
+	}
+
+	int nRank = 0;
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+#endif
+
+	if (nRank == 0) {
+		m_fp = fopen(strFilename.c_str(), "w");
+		if (m_fp == NULL) {
+			_EXCEPTION1("Unable to open performance log \"%s\"",
+				strFilename.c_str());
+		}
+
+		if (m_eFormat == Format_CSV) {
+			fprintf(m_fp, "step,time,dt,wall,wall_rank,"
+				"dynamics,dynamics_rank,physics,physics_rank,"
+				"output,output_rank,communicate,communicate_rank,"
+				"mpi_messages,mpi_bytes,local_messages,local_bytes,"
+				"shm_messages,shm_bytes,"
+				"sdpd,sypd,rss_mb,rss_rank\n");
+			fflush(m_fp);
+		}
+	}
+
+	m_fOpen = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PerformanceLog::Close() {
+	if (m_fp != NULL) {
+		fclose(m_fp);
+		m_fp = NULL;
+	}
+	m_fOpen = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PerformanceLog::GetTransferCounts(
+	const ExchangeBufferRegistry & aExchangeBufferRegistry,
+	unsigned long long sTransfer[TransferCount]
+) {
+	sTransfer[Transfer_MPIMessages] =
+		aExchangeBufferRegistry.GetMessagesSent();
+	sTransfer[Transfer_MPIBytes] =
+		aExchangeBufferRegistry.GetBytesSent();
+	sTransfer[Transfer_LocalMessages] =
+		aExchangeBufferRegistry.GetLocalMessagesSent();
+	sTransfer[Transfer_LocalBytes] =
+		aExchangeBufferRegistry.GetLocalBytesSent();
+	sTransfer[Transfer_SharedMemoryMessages] =
+		aExchangeBufferRegistry.GetSharedMemoryMessagesSent();
+	sTransfer[Transfer_SharedMemoryBytes] =
+		aExchangeBufferRegistry.GetSharedMemoryBytesSent();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PerformanceLog::BeginStep(
+	const ExchangeBufferRegistry & aExchangeBufferRegistry
+) {
+	for (int c = 0; c < CategoryCount; c++) {
+		m_lBeginTime[c] = FunctionTimer::GetTotalGroupTime(m_idGroup[c]);
+	}
+
+	GetTransferCounts(aExchangeBufferRegistry, m_sBeginTransfer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PerformanceLog::EndStep(
+	int iStep,
+	const Time & time,
+	double dDeltaT,
+	unsigned long lStepTime,
+	const ExchangeBufferRegistry & aExchangeBufferRegistry
+) {
+	if (!m_fOpen) {
+		_EXCEPTIONT("PerformanceLog not open");
+	}
+
+	// Local values of the wall time, each category and peak memory,
+	// paired with the rank for a MAXLOC reduction
+	struct {
+		double dValue;
+		int iRank;
+	} localvalues[CategoryCount + 2], globalvalues[CategoryCount + 2];
+
+	int nRank = 0;
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+#endif
+
+	localvalues[0].dValue =
+		static_cast<double>(lStepTime)
+		/ static_cast<double>(FunctionTimer::MICROSECONDS_PER_SECOND);
+
+	for (int c = 0; c < CategoryCount; c++) {
+		unsigned long lTime =
+			FunctionTimer::GetTotalGroupTime(m_idGroup[c]);
+
+		localvalues[c+1].dValue = 0.0;
+		if (lTime > m_lBeginTime[c]) {
+			localvalues[c+1].dValue =
+				static_cast<double>(lTime - m_lBeginTime[c])
+				/ static_cast<double>(
+					FunctionTimer::MICROSECONDS_PER_SECOND);
+		}
+	}
+
+	localvalues[CategoryCount+1].dValue =
+		static_cast<double>(GetPeakResidentMemory()) / 1024.0;
+
+	for (int i = 0; i < CategoryCount + 2; i++) {
+		localvalues[i].iRank = nRank;
+		globalvalues[i] = localvalues[i];
+	}
+
+	// Data sent during this step on this rank, summed over ranks
+	unsigned long long sLocalTransfer[TransferCount];
+	unsigned long long sGlobalTransfer[TransferCount];
+
+	GetTransferCounts(aExchangeBufferRegistry, sLocalTransfer);
+
+	for (int t = 0; t < TransferCount; t++) {
+		sLocalTransfer[t] -= m_sBeginTransfer[t];
+		sGlobalTransfer[t] = sLocalTransfer[t];
+	}
+
+#ifdef TEMPEST_MPIOMP
+	MPI_Reduce(
+		localvalues, globalvalues, CategoryCount + 2,
+		MPI_DOUBLE_INT, MPI_MAXLOC, 0, MPI_COMM_WORLD);
+
+	MPI_Reduce(
+		sLocalTransfer, sGlobalTransfer, TransferCount,
+		MPI_UNSIGNED_LONG_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+#endif
+
+	if (nRank != 0) {
+		return;
+	}
+
+	// Throughput over the window, from the slowest rank's wall time
+	m_dequeSimulatedTime.push_back(dDeltaT);
+	m_dequeWallTime.push_back(globalvalues[0].dValue);
+
+	if (m_dequeWallTime.size() > m_nWindowSteps) {
+		m_dequeSimulatedTime.pop_front();
+		m_dequeWallTime.pop_front();
+	}
+
+	double dWindowSimulatedTime = 0.0;
+	double dWindowWallTime = 0.0;
+	for (int i = 0; i < m_dequeWallTime.size(); i++) {
+		dWindowSimulatedTime += m_dequeSimulatedTime[i];
+		dWindowWallTime += m_dequeWallTime[i];
+	}
+
+	// Simulated seconds per wall-clock second equals simulated days per
+	// wall-clock day
+	double dSDPD = 0.0;
+	if (dWindowWallTime > 0.0) {
+		dSDPD = dWindowSimulatedTime / dWindowWallTime;
+	}
+	double dSYPD = dSDPD / DaysPerYear;
+
+	std::string strTime = time.ToString();
+
+	if (m_eFormat == Format_CSV) {
+		fprintf(m_fp, "%i,%s,%1.6e,%1.6e,%i", iStep, strTime.c_str(),
+			dDeltaT, globalvalues[0].dValue, globalvalues[0].iRank);
+		for (int c = 0; c < CategoryCount; c++) {
+			fprintf(m_fp, ",%1.6e,%i",
+				globalvalues[c+1].dValue, globalvalues[c+1].iRank);
+		}
+		for (int t = 0; t < TransferCount; t++) {
+			fprintf(m_fp, ",%llu", sGlobalTransfer[t]);
+		}
+		fprintf(m_fp, ",%1.6e,%1.6e,%1.3f,%i\n",
+			dSDPD, dSYPD,
+			globalvalues[CategoryCount+1].dValue,
+			globalvalues[CategoryCount+1].iRank);
+
+	} else {
+		fprintf(m_fp, "{\"step\": %i, \"time\": \"%s\", \"dt\": %1.6e, "
+			"\"wall\": %1.6e, \"wall_rank\": %i",
+			iStep, strTime.c_str(), dDeltaT,
+			globalvalues[0].dValue, globalvalues[0].iRank);
+		for (int c = 0; c < CategoryCount; c++) {
+			std::string strName = CategoryGroupNames[c];
+			for (int i = 0; i < strName.length(); i++) {
+				strName[i] = tolower(strName[i]);
+			}
+			fprintf(m_fp, ", \"%s\": %1.6e, \"%s_rank\": %i",
+				strName.c_str(), globalvalues[c+1].dValue,
+				strName.c_str(), globalvalues[c+1].iRank);
+		}
+		fprintf(m_fp, ", \"mpi_messages\": %llu, \"mpi_bytes\": %llu, "
+			"\"local_messages\": %llu, \"local_bytes\": %llu, "
+			"\"shm_messages\": %llu, \"shm_bytes\": %llu",
+			sGlobalTransfer[Transfer_MPIMessages],
+			sGlobalTransfer[Transfer_MPIBytes],
+			sGlobalTransfer[Transfer_LocalMessages],
+			sGlobalTransfer[Transfer_LocalBytes],
+			sGlobalTransfer[Transfer_SharedMemoryMessages],
+			sGlobalTransfer[Transfer_SharedMemoryBytes]);
+		fprintf(m_fp, ", \"sdpd\": %1.6e, \"sypd\": %1.6e, "
+			"\"rss_mb\": %1.3f, \"rss_rank\": %i}\n",
+			dSDPD, dSYPD,
+			globalvalues[CategoryCount+1].dValue,
+			globalvalues[CategoryCount+1].iRank);
+	}
+
+	// Flush so that the log can be followed while the model runs
+	fflush(m_fp);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    PerformanceLog.h
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _PERFORMANCELOG_H_
+#define _PERFORMANCELOG_H_
+
+#include "FunctionTimer.h"
+
+#include <string>
+#include <deque>
+#include <cstdio>
+
+class Time;
+class ExchangeBufferRegistry;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A machine-readable log of the performance of each time step,
+///		written by the root rank.  Each record contains the wall time of
+///		the step and the time spent in dynamics, physics, output and
+///		communication (each the maximum over ranks, with the slowest rank),
+///		the messages and bytes sent over MPI, to patches on the same rank
+///		and through shared memory (each summed over ranks), the throughput
+///		in simulated days and years per wall-clock day over a rolling
+///		window of steps, and the peak resident set size over ranks.
+///	</summary>
+class PerformanceLog {
+
+public:
+	///	<summary>
+	///		Format of the log.
+	///	</summary>
+	enum Format {
+		Format_CSV,
+		Format_JSONLines
+	};
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	PerformanceLog();
+
+	///	<summary>
+	///		Destructor.
+	///	</summary>
+	~PerformanceLog();
+
+private:
+	///	<summary>
+	///		Copy constructor (disabled).
+	///	</summary>
+	PerformanceLog(const PerformanceLog &);
+
+	///	<summary>
+	///		Assignment operator (disabled).
+	///	</summary>
+	PerformanceLog & operator=(const PerformanceLog &);
+
+public:
+	///	<summary>
+	///		Open the log.  The throughput is computed over the last
+	///		nWindowSteps steps.  This function is collective.
+	///	</summary>
+	void Open(
+		const std::string & strFilename,
+		Format eFormat,
+		int nWindowSteps
+	);
+
+	///	<summary>
+	///		Close the log.
+	///	</summary>
+	void Close();
+
+	///	<summary>
+	///		Check if the log is open on any rank.
+	///	</summary>
+	bool IsOpen() const {
+		return m_fOpen;
+	}
+
+	///	<summary>
+	///		Mark the beginning of a time step.
+	///	</summary>
+	void BeginStep(
+		const ExchangeBufferRegistry & aExchangeBufferRegistry
+	);
+
+	///	<summary>
+	///		Record a completed time step, ending at the given time with the
+	///		given time step size in seconds, that took lStepTime
+	///		microseconds of wall time on this rank.  This function is
+	///		collective.
+	///	</summary>
+	void EndStep(
+		int iStep,
+		const Time & time,
+		double dDeltaT,
+		unsigned long lStepTime,
+		const ExchangeBufferRegistry & aExchangeBufferRegistry
+	);
+
+private:
+	///	<summary>
+	///		Categories of time recorded in the log.
+	///	</summary>
+	enum Category {
+		Category_Dynamics,
+		Category_Physics,
+		Category_Output,
+		Category_Communicate,
+		CategoryCount
+	};
+
+	///	<summary>
+	///		Counts of data sent, by transport, recorded in the log.
+	///	</summary>
+	enum Transfer {
+		Transfer_MPIMessages,
+		Transfer_MPIBytes,
+		Transfer_LocalMessages,
+		Transfer_LocalBytes,
+		Transfer_SharedMemoryMessages,
+		Transfer_SharedMemoryBytes,
+		TransferCount
+	};
+
+	///	<summary>
+	///		Get the counts of data sent by this rank since construction of
+	///		the ExchangeBufferRegistry.
+	///	</summary>
+	static void GetTransferCounts(
+		const ExchangeBufferRegistry & aExchangeBufferRegistry,
+		unsigned long long sTransfer[TransferCount]
+	);
+
+	///	<summary>
+	///		Flag indicating the log is open.
+	///	</summary>
+	bool m_fOpen;
+
+	///	<summary>
+	///		Log file (only open on the root rank).
+	///	</summary>
+	FILE * m_fp;
+
+	///	<summary>
+	///		Format of the log.
+	///	</summary>
+	Format m_eFormat;
+
+	///	<summary>
+	///		Number of steps in the throughput window.
+	///	</summary>
+	int m_nWindowSteps;
+
+	///	<summary>
+	///		FunctionTimer groups of each category.
+	///	</summary>
+	FunctionTimer::GroupId m_idGroup[CategoryCount];
+
+	///	<summary>
+	///		Total time of each category at the beginning of the step
+	///		(in microseconds).
+	///	</summary>
+	unsigned long m_lBeginTime[CategoryCount];
+
+	///	<summary>
+	///		Counts of data sent at the beginning of the step.
+	///	</summary>
+	unsigned long long m_sBeginTransfer[TransferCount];
+
+	///	<summary>
+	///		Simulated time of each step in the throughput window.
+	///	</summary>
+	std::deque<double> m_dequeSimulatedTime;
+
+	///	<summary>
+	///		Wall time of each step in the throughput window.
+	///	</summary>
+	std::deque<double> m_dequeWallTime;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
@@ -350,7 +350,9 @@ void SplitExplicitDynamics::CalculateTendencies(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("CalculateTendencies");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("CalculateTendencies");
+	FunctionTimer timer(s_idTimer);
 
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
@@ -966,7 +968,9 @@ void SplitExplicitDynamics::FirstAcousticLoop(
 ) {
 
 	// Start the function timer
-	FunctionTimer timer("AcousticLoop");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("AcousticLoop");
+	FunctionTimer timer(s_idTimer);
 
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
@@ -1454,7 +1458,9 @@ void SplitExplicitDynamics::PerformAcousticLoop(
 ) {
 
 	// Start the function timer
-	FunctionTimer timer("AcousticLoop");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("AcousticLoop");
+	FunctionTimer timer(s_idTimer);
 
 	// Get a copy of the GLL grid
 	GridGLL * pGrid = dynamic_cast<GridGLL*>(m_model.GetGrid());
@@ -2107,7 +2113,9 @@ void SplitExplicitDynamics::StepExplicit(
 	}
 
 	// Start the function timer
-	FunctionTimer timer("HorizontalStepNonhydrostaticPrimitive");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("HorizontalStepNonhydrostaticPrimitive");
+	FunctionTimer timer(s_idTimer);
 
 	// Indices of EquationSet variables
 	const int UIx = 0;
@@ -3005,7 +3013,9 @@ void SplitExplicitDynamics::StepAfterSubCycle(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("StepAfterSubCycle");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("StepAfterSubCycle");
+	FunctionTimer timer(s_idTimer);
 
 	// Check indices
 	if (iDataInitial == iDataWorking) {
@@ -48,6 +48,7 @@
 #include "VerticalStretch.h"
 
 #include "TimeObj.h"
+#include "DataAllocator.h"
 #include "Announce.h"
 #include "CommandLine.h"
 #include "STLStringHelper.h"
@@ -73,6 +74,9 @@ struct _TempestCommandLineVariables {
 	Time timeOutputDeltaT;
 	Time timeOutputRestartDeltaT;
 	Time timeDeltaT;
+	double dCourantNumber;
+	Time timeDeltaTMin;
+	Time timeDeltaTMax;
 	Time timeEndTime;
 	int nOutputResX;
 	int nOutputResY;
@@ -82,6 +86,7 @@ struct _TempestCommandLineVariables {
 	bool fOutputTemperature;
 	bool fOutputSurfacePressure;
 	bool fOutputRichardson;
+	int nOutputAsyncDepth;
 	bool fNoReferenceState;
 	bool fNoTracers;
 	bool fNoHyperviscosity;
@@ -96,6 +101,16 @@ struct _TempestCommandLineVariables {
 	std::string strVerticalStretch;
 	std::string strVerticalDiscretization;
 	int nVerticalHyperdiffOrder;
+	int nVerticalJacobianReuse;
+	int nPatchesPerProcessor;
+	int nRebalanceSteps;
+	bool fHugePages;
+	std::string strProfileFile;
+	std::string strProfileFormat;
+	std::string strExchangeStatisticsFile;
+	std::string strPerformanceLogFile;
+	std::string strPerformanceLogFormat;
+	int nPerformanceLogWindow;
 	std::string strTimestepScheme;
 	std::string strHorizontalDynamics;
 	std::string strVerticalDynamics;
@@ -123,6 +138,7 @@ struct _TempestCommandLineVariables {
 	CommandLineBool(_tempestvars.fOutputTemperature, "output_temp"); \
 	CommandLineBool(_tempestvars.fOutputSurfacePressure, "output_ps"); \
 	CommandLineBool(_tempestvars.fOutputRichardson, "output_Ri"); \
+	CommandLineInt(_tempestvars.nOutputAsyncDepth, "output_async", 0); \
 	CommandLineBool(_tempestvars.fNoReferenceState, "norefstate"); \
 	CommandLineBool(_tempestvars.fNoTracers, "notracers"); \
 	CommandLineBool(_tempestvars.fNoHyperviscosity, "nohypervis"); \
@@ -137,6 +153,19 @@ struct _TempestCommandLineVariables {
 	CommandLineBool(_tempestvars.fForceMassFluxOnLevels, "vmassfluxlevels"); \
 	CommandLineString(_tempestvars.strVerticalStretch, "vstretch", "uniform"); \
 	CommandLineInt(_tempestvars.nVerticalHyperdiffOrder, "vhypervisorder", 0); \
+	CommandLineInt(_tempestvars.nVerticalJacobianReuse, "vjacreuse", 0); \
+	CommandLineInt(_tempestvars.nPatchesPerProcessor, "patchesperproc", 1); \
+	CommandLineInt(_tempestvars.nRebalanceSteps, "rebalance", 0); \
+	CommandLineBool(_tempestvars.fHugePages, "hugepages"); \
+	CommandLineString(_tempestvars.strProfileFile, "profile_file", ""); \
+	CommandLineStringD(_tempestvars.strProfileFormat, "profile_format", "CSV", "(CSV | JSON)"); \
+	CommandLineString(_tempestvars.strExchangeStatisticsFile, "profile_exchange_file", ""); \
+	CommandLineString(_tempestvars.strPerformanceLogFile, "perf_log", ""); \
+	CommandLineStringD(_tempestvars.strPerformanceLogFormat, "perf_log_format", "CSV", "(CSV | JSON)"); \
+	CommandLineInt(_tempestvars.nPerformanceLogWindow, "perf_log_window", 10); \
+	CommandLineDouble(_tempestvars.dCourantNumber, "cfl", 0.0); \
+	CommandLineDeltaTime(_tempestvars.timeDeltaTMin, "dtmin", ""); \
+	CommandLineDeltaTime(_tempestvars.timeDeltaTMax, "dtmax", ""); \
 	CommandLineString(_tempestvars.strTimestepScheme, "timescheme", "strang"); \
 	CommandLineStringD(_tempestvars.strHorizontalDynamics, "hmethod", "V1", "(V1 | V2 | SPEX)"); \
 	CommandLineStringD(_tempestvars.strVerticalDynamics, "vmethod", "V1", "(V1 | V2 | SCHUR | NONE)");
@@ -370,7 +399,8 @@ void _TempestSetupMethodOfLines(
 				vars.nVerticalHyperdiffOrder,
 				vars.fExplicitVertical,
 				!vars.fNoReferenceState,
-				vars.fForceMassFluxOnLevels));
+				vars.fForceMassFluxOnLevels,
+				vars.nVerticalJacobianReuse));
 
 	} else if (vars.strVerticalDynamics == "v2") {
 		model.SetVerticalDynamics(
@@ -408,6 +438,48 @@ void _TempestSetupMethodOfLines(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void _TempestSetupProfiling(
+	Model & model,
+	_TempestCommandLineVariables & vars
+) {
+	FunctionTimer::ReportFormat eProfileFormat;
+
+	STLStringHelper::ToLower(vars.strProfileFormat);
+	if (vars.strProfileFormat == "csv") {
+		eProfileFormat = FunctionTimer::ReportFormat_CSV;
+
+	} else if (vars.strProfileFormat == "json") {
+		eProfileFormat = FunctionTimer::ReportFormat_JSON;
+
+	} else {
+		_EXCEPTIONT("Invalid value for --profile_format");
+	}
+
+	model.SetProfileFile(vars.strProfileFile, eProfileFormat);
+
+	model.SetExchangeStatisticsFile(vars.strExchangeStatisticsFile);
+
+	PerformanceLog::Format ePerformanceLogFormat;
+
+	STLStringHelper::ToLower(vars.strPerformanceLogFormat);
+	if (vars.strPerformanceLogFormat == "csv") {
+		ePerformanceLogFormat = PerformanceLog::Format_CSV;
+
+	} else if (vars.strPerformanceLogFormat == "json") {
+		ePerformanceLogFormat = PerformanceLog::Format_JSONLines;
+
+	} else {
+		_EXCEPTIONT("Invalid value for --perf_log_format");
+	}
+
+	model.SetPerformanceLogFile(
+		vars.strPerformanceLogFile,
+		ePerformanceLogFormat,
+		vars.nPerformanceLogWindow);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void _TempestSetupOutputManagers(
 	Model & model,
 	_TempestCommandLineVariables & vars
@@ -443,6 +515,9 @@ void _TempestSetupOutputManagers(
 		if (vars.fOutputRichardson) {
 			pOutmanRef->OutputRichardson();
 		}
+		if (vars.nOutputAsyncDepth > 0) {
+			pOutmanRef->SetAsynchronousOutput(vars.nOutputAsyncDepth);
+		}
 
 		model.AttachOutputManager(pOutmanRef);
 		AnnounceEndBlock("Done");
@@ -479,6 +554,21 @@ void _TempestSetupCubedSphereModel(
 	model.SetDeltaT(vars.timeDeltaT);
 	model.SetEndTime(vars.timeEndTime);
 
+	// Set the number of time steps between patch rebalancing
+	model.SetRebalanceSteps(vars.nRebalanceSteps);
+
+	// Set the adaptive time stepping parameters (used if --dt is zero)
+	model.SetAdaptiveTimestep(
+		vars.dCourantNumber,
+		vars.timeDeltaTMin,
+		vars.timeDeltaTMax);
+
+	// Set the profile, communication statistics and performance log files
+	_TempestSetupProfiling(model, vars);
+
+	// Request transparent huge pages for large data arrays
+	SetDataAllocationHugePages(vars.fHugePages);
+
 	// Setup Method of Lines
 	_TempestSetupMethodOfLines(model, vars);
 
@@ -518,23 +608,30 @@ void _TempestSetupCubedSphereModel(
 	if (vars.strRestartFile == "") {
 		AnnounceStartBlock("Constructing grid");
 	
-		// Maximum number of patches currently equals communicator size
+		// The default layout uses the requested number of patches per
+		// processor, plus one additional patch wherever a partition
+		// crosses from one band of elements to the next (at most
+		// 6 x resolution bands)
 		int nCommSize = 1;
 #ifdef TEMPEST_MPIOMP
 		MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
 #endif
 
-		if (nCommSize < 6) {
-			nCommSize = 6;
+		if (vars.nPatchesPerProcessor < 1) {
+			_EXCEPTIONT("--patchesperproc must be positive");
 		}
 
+		int nPatchCount = nCommSize * vars.nPatchesPerProcessor;
+
+		int nMaxPatchCount = nPatchCount + 6 * vars.nResolutionX;
+
 		GridCSGLL * pGrid = new GridCSGLL(model);
 
 		pGrid->DefineParameters();
 
 		pGrid->SetParameters(
 			vars.nLevels,
-			nCommSize,
+			nMaxPatchCount,
 			vars.nResolutionX,
 			4,
 			vars.nHorizontalOrder,
@@ -564,17 +661,29 @@ void _TempestSetupCubedSphereModel(
 		STLStringHelper::ToLower(vars.strVerticalDiscretization);
 
 		// Set the Model Grid
-		model.SetGrid(pGrid);
+		model.SetGrid(pGrid, nPatchCount);
 
 	// Set the Grid from Restart file
 	} else {
 		AnnounceStartBlock("Constructing Grid from restart file");
 
+		int nCommSize = 1;
+#ifdef TEMPEST_MPIOMP
+		MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
+#endif
+
+		if (vars.nPatchesPerProcessor < 1) {
+			_EXCEPTIONT("--patchesperproc must be positive");
+		}
+
 		Grid * pGrid = new GridCSGLL(model);
 
 		pGrid->DefineParameters();
 
-		model.SetGridFromRestartFile(pGrid, vars.strRestartFile);
+		model.SetGridFromRestartFile(
+			pGrid,
+			vars.strRestartFile,
+			nCommSize * vars.nPatchesPerProcessor);
 	}
 
 	AnnounceEndBlock("Done");
@@ -597,6 +706,21 @@ void _TempestSetupCartesianModel(
 	model.SetDeltaT(vars.timeDeltaT);
 	model.SetEndTime(vars.timeEndTime);
 
+	// Set the number of time steps between patch rebalancing
+	model.SetRebalanceSteps(vars.nRebalanceSteps);
+
+	// Set the adaptive time stepping parameters (used if --dt is zero)
+	model.SetAdaptiveTimestep(
+		vars.dCourantNumber,
+		vars.timeDeltaTMin,
+		vars.timeDeltaTMax);
+
+	// Set the profile, communication statistics and performance log files
+	_TempestSetupProfiling(model, vars);
+
+	// Request transparent huge pages for large data arrays
+	SetDataAllocationHugePages(vars.fHugePages);
+
 	// Setup Method of Lines
 	_TempestSetupMethodOfLines(model, vars);
 
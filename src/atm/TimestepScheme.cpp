@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    TimestepScheme.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "TimestepScheme.h"
+#include "Model.h"
+#include "Grid.h"
+#include "HorizontalDynamics.h"
+#include "VerticalDynamics.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+void TimestepScheme::StepExplicitAndPostProcess(
+	int iDataInitial,
+	int iDataUpdate,
+	const Time & time,
+	double dDeltaT
+) {
+	// Get a copy of the grid
+	Grid * pGrid = m_model.GetGrid();
+
+	// Get a copy of the HorizontalDynamics
+	HorizontalDynamics * pHorizontalDynamics = m_model.GetHorizontalDynamics();
+
+	// Get a copy of the VerticalDynamics
+	VerticalDynamics * pVerticalDynamics = m_model.GetVerticalDynamics();
+
+	// Update all elements before post-processing
+	if ((!pHorizontalDynamics->SupportsElementSubsets()) ||
+	    (!pVerticalDynamics->SupportsElementSubsets())
+	) {
+		pHorizontalDynamics->StepExplicit(
+			iDataInitial, iDataUpdate, time, dDeltaT);
+		pVerticalDynamics->StepExplicit(
+			iDataInitial, iDataUpdate, time, dDeltaT);
+		pGrid->PostProcessSubstage(iDataUpdate, DataType_State);
+		pGrid->PostProcessSubstage(iDataUpdate, DataType_Tracers);
+		return;
+	}
+
+	// Update elements on the patch edge and begin the exchange
+	pHorizontalDynamics->StepExplicitSubset(
+		iDataInitial, iDataUpdate, time, dDeltaT, ElementSubset_PatchEdge);
+	pVerticalDynamics->StepExplicitSubset(
+		iDataInitial, iDataUpdate, time, dDeltaT, ElementSubset_PatchEdge);
+
+	pGrid->BeginPostProcessSubstage(iDataUpdate, DataType_State);
+
+	// Update the patch interior while the exchange is in flight
+	pHorizontalDynamics->StepExplicitSubset(
+		iDataInitial, iDataUpdate, time, dDeltaT, ElementSubset_PatchInterior);
+	pVerticalDynamics->StepExplicitSubset(
+		iDataInitial, iDataUpdate, time, dDeltaT, ElementSubset_PatchInterior);
+
+	pGrid->EndPostProcessSubstage(iDataUpdate, DataType_State);
+
+	pGrid->PostProcessSubstage(iDataUpdate, DataType_Tracers);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -116,6 +116,21 @@ public:
 		double dDeltaT
 	) = 0;
 
+protected:
+	///	<summary>
+	///		Perform the explicit horizontal and vertical updates of one
+	///		substage, followed by post-processing of the updated state and
+	///		tracers.  When supported by the dynamics, elements on the patch
+	///		edge are updated first so that the exchange of state data
+	///		overlaps the update of the patch interior.
+	///	</summary>
+	void StepExplicitAndPostProcess(
+		int iDataInitial,
+		int iDataUpdate,
+		const Time & time,
+		double dDeltaT
+	);
+
 protected:
 	///	<summary>
 	///		Reference to the model.
@@ -96,12 +96,8 @@ void TimestepSchemeARK232::Step(
 /*
 	pGrid->CopyData(0, 1, DataType_State);
 	pGrid->CopyData(0, 1, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
 */
 	// Compute ug1 into index 2 (NO IMPLICIT SOLVE NEEDED HERE)
 	SubcycleStageImplicitExplicitly(time, m_dImpCf[0][0], dDeltaT, 1, 1, 2, 
@@ -128,12 +124,8 @@ void TimestepSchemeARK232::Step(
 	pGrid->LinearCombineData(m_du2fCombo, 6, DataType_Tracers);
 	pGrid->CopyData(6, 4, DataType_State);
 	pGrid->CopyData(6, 4, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		3, 4, time, m_dExpCf[1][1] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		3, 4, time, m_dExpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
 
 	// Compute u2 from uf2 (index 3) into index 4
 	pGrid->CopyData(4, 5, DataType_State);
@@ -147,12 +139,8 @@ void TimestepSchemeARK232::Step(
 	// Compute uf3 from u2 (index 4) into index 8
 	pGrid->LinearCombineData(m_du3fCombo, 7, DataType_State);
 	pGrid->LinearCombineData(m_du3fCombo, 7, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		5, 7, time, m_dExpCf[2][2] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		5, 7, time, m_dExpCf[2][2] * dDeltaT);
-	pGrid->PostProcessSubstage(7, DataType_State);
-	pGrid->PostProcessSubstage(7, DataType_Tracers);
 
 	// Apply hyperdiffusion at the end of the explicit substep (ask Paul)
 	pGrid->CopyData(7, 2, DataType_State);
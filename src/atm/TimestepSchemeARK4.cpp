@@ -293,10 +293,7 @@ void TimestepSchemeARK4::Step(
     Time timeSub1 = time;
     double dtSub1 = m_dExpCf[1][0] * dDeltaT;
     pGrid->LinearCombineData(m_du1fCombo, 1, DataType_State);
-    pHorizontalDynamics->StepExplicit(0, 1, timeSub1, dtSub1);
-	pVerticalDynamics->StepExplicit(0, 1, timeSub1, dtSub1);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    StepExplicitAndPostProcess(0, 1, timeSub1, dtSub1);
 
     // Store the evaluation Kh1 to index 4
     pGrid->LinearCombineData(m_dKh1Combo, 4, DataType_State);
@@ -318,10 +315,7 @@ void TimestepSchemeARK4::Step(
     Time timeSub2 = time;
     double dtSub2 = m_dExpCf[2][1] * dDeltaT;
     pGrid->LinearCombineData(m_du2fCombo, 1, DataType_State);
-    pHorizontalDynamics->StepExplicit(2, 1, timeSub2, dtSub2);
-    pVerticalDynamics->StepExplicit(2, 1, timeSub2, dtSub2);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    StepExplicitAndPostProcess(2, 1, timeSub2, dtSub2);
 
     // Store the evaluation Kh2 to index 6
     pGrid->LinearCombineData(m_dKh2Combo, 6, DataType_State);
@@ -343,10 +337,7 @@ void TimestepSchemeARK4::Step(
     Time timeSub3 = time;
     double dtSub3 = m_dExpCf[3][2] * dDeltaT;
     pGrid->LinearCombineData(m_du3fCombo, 1, DataType_State);
-    pHorizontalDynamics->StepExplicit(2, 1, timeSub2, dtSub2);
-    pVerticalDynamics->StepExplicit(2, 1, timeSub2, dtSub2);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    StepExplicitAndPostProcess(2, 1, timeSub2, dtSub2);
 
     // Store the evaluation Kh3 to index 8
     pGrid->LinearCombineData(m_dKh3Combo, 8, DataType_State);
@@ -368,10 +359,7 @@ void TimestepSchemeARK4::Step(
     Time timeSub4 = time;
     double dtSub4 = m_dExpCf[4][3] * dDeltaT;
     pGrid->LinearCombineData(m_du4fCombo, 1, DataType_State);
-    pHorizontalDynamics->StepExplicit(2, 1, timeSub4, dtSub4);
-    pVerticalDynamics->StepExplicit(2, 1, timeSub4, dtSub4);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    StepExplicitAndPostProcess(2, 1, timeSub4, dtSub4);
 
 	// Store the evaluation Kh4 to index 10
     pGrid->LinearCombineData(m_dKh4Combo, 10, DataType_State);
@@ -395,10 +383,7 @@ void TimestepSchemeARK4::Step(
     Time timeSub5 = time;
     double dtSub5 = m_dExpCf[5][4] * dDeltaT;
     pGrid->LinearCombineData(m_du5fCombo, 1, DataType_State);
-    pHorizontalDynamics->StepExplicit(2, 1, timeSub5, dtSub5);
-    pVerticalDynamics->StepExplicit(2, 1, timeSub5, dtSub5);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    StepExplicitAndPostProcess(2, 1, timeSub5, dtSub5);
 
 	// Store the evaluation Kh5 to index 12
     pGrid->LinearCombineData(m_dKh5Combo, 12, DataType_State);
@@ -420,10 +405,7 @@ void TimestepSchemeARK4::Step(
     Time timeSub6 = time;
     double dtSub6 = m_dExpCf[6][5] * dDeltaT;
     pGrid->LinearCombineData(m_du6fCombo, 1, DataType_State);
-    pHorizontalDynamics->StepExplicit(2, 1, timeSub6, dtSub6);
-    pVerticalDynamics->StepExplicit(2, 1, timeSub6, dtSub6);
-    pGrid->PostProcessSubstage(1, DataType_State);
-    pGrid->PostProcessSubstage(1, DataType_Tracers);
+    StepExplicitAndPostProcess(2, 1, timeSub6, dtSub6);
 
     // Compute u5 from uf5 and store it to index 2 (over u4)
     dtSub5 = m_dImpCf[6][6] * dDeltaT;
@@ -76,12 +76,8 @@ void TimestepSchemeARS222::Step(
 	// Compute uf1 into index 1
 	pGrid->CopyData(0, 1, DataType_State);
 	pGrid->CopyData(0, 1, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
 
 	// Compute u1 into index 2
 	pGrid->CopyData(1, 2, DataType_State);
@@ -95,12 +91,8 @@ void TimestepSchemeARS222::Step(
 	// Compute uf2 from u1 (index 2) into index 3
 	pGrid->LinearCombineData(m_du2fCombo, 3, DataType_State);
 	pGrid->LinearCombineData(m_du2fCombo, 3, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		2, 3, time, m_dExpCf[1][1] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		2, 3, time, m_dExpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
 
 	// Compute u2 from uf2 (index 3) into index 2
 	pVerticalDynamics->StepImplicit(
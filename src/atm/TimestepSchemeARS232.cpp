@@ -88,12 +88,8 @@ void TimestepSchemeARS232::Step(
 	// Compute uf1 into index 1
 	pGrid->CopyData(0, 1, DataType_State);
 	pGrid->CopyData(0, 1, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
 
 	// Compute u1 into index 2
 	pGrid->CopyData(1, 2, DataType_State);
@@ -109,12 +105,8 @@ void TimestepSchemeARS232::Step(
 	pGrid->LinearCombineData(m_du2fCombo, 5, DataType_Tracers);
 	pGrid->CopyData(5, 3, DataType_State);
 	pGrid->CopyData(5, 3, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		2, 3, time, m_dExpCf[1][1] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		2, 3, time, m_dExpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
 
 	// Compute u2 from uf2 (index 3) into index 4
 	pGrid->CopyData(3, 4, DataType_State);
@@ -128,12 +120,8 @@ void TimestepSchemeARS232::Step(
 	// Compute uf3 from u2 (index 4) into index 6
 	pGrid->LinearCombineData(m_du3fCombo, 6, DataType_State);
 	pGrid->LinearCombineData(m_du3fCombo, 6, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		4, 6, time, m_dExpCf[2][2] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		4, 6, time, m_dExpCf[2][2] * dDeltaT);
-	pGrid->PostProcessSubstage(6, DataType_State);
-	pGrid->PostProcessSubstage(6, DataType_Tracers);
 
 	// Compute u3 from uf3 (index 3) into index 6
 	//pVerticalDynamics->StepImplicit(
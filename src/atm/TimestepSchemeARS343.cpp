@@ -162,12 +162,8 @@ void TimestepSchemeARS343::Step(
 	// Compute uf1 into index 1
 	pGrid->CopyData(0, 1, DataType_State);
 	pGrid->CopyData(0, 1, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		0, 1, time, m_dDiagExpCf[0] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		0, 1, time, m_dDiagExpCf[0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
 
 	// Compute u1 into index 2
 	pGrid->CopyData(1, 2, DataType_State);
@@ -181,12 +177,8 @@ void TimestepSchemeARS343::Step(
 	// Compute uf2 from u1 (index 2) into index 7
 	pGrid->LinearCombineData(m_dU2fCombo, 3, DataType_State);
 	pGrid->LinearCombineData(m_dU2fCombo, 3, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		2, 3, time, m_dDiagExpCf[1] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		2, 3, time, m_dDiagExpCf[1] * dDeltaT);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
 
 	// Compute u2 from uf2 (index 3) into index 4
 	pGrid->CopyData(3, 4, DataType_State);
@@ -200,12 +192,8 @@ void TimestepSchemeARS343::Step(
 	// Compute uf3 from u2 (index 4) into index 8
 	pGrid->LinearCombineData(m_dU3fCombo, 5, DataType_State);
 	pGrid->LinearCombineData(m_dU3fCombo, 5, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		4, 5, time, m_dDiagExpCf[2] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		4, 5, time, m_dDiagExpCf[2] * dDeltaT);
-	pGrid->PostProcessSubstage(5, DataType_State);
-	pGrid->PostProcessSubstage(5, DataType_Tracers);
 
 	// Compute u3 from uf3 (index 3) into index 6
 	pGrid->CopyData(5, 6, DataType_State);
@@ -219,12 +207,8 @@ void TimestepSchemeARS343::Step(
 	// Compute uf4 from u3 (index 6) into index 9
 	pGrid->LinearCombineData(m_dU4fCombo, 1, DataType_State);
 	pGrid->LinearCombineData(m_dU4fCombo, 1, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		6, 1, time, m_dDiagExpCf[3] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		6, 1, time, m_dDiagExpCf[3] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
 
 	// NO IMPLICIT STEP ON THE LAST STAGE
 
@@ -108,12 +108,8 @@ void TimestepSchemeARS443::Step(
 	// Compute uf1 into index 1
 	pGrid->CopyData(0, 1, DataType_State);
 	pGrid->CopyData(0, 1, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		0, 1, time, m_dExpCf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
 
 	// Compute u1 into index 2
 	pGrid->CopyData(1, 2, DataType_State);
@@ -129,12 +125,8 @@ void TimestepSchemeARS443::Step(
 	pGrid->LinearCombineData(m_du2fCombo, 7, DataType_Tracers);
 	pGrid->CopyData(7, 3, DataType_State);
 	pGrid->CopyData(7, 3, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		2, 3, time, m_dExpCf[1][1] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		2, 3, time, m_dExpCf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
 
 	// Compute u2 from uf2 (index 3) into index 4
 	pGrid->CopyData(3, 4, DataType_State);
@@ -150,12 +142,8 @@ void TimestepSchemeARS443::Step(
 	pGrid->LinearCombineData(m_du3fCombo, 8, DataType_Tracers);
 	pGrid->CopyData(8, 5, DataType_State);
 	pGrid->CopyData(8, 5, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		4, 5, time, m_dExpCf[2][2] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		4, 5, time, m_dExpCf[2][2] * dDeltaT);
-	pGrid->PostProcessSubstage(5, DataType_State);
-	pGrid->PostProcessSubstage(5, DataType_Tracers);
 
 	// Compute u3 from uf3 (index 3) into index 6
 	pGrid->CopyData(5, 6, DataType_State);
@@ -169,12 +157,8 @@ void TimestepSchemeARS443::Step(
 	// Compute uf4 from u3 (index 6) into index 9
 	pGrid->LinearCombineData(m_du4fCombo, 9, DataType_State);
 	pGrid->LinearCombineData(m_du4fCombo, 9, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		6, 9, time, m_dExpCf[3][3] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		6, 9, time, m_dExpCf[3][3] * dDeltaT);
-	pGrid->PostProcessSubstage(9, DataType_State);
-	pGrid->PostProcessSubstage(9, DataType_Tracers);
 
 	// Compute u2 from uf2 (index 7) into index 2
 	pVerticalDynamics->StepImplicit(
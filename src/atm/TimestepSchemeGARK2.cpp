@@ -94,12 +94,8 @@ void TimestepSchemeGARK2::Step(
 	// Compute uf1 into index 1
 	pGrid->CopyData(0, 1, DataType_State);
 	pGrid->CopyData(0, 1, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		0, 1, time, m_dIECf[0][0] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		0, 1, time, m_dIECf[0][0] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
 
 	// Compute u1 into index 2
 	pGrid->CopyData(1, 2, DataType_State);
@@ -117,12 +113,8 @@ void TimestepSchemeGARK2::Step(
 	// Compute uf2 from u1 (index 2) into index 3
 	pGrid->LinearCombineData(m_du3fCombo, 4, DataType_State);
 	pGrid->LinearCombineData(m_du3fCombo, 4, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		3, 4, time, m_dIECf[1][1] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		3, 4, time, m_dIECf[1][1] * dDeltaT);
-	pGrid->PostProcessSubstage(4, DataType_State);
-	pGrid->PostProcessSubstage(4, DataType_Tracers);
 
 	// Compute u2 from uf2 (index 3) into index 2
 	pVerticalDynamics->StepImplicit(
@@ -121,12 +121,8 @@ void TimestepSchemeSSP3332::Step(
 	pGrid->CopyData(7, 3, DataType_State);
 	pGrid->CopyData(7, 3, DataType_Tracers);
 
-	pHorizontalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		2, 3, time, m_dExpCf[1][0] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
-		2, 3, time, m_dExpCf[1][0] * dDeltaT);
-	pGrid->PostProcessSubstage(3, DataType_State);
-	pGrid->PostProcessSubstage(3, DataType_Tracers);
 
 	// Compute u2 from uf2 (index 3) into index 4
 	pGrid->CopyData(3, 4, DataType_State);
@@ -142,12 +138,8 @@ void TimestepSchemeSSP3332::Step(
 	pGrid->LinearCombineData(m_du3fCombo, 8, DataType_Tracers);
 	pGrid->CopyData(8, 5, DataType_State);
 	pGrid->CopyData(8, 5, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		4, 5, time, m_dExpCf[2][1] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		4, 5, time, m_dExpCf[2][1] * dDeltaT);
-	pGrid->PostProcessSubstage(5, DataType_State);
-	pGrid->PostProcessSubstage(5, DataType_Tracers);
 
 	// Compute u3 from uf3 (index 3) into index 6
 	pGrid->CopyData(5, 6, DataType_State);
@@ -161,12 +153,8 @@ void TimestepSchemeSSP3332::Step(
 	// Compute uf4 from u3 (index 6) into index 9
 	pGrid->LinearCombineData(m_du4fCombo, 1, DataType_State);
 	pGrid->LinearCombineData(m_du4fCombo, 1, DataType_Tracers);
-	pHorizontalDynamics->StepExplicit(
-		6, 1, time, m_dExpCf[3][2] * dDeltaT);
-	pVerticalDynamics->StepExplicit(
+	StepExplicitAndPostProcess(
 		6, 1, time, m_dExpCf[3][2] * dDeltaT);
-	pGrid->PostProcessSubstage(1, DataType_State);
-	pGrid->PostProcessSubstage(1, DataType_Tracers);
 
 	// NO IMPLICIT STEP ON THE LAST STAGE
 
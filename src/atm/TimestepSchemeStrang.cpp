@@ -484,105 +484,66 @@ void TimestepSchemeStrang::Step(
 	if (m_eExplicitDiscretization == ForwardEuler) {
 		pGrid->CopyData(0, 4, DataType_State);
 		pGrid->CopyData(0, 4, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(0, 4, time, dDeltaT);
-		pVerticalDynamics->StepExplicit(0, 4, time, dDeltaT);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		StepExplicitAndPostProcess(0, 4, time, dDeltaT);
 
 	// Explicit fourth-order Runge-Kutta
 	} else if (m_eExplicitDiscretization == RungeKutta4) {
 		pGrid->CopyData(0, 1, DataType_State);
 		pGrid->CopyData(0, 1, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(0, 1, time, dHalfDeltaT);
-		pVerticalDynamics->StepExplicit(0, 1, time, dHalfDeltaT);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		StepExplicitAndPostProcess(0, 1, time, dHalfDeltaT);
 
 		pGrid->CopyData(0, 2, DataType_State);
 		pGrid->CopyData(0, 2, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(1, 2, time, dHalfDeltaT);
-		pVerticalDynamics->StepExplicit(1, 2, time, dHalfDeltaT);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		StepExplicitAndPostProcess(1, 2, time, dHalfDeltaT);
 
 		pGrid->CopyData(0, 3, DataType_State);
 		pGrid->CopyData(0, 3, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(2, 3, time, dDeltaT);
-		pVerticalDynamics->StepExplicit(2, 3, time, dDeltaT);
-		pGrid->PostProcessSubstage(3, DataType_State);
-		pGrid->PostProcessSubstage(3, DataType_Tracers);
+		StepExplicitAndPostProcess(2, 3, time, dDeltaT);
 
 		pGrid->LinearCombineData(m_dRK4Combination, 4, DataType_State);
 		pGrid->LinearCombineData(m_dRK4Combination, 4, DataType_Tracers);
 
-		pHorizontalDynamics->StepExplicit(3, 4, time, dDeltaT / 6.0);
-		pVerticalDynamics->StepExplicit(3, 4, time, dDeltaT / 6.0);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		StepExplicitAndPostProcess(3, 4, time, dDeltaT / 6.0);
 
 	// Explicit strong stability preserving third-order Runge-Kutta
 	} else if (m_eExplicitDiscretization == RungeKuttaSSP3) {
 
 		pGrid->CopyData(0, 1, DataType_State);
 		pGrid->CopyData(0, 1, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(0, 1, time, dDeltaT);
-		pVerticalDynamics->StepExplicit(0, 1, time, dDeltaT);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		StepExplicitAndPostProcess(0, 1, time, dDeltaT);
 
 		pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_State);
 		pGrid->LinearCombineData(m_dSSPRK3CombinationA, 2, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(1, 2, time, 0.25 * dDeltaT);
-		pVerticalDynamics->StepExplicit(1, 2, time, 0.25 * dDeltaT);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		StepExplicitAndPostProcess(1, 2, time, 0.25 * dDeltaT);
 
 		pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_State);
 		pGrid->LinearCombineData(m_dSSPRK3CombinationB, 4, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(2, 4, time, (2.0/3.0) * dDeltaT);
-		pVerticalDynamics->StepExplicit(2, 4, time, (2.0/3.0) * dDeltaT);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		StepExplicitAndPostProcess(2, 4, time, (2.0/3.0) * dDeltaT);
 
 	// Explicit Kinnmark, Gray and Ullrich third-order five-stage Runge-Kutta
 	} else if (m_eExplicitDiscretization == KinnmarkGrayUllrich35) {
 
 		pGrid->CopyData(0, 1, DataType_State);
 		pGrid->CopyData(0, 1, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(0, 1, time, dDeltaT / 5.0);
-		pVerticalDynamics->StepExplicit(0, 1, time, dDeltaT / 5.0);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		StepExplicitAndPostProcess(0, 1, time, dDeltaT / 5.0);
 
 		pGrid->CopyData(0, 2, DataType_State);
 		pGrid->CopyData(0, 2, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(1, 2, time, dDeltaT / 5.0);
-		pVerticalDynamics->StepExplicit(1, 2, time, dDeltaT / 5.0);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		StepExplicitAndPostProcess(1, 2, time, dDeltaT / 5.0);
 
 		pGrid->CopyData(0, 3, DataType_State);
 		pGrid->CopyData(0, 3, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(2, 3, time, dDeltaT / 3.0);
-		pVerticalDynamics->StepExplicit(2, 3, time, dDeltaT / 3.0);
-		pGrid->PostProcessSubstage(3, DataType_State);
-		pGrid->PostProcessSubstage(3, DataType_Tracers);
+		StepExplicitAndPostProcess(2, 3, time, dDeltaT / 3.0);
 
 		pGrid->CopyData(0, 2, DataType_State);
 		pGrid->CopyData(0, 2, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(3, 2, time, 2.0 * dDeltaT / 3.0);
-		pVerticalDynamics->StepExplicit(3, 2, time, 2.0 * dDeltaT / 3.0);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		StepExplicitAndPostProcess(3, 2, time, 2.0 * dDeltaT / 3.0);
 
 		pGrid->LinearCombineData(
 			m_dKinnmarkGrayUllrichCombination, 4, DataType_State);
 		pGrid->LinearCombineData(
 			m_dKinnmarkGrayUllrichCombination, 4, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(2, 4, time, 3.0 * dDeltaT / 4.0);
-		pVerticalDynamics->StepExplicit(2, 4, time, 3.0 * dDeltaT / 4.0);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		StepExplicitAndPostProcess(2, 4, time, 3.0 * dDeltaT / 4.0);
 
 	// Explicit strong stability preserving five-stage third-order Runge-Kutta
 	} else if (m_eExplicitDiscretization == RungeKuttaSSPRK53) {
@@ -591,44 +552,29 @@ void TimestepSchemeStrang::Step(
 
 		pGrid->CopyData(0, 1, DataType_State);
 		pGrid->CopyData(0, 1, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(0, 1, time, dStepOne * dDeltaT);
-		pVerticalDynamics->StepExplicit(0, 1, time, dStepOne * dDeltaT);
-		pGrid->PostProcessSubstage(1, DataType_State);
-		pGrid->PostProcessSubstage(1, DataType_Tracers);
+		StepExplicitAndPostProcess(0, 1, time, dStepOne * dDeltaT);
 
 		pGrid->CopyData(1, 2, DataType_State);
 		pGrid->CopyData(1, 2, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(1, 2, time, dStepOne * dDeltaT);
-		pVerticalDynamics->StepExplicit(1, 2, time, dStepOne * dDeltaT);
-		pGrid->PostProcessSubstage(2, DataType_State);
-		pGrid->PostProcessSubstage(2, DataType_Tracers);
+		StepExplicitAndPostProcess(1, 2, time, dStepOne * dDeltaT);
 
 		const double dStepThree = 0.242995220537396;
 
 		pGrid->LinearCombineData(m_dSSPRK53CombinationA, 3, DataType_State);
 		pGrid->LinearCombineData(m_dSSPRK53CombinationA, 3, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(2, 3, time, dStepThree * dDeltaT);
-		pVerticalDynamics->StepExplicit(2, 3, time, dStepThree * dDeltaT);
-		pGrid->PostProcessSubstage(3, DataType_State);
-		pGrid->PostProcessSubstage(3, DataType_Tracers);
+		StepExplicitAndPostProcess(2, 3, time, dStepThree * dDeltaT);
 
 		const double dStepFour = 0.238458932846290;
 
 		pGrid->LinearCombineData(m_dSSPRK53CombinationB, 0, DataType_State);
 		pGrid->LinearCombineData(m_dSSPRK53CombinationB, 0, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(3, 0, time, dStepFour * dDeltaT);
-		pVerticalDynamics->StepExplicit(3, 0, time, dStepFour * dDeltaT);
-		pGrid->PostProcessSubstage(0, DataType_State);
-		pGrid->PostProcessSubstage(0, DataType_Tracers);
+		StepExplicitAndPostProcess(3, 0, time, dStepFour * dDeltaT);
 
 		const double dStepFive = 0.287632146308408;
 
 		pGrid->LinearCombineData(m_dSSPRK53CombinationC, 4, DataType_State);
 		pGrid->LinearCombineData(m_dSSPRK53CombinationC, 4, DataType_Tracers);
-		pHorizontalDynamics->StepExplicit(0, 4, time, dStepFive * dDeltaT);
-		pVerticalDynamics->StepExplicit(0, 4, time, dStepFive * dDeltaT);
-		pGrid->PostProcessSubstage(4, DataType_State);
-		pGrid->PostProcessSubstage(4, DataType_Tracers);
+		StepExplicitAndPostProcess(0, 4, time, dStepFive * dDeltaT);
 
 	// Invalid explicit discretization
 	} else {
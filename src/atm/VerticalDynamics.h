@@ -17,6 +17,9 @@
 #ifndef _VERTICALDYNAMICS_H_
 #define _VERTICALDYNAMICS_H_
 
+#include "Exception.h"
+#include "ElementSubset.h"
+
 ///////////////////////////////////////////////////////////////////////////////
 
 class Time;
@@ -60,6 +63,12 @@ public:
 	///	</summary>
 	virtual void Initialize() { }
 
+	///	<summary>
+	///		Discard any data stored per active patch.  Called after the
+	///		active patches on this processor have changed.
+	///	</summary>
+	virtual void ResetActivePatchData() { }
+
 public:
 	///	<summary>
 	///		Perform one explicit time step.
@@ -72,6 +81,31 @@ public:
 	) {
 	}
 
+	///	<summary>
+	///		Determine if explicit time steps can be performed on a subset
+	///		of the elements on each patch using StepExplicitSubset().
+	///	</summary>
+	virtual bool SupportsElementSubsets() const {
+		return false;
+	}
+
+	///	<summary>
+	///		Perform one explicit time step on a subset of the elements on
+	///		each patch.
+	///	</summary>
+	virtual void StepExplicitSubset(
+		int iDataInitial,
+		int iDataUpdate,
+		const Time & time,
+		double dDeltaT,
+		ElementSubset eSubset
+	) {
+		if (eSubset != ElementSubset_All) {
+			_EXCEPTIONT("Unimplemented");
+		}
+		StepExplicit(iDataInitial, iDataUpdate, time, dDeltaT);
+	}
+
 	///	<summary>
 	///		Force a full explicit update one time only
 	///	</summary>
@@ -28,6 +28,17 @@
 #include "PolynomialInterp.h"
 #include "LinearAlgebra.h"
 
+#include <vector>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if defined(USE_JACOBIAN_DIAGONAL_BATCHED) && !defined(USE_DIRECTSOLVE)
+#error "USE_JACOBIAN_DIAGONAL_BATCHED requires USE_DIRECTSOLVE"
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 
 //#define HYPERVISC_HORIZONTAL_VELOCITIES
@@ -59,7 +70,8 @@ VerticalDynamicsFEM::VerticalDynamicsFEM(
 	int nHypervisOrder,
 	bool fFullyExplicit,
 	bool fUseReferenceState,
-	bool fForceMassFluxOnLevels
+	bool fForceMassFluxOnLevels,
+	int nJacobianReuseAge
 ) :
 	VerticalDynamics(model),
 	m_nHorizontalOrder(nHorizontalOrder),
@@ -68,7 +80,8 @@ VerticalDynamicsFEM::VerticalDynamicsFEM(
 	m_fUseReferenceState(fUseReferenceState),
 	m_fForceMassFluxOnLevels(fForceMassFluxOnLevels),
 	m_nHypervisOrder(nHypervisOrder),
-	m_dHypervisCoeff(0.0)
+	m_dHypervisCoeff(0.0),
+	m_nJacobianReuseAge(nJacobianReuseAge)
 {
 	if (nHypervisOrder % 2 == 1) {
 		_EXCEPTIONT("Vertical hyperdiffusion order must be even.");
@@ -77,11 +90,19 @@ VerticalDynamicsFEM::VerticalDynamicsFEM(
 	if (nHypervisOrder < 0) {
 		_EXCEPTIONT("Vertical hyperdiffusion order must be nonnegative.");
 	}
+
+	if (nJacobianReuseAge < 0) {
+		_EXCEPTIONT("Jacobian reuse age must be nonnegative.");
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 VerticalDynamicsFEM::~VerticalDynamicsFEM() {
+	for (int t = 0; t < m_vecColumnWorkspaces.size(); t++) {
+		delete m_vecColumnWorkspaces[t];
+	}
+
 #ifdef USE_JFNK_PETSC
 	SNESDestroy(&m_snes);
 	VecDestroy(&m_vecX);
@@ -216,6 +237,17 @@ void VerticalDynamicsFEM::Initialize() {
 	// Initialize pivot vector
 	m_vecIPiv.Allocate(m_nColumnStateSize);
 
+	// Initialize modified Newton iteration
+	if (m_nJacobianReuseAge > 0) {
+#if !defined(USE_DIRECTSOLVE) || defined(USE_JACOBIAN_DIAGONAL_BATCHED)
+		_EXCEPTIONT("Jacobian reuse requires USE_DIRECTSOLVE without "
+			"USE_JACOBIAN_DIAGONAL_BATCHED");
+#endif
+		m_dNewtonX.Allocate(m_nColumnStateSize);
+		m_dNewtonUpdate.Allocate(m_nColumnStateSize);
+	}
+	m_vecJacobianFactors.clear();
+
 
 	// Announce vertical dynamics configuration
 	AnnounceStartBlock("Configuring VerticalDynamicsFEM");
@@ -432,6 +464,49 @@ void VerticalDynamicsFEM::Initialize() {
 	m_dColumnContraMetricAREdge.Allocate(nRElements+1, 3);
 	m_dColumnContraMetricBREdge.Allocate(nRElements+1, 3);
 	m_dColumnContraMetricXiREdge.Allocate(nRElements+1, 3);
+
+	// Column workspaces for the threaded implicit solve.  Each workspace
+	// is a copy of this object, so all column storage is thread private.
+	for (int t = 0; t < m_vecColumnWorkspaces.size(); t++) {
+		delete m_vecColumnWorkspaces[t];
+	}
+	m_vecColumnWorkspaces.clear();
+
+#if defined(USE_DIRECTSOLVE) || defined(USE_DIRECTSOLVE_APPROXJ)
+	int nThreads = 1;
+#ifdef _OPENMP
+	nThreads = omp_get_max_threads();
+#endif
+
+#ifdef USE_JACOBIAN_DIAGONAL_BATCHED
+	m_solverBatch.Initialize(
+		m_nColumnStateSize, m_nJacobianFOffD, m_nJacobianFOffD);
+#endif
+
+	std::vector<VerticalDynamicsFEM *> vecColumnWorkspaces;
+	for (int t = 1; t < nThreads * ColumnBatchWidth; t++) {
+		vecColumnWorkspaces.push_back(new VerticalDynamicsFEM(*this));
+	}
+	m_vecColumnWorkspaces = vecColumnWorkspaces;
+
+	if (nThreads > 1) {
+		Announce("Implicit column solve using %i threads", nThreads);
+	}
+	if (m_nJacobianReuseAge > 0) {
+		Announce("Implicit column Jacobians reused for up to %i solves",
+			m_nJacobianReuseAge);
+	}
+#ifdef USE_JACOBIAN_DIAGONAL_BATCHED
+	Announce("Implicit column solve in batches of %i columns",
+		ColumnBatchWidth);
+#endif
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::ResetActivePatchData() {
+	m_vecJacobianFactors.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -618,6 +693,19 @@ void VerticalDynamicsFEM::StepExplicit(
 	int iDataUpdate,
 	const Time & time,
 	double dDeltaT
+) {
+	StepExplicitSubset(
+		iDataInitial, iDataUpdate, time, dDeltaT, ElementSubset_All);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::StepExplicitSubset(
+	int iDataInitial,
+	int iDataUpdate,
+	const Time & time,
+	double dDeltaT,
+	ElementSubset eSubset
 ) {
 	// Indices of EquationSet variables
 	const int UIx = 0;
@@ -627,7 +715,9 @@ void VerticalDynamicsFEM::StepExplicit(
 	const int RIx = 4;
 
 	// Start the function timer
-	FunctionTimer timer("VerticalStepExplicit");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("VerticalStepExplicit");
+	FunctionTimer timer(s_idTimer);
 
 	// Get a copy of the grid
 	GridGLL * pGrid = dynamic_cast<GridGLL *>(m_model.GetGrid());
@@ -719,10 +809,26 @@ void VerticalDynamicsFEM::StepExplicit(
 		pPatch->InterpolateNodeToREdge(VIx, iDataInitial);
 #endif
 */
-		// Loop over all nodes
+		// Number of finite elements in each coordinate direction
+		const int nHorizontalOrder = pGrid->GetHorizontalOrder();
+
+		const int nElementCountA = box.GetAInteriorWidth() / nHorizontalOrder;
+		const int nElementCountB = box.GetBInteriorWidth() / nHorizontalOrder;
+
+		// Loop over all nodes of elements in the subset
 		for (int i = box.GetAInteriorBegin(); i < box.GetAInteriorEnd(); i++) {
 		for (int j = box.GetBInteriorBegin(); j < box.GetBInteriorEnd(); j++) {
 
+			if (!IsElementInSubset(
+				eSubset,
+				(i - box.GetHaloElements()) / nHorizontalOrder,
+				(j - box.GetHaloElements()) / nHorizontalOrder,
+				nElementCountA,
+				nElementCountB)
+			) {
+				continue;
+			}
+
 /*
 			// Store W in m_dState structure on levels and interfaces
 			if (pGrid->GetVarLocation(WIx) == DataLocation_Node) {
@@ -1234,7 +1340,9 @@ void VerticalDynamicsFEM::StepImplicit(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("VerticalStepImplicit");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("VerticalStepImplicit");
+	FunctionTimer timer(s_idTimer);
 
 	// If fully explicit do nothing
 	if (m_fFullyExplicit) {
@@ -1310,8 +1418,11 @@ void VerticalDynamicsFEM::StepImplicit(
 		int nBElements =
 			box.GetBInteriorWidth() / m_nHorizontalOrder;
 
-		// Loop over all nodes, but only perform calculation on shared
-		// nodes once
+		// Build the list of columns, only performing the calculation on
+		// shared nodes once
+		std::vector<int> vecColumnA;
+		std::vector<int> vecColumnB;
+
 		for (int a = 0; a < nAElements; a++) {
 		for (int b = 0; b < nBElements; b++) {
 
@@ -1332,212 +1443,98 @@ void VerticalDynamicsFEM::StepImplicit(
 
 		for (int i = 0; i < iEnd; i++) {
 		for (int j = 0; j < jEnd; j++) {
+			vecColumnA.push_back(
+				box.GetAInteriorBegin() + a * m_nHorizontalOrder + i);
+			vecColumnB.push_back(
+				box.GetBInteriorBegin() + b * m_nHorizontalOrder + j);
+		}
+		}
 
-			int iA = box.GetAInteriorBegin() + a * m_nHorizontalOrder + i;
-			int iB = box.GetBInteriorBegin() + b * m_nHorizontalOrder + j;
-
-			SetupReferenceColumn(
-				pPatch, iA, iB,
-				dataRefNode,
-				dataInitialNode,
-				dataRefREdge,
-				dataInitialREdge);
-
-#ifdef USE_JACOBIAN_DEBUG
-			BootstrapJacobian();
-#endif
-#ifdef USE_JFNK_PETSC
-			// Use PetSc to solve
-			double * dX;
-			VecGetArray(m_vecX, &dX);
-			memcpy(dX, m_dColumnState, m_nColumnStateSize * sizeof(double));
-			VecRestoreArray(m_vecX, &dX);
-
-			// Solve
-			PetscErrorCode ierr;
-			SNESSolve(m_snes, NULL, m_vecX);
-
-			SNESConvergedReason reason;
-			SNESGetConvergedReason(m_snes, &reason);
-			if ((reason < 0) && (reason != (-5))) {
-				_EXCEPTION1("PetSc solver failed to converge (%i)", reason);
-			}
-
-			VecGetArray(m_vecX, &dX);
-			memcpy(m_dSoln, dX, m_nColumnStateSize * sizeof(double));
-			VecRestoreArray(m_vecX, &dX);
-#endif
-#ifdef USE_JFNK_GMRES
-			// Use Jacobian-Free Newton-Krylov to solve
-			m_dSoln = m_dColumnState;
-
-			double dError =
-				PerformJFNK_NewtonStep_Safe(
-				//PerformBICGSTAB_NewtonStep_Safe(
-					m_dSoln,
-					m_dSoln.GetRows(),
-					1.0e-8);
-
-			// DEBUG (check for NANs in output)
-			if (!(m_dSoln[0] == m_dSoln[0])) {
-				DataArray1D<double> dEval;
-				dEval.Allocate(m_dColumnState.GetRows());
-				Evaluate(m_dSoln, dEval);
-
-				for (int p = 0; p < dEval.GetRows(); p++) {
-					printf("%1.15e %1.15e %1.15e\n",
-					dEval[p], m_dSoln[p] - m_dColumnState[p], m_dColumnState[p]);
-				}
-				for (int p = 0; p < m_dExnerRefREdge.GetRows(); p++) {
-					printf("%1.15e %1.15e\n",
-						m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
-				}
-				_EXCEPTIONT("Inversion failure");
-	    	}
-
-#endif
-#ifdef USE_DIRECTSOLVE_APPROXJ
-			static const double Epsilon = 1.0e-5;
-
-			// Prepare the column
-			PrepareColumn(m_dColumnState);
-
-			// Build the F vector
-			BuildF(m_dColumnState, m_dSoln);
-
-			DataArray1D<double> dJC;
-			dJC.Allocate(m_dColumnState.GetRows());
-
-			DataArray1D<double> dG;
-			dG.Allocate(m_dColumnState.GetRows());
-
-			DataArray1D<double> dJCref;
-			dJCref.Allocate(m_dColumnState.GetRows());
-
-			Evaluate(m_dColumnState, dJCref);
-
-			for (int i = 0; i < m_dColumnState.GetRows(); i++) {
-				dG = m_dColumnState;
-				dG[i] = dG[i] + Epsilon;
+		}
+		}
 
-				Evaluate(dG, dJC);
+		const int nColumns = static_cast<int>(vecColumnA.size());
 
-				for (int j = 0; j < m_dColumnState.GetRows(); j++) {
-					m_matJacobianF[i][j] = (dJC[j] - dJCref[j]) / Epsilon;
-				}
+		// Retained column Jacobians for this patch
+		ColumnJacobianFactor * pFactors = NULL;
+		if (m_nJacobianReuseAge > 0) {
+			if (m_vecJacobianFactors.size() != pGrid->GetActivePatchCount()) {
+				m_vecJacobianFactors.resize(pGrid->GetActivePatchCount());
 			}
-
-			// Use direct solver
-			LAPACK::DGESV(m_matJacobianF, m_dSoln, m_vecIPiv);
-
-			for (int k = 0; k < m_dSoln.GetRows(); k++) {
-				m_dSoln[k] = m_dColumnState[k] - m_dSoln[k];
+			if (m_vecJacobianFactors[n].size() != nColumns) {
+				m_vecJacobianFactors[n].clear();
+				m_vecJacobianFactors[n].resize(nColumns);
 			}
-#endif
-#ifdef USE_DIRECTSOLVE
-			// Prepare the column
-			PrepareColumn(m_dColumnState);
-
-			// Build the F vector
-			BuildF(m_dColumnState, m_dSoln);
-
-			// Build the Jacobian
-			BuildJacobianF(m_dColumnState, &(m_matJacobianF[0][0]));
+			pFactors = &(m_vecJacobianFactors[n][0]);
+		}
 
-#ifdef USE_JACOBIAN_GENERAL
-			// Use direct solver
-			int iInfo = LAPACK::DGESV(m_matJacobianF, m_dSoln, m_vecIPiv);
+		// Solve all columns, distributing them over the column workspaces
+		std::string strColumnError;
 
-			if (iInfo != 0) {
-				_EXCEPTION1("Solution failed: %i", iInfo);
-			}
-#endif
-#ifdef USE_JACOBIAN_DIAGONAL
-			// Use diagonal solver
-			int iInfo = LAPACK::DGBSV(
-				m_matJacobianF, m_dSoln, m_vecIPiv,
-				m_nJacobianFOffD, m_nJacobianFOffD);
+		const int nThreads =
+			(m_vecColumnWorkspaces.size() + 1) / ColumnBatchWidth;
 
-			if (iInfo != 0) {
-				_EXCEPTION1("Solution failed: %i", iInfo);
-			}
+#pragma omp parallel for schedule(dynamic) num_threads(nThreads)
+		for (int c = 0; c < nColumns; c += ColumnBatchWidth) {
+			int iThread = 0;
+#ifdef _OPENMP
+			iThread = omp_get_thread_num();
 #endif
 
-			// DEBUG (check for NANs in output)
-			if (!(m_dSoln[0] == m_dSoln[0])) {
-				DataArray1D<double> dEval;
-				dEval.Allocate(m_dColumnState.GetRows());
-				Evaluate(m_dSoln, dEval);
-
-				for (int p = 0; p < dEval.GetRows(); p++) {
-					printf("%1.15e %1.15e %1.15e\n",
-						dEval[p], m_dSoln[p] - m_dColumnState[p], m_dColumnState[p]);
-				}
-				for (int p = 0; p < m_dExnerRefREdge.GetRows(); p++) {
-					printf("%1.15e %1.15e\n",
-						m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
+			try {
+#ifdef USE_JACOBIAN_DIAGONAL_BATCHED
+				int nBatchColumns = nColumns - c;
+				if (nBatchColumns > ColumnBatchWidth) {
+					nBatchColumns = ColumnBatchWidth;
 				}
-				_EXCEPTIONT("Inversion failure");
-			}
 
-			for (int k = 0; k < m_dSoln.GetRows(); k++) {
-				m_dSoln[k] = m_dColumnState[k] - m_dSoln[k];
-			}
+				SolveImplicitColumnBatch(
+					iThread * ColumnBatchWidth,
+					nBatchColumns,
+					pPatch,
+					&(vecColumnA[c]),
+					&(vecColumnB[c]),
+					dDeltaT,
+					dataRefNode,
+					dataInitialNode,
+					dataUpdateNode,
+					dataRefREdge,
+					dataInitialREdge,
+					dataUpdateREdge,
+					dataReferenceTracer,
+					dataInitialTracer,
+					dataUpdateTracer);
+#else
+				GetColumnWorkspace(iThread)->SolveImplicitColumn(
+					pPatch,
+					vecColumnA[c],
+					vecColumnB[c],
+					dDeltaT,
+					dataRefNode,
+					dataInitialNode,
+					dataUpdateNode,
+					dataRefREdge,
+					dataInitialREdge,
+					dataUpdateREdge,
+					dataReferenceTracer,
+					dataInitialTracer,
+					dataUpdateTracer,
+					(pFactors == NULL)?(NULL):(pFactors + c));
 #endif
 
-			// Apply updated state to thermodynamic closure
-			if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
-				for (int k = 0; k <= nRElements; k++) {
-					dataUpdateREdge[PIx][iA][iB][k] =
-						m_dSoln[VecFIx(FPIx, k)];
-				}
-			} else {
-				for (int k = 0; k < nRElements; k++) {
-					dataUpdateNode[PIx][iA][iB][k] =
-						m_dSoln[VecFIx(FPIx, k)];
-				}
-			}
-
-			// Copy over W
-			if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
-				for (int k = 0; k <= nRElements; k++) {
-					dataUpdateREdge[WIx][iA][iB][k] =
-						m_dSoln[VecFIx(FWIx, k)];
-				}
-			} else {
-				for (int k = 0; k < nRElements; k++) {
-					dataUpdateNode[WIx][iA][iB][k] =
-						m_dSoln[VecFIx(FWIx, k)];
-				}
-			}
-
-			// Copy over Rho
-			if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
-				for (int k = 0; k <= nRElements; k++) {
-					dataUpdateREdge[RIx][iA][iB][k] =
-						m_dSoln[VecFIx(FRIx, k)];
-				}
-			} else {
-				for (int k = 0; k < nRElements; k++) {
-					dataUpdateNode[RIx][iA][iB][k] =
-						m_dSoln[VecFIx(FRIx, k)];
+			} catch(Exception & e) {
+#pragma omp critical
+				{
+					if (strColumnError == "") {
+						strColumnError = e.ToString();
+					}
 				}
 			}
-
-			// Update tracers in column
-			UpdateColumnTracers(
-				dDeltaT,
-				dataInitialNode,
-				dataUpdateNode,
-				dataInitialREdge,
-				dataUpdateREdge,
-				dataReferenceTracer,
-				dataInitialTracer,
-				dataUpdateTracer);
-		}
 		}
 
-		}
+		// Exceptions cannot leave the parallel region
+		if (strColumnError != "") {
+			_EXCEPTION1("%s", strColumnError.c_str());
 		}
 
 		// Copy over new state on shared nodes (edges of constant alpha)
@@ -1638,6 +1635,535 @@ void VerticalDynamicsFEM::StepImplicit(
 }
 
 
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::SolveImplicitColumn(
+	GridPatch * pPatch,
+	int iA,
+	int iB,
+	double dDeltaT,
+	const DataArray4D<double> & dataRefNode,
+	const DataArray4D<double> & dataInitialNode,
+	DataArray4D<double> & dataUpdateNode,
+	const DataArray4D<double> & dataRefREdge,
+	const DataArray4D<double> & dataInitialREdge,
+	DataArray4D<double> & dataUpdateREdge,
+	const DataArray4D<double> & dataReferenceTracer,
+	const DataArray4D<double> & dataInitialTracer,
+	DataArray4D<double> & dataUpdateTracer,
+	ColumnJacobianFactor * pFactor
+) {
+	// Indices of EquationSet variables
+	const int RIx = 4;
+
+	// Store timestep size
+	m_dDeltaT = dDeltaT;
+
+	SetupReferenceColumn(
+		pPatch, iA, iB,
+		dataRefNode,
+		dataInitialNode,
+		dataRefREdge,
+		dataInitialREdge);
+
+#ifdef USE_JACOBIAN_DEBUG
+	BootstrapJacobian();
+#endif
+#ifdef USE_JFNK_PETSC
+	// Use PetSc to solve
+	double * dX;
+	VecGetArray(m_vecX, &dX);
+	memcpy(dX, m_dColumnState, m_nColumnStateSize * sizeof(double));
+	VecRestoreArray(m_vecX, &dX);
+
+	// Solve
+	PetscErrorCode ierr;
+	SNESSolve(m_snes, NULL, m_vecX);
+
+	SNESConvergedReason reason;
+	SNESGetConvergedReason(m_snes, &reason);
+	if ((reason < 0) && (reason != (-5))) {
+		_EXCEPTION1("PetSc solver failed to converge (%i)", reason);
+	}
+
+	VecGetArray(m_vecX, &dX);
+	memcpy(m_dSoln, dX, m_nColumnStateSize * sizeof(double));
+	VecRestoreArray(m_vecX, &dX);
+#endif
+#ifdef USE_JFNK_GMRES
+	// Use Jacobian-Free Newton-Krylov to solve
+	m_dSoln = m_dColumnState;
+
+	double dError =
+		PerformJFNK_NewtonStep_Safe(
+		//PerformBICGSTAB_NewtonStep_Safe(
+			m_dSoln,
+			m_dSoln.GetRows(),
+			1.0e-8);
+
+	// DEBUG (check for NANs in output)
+	if (!(m_dSoln[0] == m_dSoln[0])) {
+		DataArray1D<double> dEval;
+		dEval.Allocate(m_dColumnState.GetRows());
+		Evaluate(m_dSoln, dEval);
+
+		for (int p = 0; p < dEval.GetRows(); p++) {
+			printf("%1.15e %1.15e %1.15e\n",
+			dEval[p], m_dSoln[p] - m_dColumnState[p], m_dColumnState[p]);
+		}
+		for (int p = 0; p < m_dExnerRefREdge.GetRows(); p++) {
+			printf("%1.15e %1.15e\n",
+				m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
+		}
+		_EXCEPTIONT("Inversion failure");
+	    	}
+
+#endif
+#ifdef USE_DIRECTSOLVE_APPROXJ
+	static const double Epsilon = 1.0e-5;
+
+	// Prepare the column
+	PrepareColumn(m_dColumnState);
+
+	// Build the F vector
+	BuildF(m_dColumnState, m_dSoln);
+
+	DataArray1D<double> dJC;
+	dJC.Allocate(m_dColumnState.GetRows());
+
+	DataArray1D<double> dG;
+	dG.Allocate(m_dColumnState.GetRows());
+
+	DataArray1D<double> dJCref;
+	dJCref.Allocate(m_dColumnState.GetRows());
+
+	Evaluate(m_dColumnState, dJCref);
+
+	for (int i = 0; i < m_dColumnState.GetRows(); i++) {
+		dG = m_dColumnState;
+		dG[i] = dG[i] + Epsilon;
+
+		Evaluate(dG, dJC);
+
+		for (int j = 0; j < m_dColumnState.GetRows(); j++) {
+			m_matJacobianF[i][j] = (dJC[j] - dJCref[j]) / Epsilon;
+		}
+	}
+
+	// Use direct solver
+	LAPACK::DGESV(m_matJacobianF, m_dSoln, m_vecIPiv);
+
+	for (int k = 0; k < m_dSoln.GetRows(); k++) {
+		m_dSoln[k] = m_dColumnState[k] - m_dSoln[k];
+	}
+#endif
+#ifdef USE_DIRECTSOLVE
+	// Prepare the column
+	PrepareColumn(m_dColumnState);
+
+	// Build the F vector
+	BuildF(m_dColumnState, m_dSoln);
+
+	// Use modified Newton iteration with a retained Jacobian
+	if (pFactor != NULL) {
+		SolveColumnReusedJacobian(*pFactor);
+
+	} else {
+		// Build the Jacobian
+		BuildJacobianF(m_dColumnState, &(m_matJacobianF[0][0]));
+
+#ifdef USE_JACOBIAN_GENERAL
+		// Use direct solver
+		int iInfo = LAPACK::DGESV(m_matJacobianF, m_dSoln, m_vecIPiv);
+
+		if (iInfo != 0) {
+			_EXCEPTION1("Solution failed: %i", iInfo);
+		}
+#endif
+#ifdef USE_JACOBIAN_DIAGONAL
+		// Use diagonal solver
+		int iInfo = LAPACK::DGBSV(
+			m_matJacobianF, m_dSoln, m_vecIPiv,
+			m_nJacobianFOffD, m_nJacobianFOffD);
+
+		if (iInfo != 0) {
+			_EXCEPTION1("Solution failed: %i", iInfo);
+		}
+#endif
+	}
+
+	// DEBUG (check for NANs in output)
+	if (!(m_dSoln[0] == m_dSoln[0])) {
+		DataArray1D<double> dEval;
+		dEval.Allocate(m_dColumnState.GetRows());
+		Evaluate(m_dSoln, dEval);
+
+		for (int p = 0; p < dEval.GetRows(); p++) {
+			printf("%1.15e %1.15e %1.15e\n",
+				dEval[p], m_dSoln[p] - m_dColumnState[p], m_dColumnState[p]);
+		}
+		for (int p = 0; p < m_dExnerRefREdge.GetRows(); p++) {
+			printf("%1.15e %1.15e\n",
+				m_dExnerRefREdge[p], dataRefREdge[RIx][p][iA][iB]);
+		}
+		_EXCEPTIONT("Inversion failure");
+	}
+
+	for (int k = 0; k < m_dSoln.GetRows(); k++) {
+		m_dSoln[k] = m_dColumnState[k] - m_dSoln[k];
+	}
+#endif
+
+	// Store the updated state
+	StoreImplicitColumn(
+		iA,
+		iB,
+		dDeltaT,
+		dataInitialNode,
+		dataUpdateNode,
+		dataInitialREdge,
+		dataUpdateREdge,
+		dataReferenceTracer,
+		dataInitialTracer,
+		dataUpdateTracer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::SolveColumnReusedJacobian(
+	ColumnJacobianFactor & factor
+) {
+	// Maximum number of Newton iterations
+	static const int MaxIterations = 4;
+
+	// Size of the Newton update, relative to the first update, at which
+	// the iteration is considered converged
+	static const double Tolerance = 1.0e-2;
+
+	// Maximum ratio of successive Newton updates before the retained
+	// Jacobian is considered out of date
+	static const double MaxContraction = 0.2;
+
+	// Rebuild the Jacobian if it has expired
+	bool fFreshJacobian = false;
+
+	if ((!factor.matLU.IsAttached()) ||
+	    (factor.nAge >= m_nJacobianReuseAge) ||
+	    (factor.dDeltaT != m_dDeltaT)
+	) {
+		FactorColumnJacobian(m_dColumnState, factor);
+		fFreshJacobian = true;
+	}
+
+	factor.nAge++;
+
+	// First Newton update
+	SolveFactoredColumnJacobian(factor, m_dSoln);
+
+	double dFirstNorm = 0.0;
+	for (int k = 0; k < m_nColumnStateSize; k++) {
+		m_dNewtonX[k] = m_dColumnState[k] - m_dSoln[k];
+		if (fabs(m_dSoln[k]) > dFirstNorm) {
+			dFirstNorm = fabs(m_dSoln[k]);
+		}
+	}
+
+	// Newton corrections are only needed with a retained Jacobian; with a
+	// fresh Jacobian a single Newton step is taken, as in the direct solve
+	bool fConverged = (fFreshJacobian || (dFirstNorm == 0.0));
+
+	double dPrevNorm = dFirstNorm;
+
+	for (int i = 1; (i < MaxIterations) && (!fConverged); i++) {
+
+		Evaluate(m_dNewtonX, m_dNewtonUpdate);
+
+		SolveFactoredColumnJacobian(factor, m_dNewtonUpdate);
+
+		double dNorm = 0.0;
+		for (int k = 0; k < m_nColumnStateSize; k++) {
+			if (fabs(m_dNewtonUpdate[k]) > dNorm) {
+				dNorm = fabs(m_dNewtonUpdate[k]);
+			}
+		}
+
+		// Slow convergence; rebuild the Jacobian at the current iterate
+		if ((dNorm > MaxContraction * dPrevNorm) && (!fFreshJacobian)) {
+			FactorColumnJacobian(m_dNewtonX, factor);
+			factor.nAge = 1;
+			fFreshJacobian = true;
+
+			Evaluate(m_dNewtonX, m_dNewtonUpdate);
+
+			SolveFactoredColumnJacobian(factor, m_dNewtonUpdate);
+
+			dNorm = 0.0;
+			for (int k = 0; k < m_nColumnStateSize; k++) {
+				if (fabs(m_dNewtonUpdate[k]) > dNorm) {
+					dNorm = fabs(m_dNewtonUpdate[k]);
+				}
+			}
+		}
+
+		for (int k = 0; k < m_nColumnStateSize; k++) {
+			m_dNewtonX[k] -= m_dNewtonUpdate[k];
+		}
+
+		if (dNorm <= Tolerance * dFirstNorm) {
+			fConverged = true;
+		}
+
+		dPrevNorm = dNorm;
+	}
+
+	// Rebuild the Jacobian on the next solve if the iteration stalled
+	if (!fConverged) {
+		factor.nAge = m_nJacobianReuseAge;
+	}
+
+	// Store the total update
+	for (int k = 0; k < m_nColumnStateSize; k++) {
+		m_dSoln[k] = m_dColumnState[k] - m_dNewtonX[k];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::FactorColumnJacobian(
+	const double * dX,
+	ColumnJacobianFactor & factor
+) {
+	if (!factor.matLU.IsAttached()) {
+		factor.matLU.Allocate(
+			m_matJacobianF.GetRows(),
+			m_matJacobianF.GetColumns());
+		factor.vecIPiv.Allocate(m_nColumnStateSize);
+	}
+
+	// Build the Jacobian
+	BuildJacobianF(dX, &(factor.matLU[0][0]));
+
+#if defined(USE_JACOBIAN_DIAGONAL)
+	// Banded diagonal LU decomposition
+	int iInfo =
+		LAPACK::DGBTRF(
+			factor.matLU,
+			factor.vecIPiv,
+			m_nJacobianFOffD,
+			m_nJacobianFOffD);
+#else
+	// LU Decomposition
+	int iInfo =
+		LAPACK::DGETRF(
+			factor.matLU,
+			factor.vecIPiv);
+#endif
+
+	if (iInfo != 0) {
+		_EXCEPTION1("Triangulation failure: %i", iInfo);
+	}
+
+	factor.nAge = 0;
+	factor.dDeltaT = m_dDeltaT;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::SolveFactoredColumnJacobian(
+	ColumnJacobianFactor & factor,
+	DataArray1D<double> & dB
+) {
+#if defined(USE_JACOBIAN_DIAGONAL)
+	// Solve the matrix system using banded LU decomposed matrix
+	int iInfo =
+		LAPACK::DGBTRS(
+			'N',
+			factor.matLU,
+			dB,
+			factor.vecIPiv,
+			m_nJacobianFOffD,
+			m_nJacobianFOffD);
+#else
+	// Solve the matrix system using LU decomposed matrix
+	int iInfo =
+		LAPACK::DGETRS(
+			'N',
+			factor.matLU,
+			dB,
+			factor.vecIPiv);
+#endif
+
+	if (iInfo != 0) {
+		_EXCEPTION1("Solution failed: %i", iInfo);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::SolveImplicitColumnBatch(
+	int iWorkspaceBegin,
+	int nBatchColumns,
+	GridPatch * pPatch,
+	const int * iA,
+	const int * iB,
+	double dDeltaT,
+	const DataArray4D<double> & dataRefNode,
+	const DataArray4D<double> & dataInitialNode,
+	DataArray4D<double> & dataUpdateNode,
+	const DataArray4D<double> & dataRefREdge,
+	const DataArray4D<double> & dataInitialREdge,
+	DataArray4D<double> & dataUpdateREdge,
+	const DataArray4D<double> & dataReferenceTracer,
+	const DataArray4D<double> & dataInitialTracer,
+	DataArray4D<double> & dataUpdateTracer
+) {
+#ifdef USE_JACOBIAN_DIAGONAL_BATCHED
+	BandedSolverBatch & solverBatch =
+		GetColumnWorkspace(iWorkspaceBegin)->m_solverBatch;
+
+	// Build F and the Jacobian in each column of the batch
+	for (int v = 0; v < ColumnBatchWidth; v++) {
+		if (v >= nBatchColumns) {
+			solverBatch.SetLaneIdentity(v);
+			continue;
+		}
+
+		VerticalDynamicsFEM * pLane = GetColumnWorkspace(iWorkspaceBegin + v);
+
+		pLane->m_dDeltaT = dDeltaT;
+
+		pLane->SetupReferenceColumn(
+			pPatch, iA[v], iB[v],
+			dataRefNode,
+			dataInitialNode,
+			dataRefREdge,
+			dataInitialREdge);
+
+		pLane->PrepareColumn(pLane->m_dColumnState);
+
+		pLane->BuildF(pLane->m_dColumnState, pLane->m_dSoln);
+
+		pLane->BuildJacobianF(
+			pLane->m_dColumnState, &(pLane->m_matJacobianF[0][0]));
+
+		solverBatch.SetLane(
+			v, &(pLane->m_matJacobianF[0][0]), &(pLane->m_dSoln[0]));
+	}
+
+	// Factor and solve all columns of the batch in lockstep
+	int iInfo = solverBatch.FactorAndSolve();
+	if (iInfo != 0) {
+		_EXCEPTION1("Solution failed: %i", iInfo);
+	}
+
+	// Store the updated state in each column
+	for (int v = 0; v < nBatchColumns; v++) {
+		VerticalDynamicsFEM * pLane = GetColumnWorkspace(iWorkspaceBegin + v);
+
+		solverBatch.GetLaneSolution(v, &(pLane->m_dSoln[0]));
+
+		// DEBUG (check for NANs in output)
+		if (!(pLane->m_dSoln[0] == pLane->m_dSoln[0])) {
+			_EXCEPTIONT("Inversion failure");
+		}
+
+		for (int k = 0; k < pLane->m_dSoln.GetRows(); k++) {
+			pLane->m_dSoln[k] = pLane->m_dColumnState[k] - pLane->m_dSoln[k];
+		}
+
+		pLane->StoreImplicitColumn(
+			iA[v],
+			iB[v],
+			dDeltaT,
+			dataInitialNode,
+			dataUpdateNode,
+			dataInitialREdge,
+			dataUpdateREdge,
+			dataReferenceTracer,
+			dataInitialTracer,
+			dataUpdateTracer);
+	}
+#else
+	_EXCEPTIONT("Batched column solve requires USE_JACOBIAN_DIAGONAL_BATCHED");
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void VerticalDynamicsFEM::StoreImplicitColumn(
+	int iA,
+	int iB,
+	double dDeltaT,
+	const DataArray4D<double> & dataInitialNode,
+	DataArray4D<double> & dataUpdateNode,
+	const DataArray4D<double> & dataInitialREdge,
+	DataArray4D<double> & dataUpdateREdge,
+	const DataArray4D<double> & dataReferenceTracer,
+	const DataArray4D<double> & dataInitialTracer,
+	DataArray4D<double> & dataUpdateTracer
+) {
+	// Get a copy of the grid
+	Grid * pGrid = m_model.GetGrid();
+
+	// Indices of EquationSet variables
+	const int PIx = 2;
+	const int WIx = 3;
+	const int RIx = 4;
+
+	// Number of radial elements
+	const int nRElements = pGrid->GetRElements();
+
+	// Apply updated state to thermodynamic closure
+	if (pGrid->GetVarLocation(PIx) == DataLocation_REdge) {
+		for (int k = 0; k <= nRElements; k++) {
+			dataUpdateREdge[PIx][iA][iB][k] =
+				m_dSoln[VecFIx(FPIx, k)];
+		}
+	} else {
+		for (int k = 0; k < nRElements; k++) {
+			dataUpdateNode[PIx][iA][iB][k] =
+				m_dSoln[VecFIx(FPIx, k)];
+		}
+	}
+
+	// Copy over W
+	if (pGrid->GetVarLocation(WIx) == DataLocation_REdge) {
+		for (int k = 0; k <= nRElements; k++) {
+			dataUpdateREdge[WIx][iA][iB][k] =
+				m_dSoln[VecFIx(FWIx, k)];
+		}
+	} else {
+		for (int k = 0; k < nRElements; k++) {
+			dataUpdateNode[WIx][iA][iB][k] =
+				m_dSoln[VecFIx(FWIx, k)];
+		}
+	}
+
+	// Copy over Rho
+	if (pGrid->GetVarLocation(RIx) == DataLocation_REdge) {
+		for (int k = 0; k <= nRElements; k++) {
+			dataUpdateREdge[RIx][iA][iB][k] =
+				m_dSoln[VecFIx(FRIx, k)];
+		}
+	} else {
+		for (int k = 0; k < nRElements; k++) {
+			dataUpdateNode[RIx][iA][iB][k] =
+				m_dSoln[VecFIx(FRIx, k)];
+		}
+	}
+
+	// Update tracers in column
+	UpdateColumnTracers(
+		dDeltaT,
+		dataInitialNode,
+		dataUpdateNode,
+		dataInitialREdge,
+		dataUpdateREdge,
+		dataReferenceTracer,
+		dataInitialTracer,
+		dataUpdateTracer);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void VerticalDynamicsFEM::SetupReferenceColumn(
@@ -27,6 +27,12 @@
 #include "DataArray3D.h"
 #include "DataArray4D.h"
 
+#ifdef USE_JACOBIAN_DIAGONAL_BATCHED
+#include "BandedSolverBatch.h"
+#endif
+
+#include <vector>
+
 #ifdef USE_JFNK_PETSC
 #include <petscsnes.h>
 #endif
@@ -59,7 +65,8 @@ public:
 		int nHypervisOrder,
 		bool fFullyExplicit,
 		bool fUseReferenceState,
-		bool fForceMassFluxOnLevels
+		bool fForceMassFluxOnLevels,
+		int nJacobianReuseAge = 0
 	);
 
 	///	<summary>
@@ -73,6 +80,11 @@ public:
 	///	</summary>
 	virtual void Initialize();
 
+	///	<summary>
+	///		Discard stored column Jacobian factorizations.
+	///	</summary>
+	virtual void ResetActivePatchData();
+
 protected:
 	///	<summary>
 	///		Component indices into the F vector.
@@ -147,6 +159,26 @@ public:
 		double dDeltaT
 	);
 
+	///	<summary>
+	///		Explicit terms are evaluated independently in each column, so
+	///		may be advanced on any subset of elements.
+	///	</summary>
+	virtual bool SupportsElementSubsets() const {
+		return true;
+	}
+
+	///	<summary>
+	///		Advance explicit terms of the vertical columns in a subset of
+	///		the elements on each patch one substep.
+	///	</summary>
+	virtual void StepExplicitSubset(
+		int iDataInitial,
+		int iDataUpdate,
+		const Time & time,
+		double dDeltaT,
+		ElementSubset eSubset
+	);
+
 	///	<summary>
 	///		Advance an explicit update of implicit terms one time
 	///	</summary>
@@ -173,6 +205,128 @@ public:
 	);
 
 public:
+	///	<summary>
+	///		Factored Jacobian of a single column, retained across implicit
+	///		solves when the Jacobian is reused.
+	///	</summary>
+	struct ColumnJacobianFactor {
+
+		///	<summary>
+		///		Constructor.
+		///	</summary>
+		ColumnJacobianFactor() :
+			nAge(0),
+			dDeltaT(0.0)
+		{ }
+
+		///	<summary>
+		///		LU decomposition of the Jacobian.
+		///	</summary>
+		DataArray2D<double> matLU;
+
+		///	<summary>
+		///		Pivot indices of the LU decomposition.
+		///	</summary>
+		DataArray1D<int> vecIPiv;
+
+		///	<summary>
+		///		Number of implicit solves using this factorization.
+		///	</summary>
+		int nAge;
+
+		///	<summary>
+		///		Timestep size used to build the Jacobian.
+		///	</summary>
+		double dDeltaT;
+	};
+
+	///	<summary>
+	///		Solve the implicit system in a single column and store the
+	///		result in the update state.  If pFactor is not NULL the
+	///		factored Jacobian it contains is reused.
+	///	</summary>
+	void SolveImplicitColumn(
+		GridPatch * pPatch,
+		int iA,
+		int iB,
+		double dDeltaT,
+		const DataArray4D<double> & dataRefNode,
+		const DataArray4D<double> & dataInitialNode,
+		DataArray4D<double> & dataUpdateNode,
+		const DataArray4D<double> & dataRefREdge,
+		const DataArray4D<double> & dataInitialREdge,
+		DataArray4D<double> & dataUpdateREdge,
+		const DataArray4D<double> & dataReferenceTracer,
+		const DataArray4D<double> & dataInitialTracer,
+		DataArray4D<double> & dataUpdateTracer,
+		ColumnJacobianFactor * pFactor = NULL
+	);
+
+	///	<summary>
+	///		Solve the implicit system in the active column using modified
+	///		Newton iteration with a retained factorization of the Jacobian.
+	///		On entry m_dSoln contains F evaluated at the column state; on
+	///		exit it contains the total Newton update.
+	///	</summary>
+	void SolveColumnReusedJacobian(
+		ColumnJacobianFactor & factor
+	);
+
+	///	<summary>
+	///		Build and factor the Jacobian of the active column at dX.
+	///	</summary>
+	void FactorColumnJacobian(
+		const double * dX,
+		ColumnJacobianFactor & factor
+	);
+
+	///	<summary>
+	///		Solve the system dB := J^{-1} dB using a factored Jacobian.
+	///	</summary>
+	void SolveFactoredColumnJacobian(
+		ColumnJacobianFactor & factor,
+		DataArray1D<double> & dB
+	);
+
+	///	<summary>
+	///		Solve the implicit system in a batch of columns, using the column
+	///		workspaces beginning at iWorkspaceBegin.
+	///	</summary>
+	void SolveImplicitColumnBatch(
+		int iWorkspaceBegin,
+		int nBatchColumns,
+		GridPatch * pPatch,
+		const int * iA,
+		const int * iB,
+		double dDeltaT,
+		const DataArray4D<double> & dataRefNode,
+		const DataArray4D<double> & dataInitialNode,
+		DataArray4D<double> & dataUpdateNode,
+		const DataArray4D<double> & dataRefREdge,
+		const DataArray4D<double> & dataInitialREdge,
+		DataArray4D<double> & dataUpdateREdge,
+		const DataArray4D<double> & dataReferenceTracer,
+		const DataArray4D<double> & dataInitialTracer,
+		DataArray4D<double> & dataUpdateTracer
+	);
+
+	///	<summary>
+	///		Store the solution of the implicit system in the update state
+	///		and update tracers in the active column.
+	///	</summary>
+	void StoreImplicitColumn(
+		int iA,
+		int iB,
+		double dDeltaT,
+		const DataArray4D<double> & dataInitialNode,
+		DataArray4D<double> & dataUpdateNode,
+		const DataArray4D<double> & dataInitialREdge,
+		DataArray4D<double> & dataUpdateREdge,
+		const DataArray4D<double> & dataReferenceTracer,
+		const DataArray4D<double> & dataInitialTracer,
+		DataArray4D<double> & dataUpdateTracer
+	);
+
 	///	<summary>
 	///		Set up the reference column.  This function is called once for
 	///		each column prior to the solve.
@@ -722,6 +876,63 @@ private:
 	///	</summary>
 	DataArray1D<int> m_vecIPiv;
 
+private:
+	///	<summary>
+	///		Number of columns solved together by each thread.
+	///	</summary>
+#ifdef USE_JACOBIAN_DIAGONAL_BATCHED
+	static const int ColumnBatchWidth = BandedSolverBatch::BatchWidth;
+#else
+	static const int ColumnBatchWidth = 1;
+#endif
+
+	///	<summary>
+	///		Get a column workspace.  Thread t uses workspaces
+	///		t * ColumnBatchWidth through (t+1) * ColumnBatchWidth - 1, and
+	///		workspace 0 is this object.
+	///	</summary>
+	VerticalDynamicsFEM * GetColumnWorkspace(int iWorkspace) {
+		if (iWorkspace == 0) {
+			return this;
+		}
+		return m_vecColumnWorkspaces[iWorkspace-1];
+	}
+
+	///	<summary>
+	///		Column workspaces other than this object used in the threaded
+	///		and batched implicit solve.
+	///	</summary>
+	std::vector<VerticalDynamicsFEM *> m_vecColumnWorkspaces;
+
+	///	<summary>
+	///		Maximum number of implicit solves that reuse a factored column
+	///		Jacobian before it is rebuilt (0 to rebuild on every solve).
+	///	</summary>
+	int m_nJacobianReuseAge;
+
+	///	<summary>
+	///		Retained column Jacobians, indexed by active patch and then by
+	///		column in the order columns are solved in StepImplicit.
+	///	</summary>
+	std::vector< std::vector<ColumnJacobianFactor> > m_vecJacobianFactors;
+
+	///	<summary>
+	///		Newton iterate used when reusing the Jacobian.
+	///	</summary>
+	DataArray1D<double> m_dNewtonX;
+
+	///	<summary>
+	///		Newton update used when reusing the Jacobian.
+	///	</summary>
+	DataArray1D<double> m_dNewtonUpdate;
+
+#ifdef USE_JACOBIAN_DIAGONAL_BATCHED
+	///	<summary>
+	///		Batched banded solver.
+	///	</summary>
+	BandedSolverBatch m_solverBatch;
+#endif
+
 #ifdef USE_JACOBIAN_DIAGONAL
 private:
 	///	<summary>
@@ -658,7 +658,9 @@ void VerticalDynamicsSchur::StepExplicit(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("VerticalStepExplicit");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("VerticalStepExplicit");
+	FunctionTimer timer(s_idTimer);
 
 	// Get a copy of the grid
 	GridGLL * pGrid = dynamic_cast<GridGLL *>(m_model.GetGrid());
@@ -1399,7 +1401,9 @@ void VerticalDynamicsSchur::StepImplicit(
 	double dDeltaT
 ) {
 	// Start the function timer
-	FunctionTimer timer("VerticalStepImplicit");
+	static const FunctionTimer::GroupId s_idTimer =
+		FunctionTimer::RegisterGroup("VerticalStepImplicit");
+	FunctionTimer timer(s_idTimer);
 
 	// If fully explicit do nothing
 	if (m_fFullyExplicit) {
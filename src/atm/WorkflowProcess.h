@@ -54,6 +54,21 @@ public:
 	);
 
 public:
+	///	<summary>
+	///		Get the frequency of activation, or zero if this
+	///		WorkflowProcess is never activated.
+	///	</summary>
+	const Time & GetFrequency() const {
+		return m_timeFrequency;
+	}
+
+	///	<summary>
+	///		Get the time of the next activation.
+	///	</summary>
+	const Time & GetNextPerformTime() const {
+		return m_timeNextPerform;
+	}
+
 	///	<summary>
 	///		Determine if this WorkflowProcess is ready to be activated.
 	///	</summary>
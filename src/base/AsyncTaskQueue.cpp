@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    AsyncTaskQueue.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "AsyncTaskQueue.h"
+#include "Exception.h"
+
+#include <exception>
+
+///////////////////////////////////////////////////////////////////////////////
+
+AsyncTaskQueue::AsyncTaskQueue() :
+	m_fInitialized(false),
+	m_fShutdown(false),
+	m_nMaxPendingTasks(0),
+	m_nPendingTasks(0)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////
+
+AsyncTaskQueue::~AsyncTaskQueue() {
+	if (!m_fInitialized) {
+		return;
+	}
+
+	// Errors cannot be propagated from a destructor; remaining tasks are
+	// completed before the thread is joined
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_condTaskDone.wait(lock, [this]{ return (m_nPendingTasks == 0); });
+		m_fShutdown = true;
+	}
+	m_condTaskAdded.notify_all();
+
+	m_thread.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::Initialize(
+	int nMaxPendingTasks
+) {
+	if (m_fInitialized) {
+		_EXCEPTIONT("AsyncTaskQueue already initialized");
+	}
+	if (nMaxPendingTasks < 1) {
+		_EXCEPTION1("Invalid maximum number of pending tasks (%i)",
+			nMaxPendingTasks);
+	}
+
+	m_nMaxPendingTasks = nMaxPendingTasks;
+	m_fInitialized = true;
+
+	m_thread = std::thread(&AsyncTaskQueue::Run, this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::WaitForSlot() {
+	if (!m_fInitialized) {
+		_EXCEPTIONT("AsyncTaskQueue not initialized");
+	}
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_condTaskDone.wait(lock, [this]{
+		return (m_nPendingTasks < m_nMaxPendingTasks); });
+
+	CheckTaskError();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::Push(
+	const Task & task
+) {
+	if (!m_fInitialized) {
+		_EXCEPTIONT("AsyncTaskQueue not initialized");
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_condTaskDone.wait(lock, [this]{
+			return (m_nPendingTasks < m_nMaxPendingTasks); });
+
+		CheckTaskError();
+
+		m_dequeTasks.push_back(task);
+		m_nPendingTasks++;
+	}
+	m_condTaskAdded.notify_one();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::Flush() {
+	if (!m_fInitialized) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_condTaskDone.wait(lock, [this]{ return (m_nPendingTasks == 0); });
+
+	CheckTaskError();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::CheckTaskError() {
+	if (m_strTaskError != "") {
+		std::string strTaskError = m_strTaskError;
+		m_strTaskError = "";
+		_EXCEPTION1("Asynchronous task failed:\n%s", strTaskError.c_str());
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AsyncTaskQueue::Run() {
+	for (;;) {
+		Task task;
+		bool fFailed;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condTaskAdded.wait(lock, [this]{
+				return (m_fShutdown || (m_dequeTasks.size() != 0)); });
+
+			if (m_dequeTasks.size() == 0) {
+				return;
+			}
+
+			task = m_dequeTasks.front();
+			m_dequeTasks.pop_front();
+
+			fFailed = (m_strTaskError != "");
+		}
+
+		// Tasks queued after a failure are discarded
+		std::string strError;
+		try {
+			if (!fFailed) {
+				task();
+			}
+
+		} catch(Exception & e) {
+			strError = e.ToString();
+
+		} catch(std::exception & e) {
+			strError = e.what();
+
+		} catch(...) {
+			strError = "Unknown exception";
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			if ((strError != "") && (m_strTaskError == "")) {
+				m_strTaskError = strError;
+			}
+			m_nPendingTasks--;
+		}
+		m_condTaskDone.notify_all();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
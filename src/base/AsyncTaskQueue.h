@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    AsyncTaskQueue.h
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _ASYNCTASKQUEUE_H_
+#define _ASYNCTASKQUEUE_H_
+
+#include <functional>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A bounded queue of tasks that are executed in order on a single
+///		background thread.  Adding a task blocks while the maximum number
+///		of tasks are pending, which bounds the memory held by queued
+///		tasks.  An exception thrown by a task is reported on the calling
+///		thread at the next call to WaitForSlot(), Push() or Flush().
+///	</summary>
+class AsyncTaskQueue {
+
+public:
+	///	<summary>
+	///		Type of a task.
+	///	</summary>
+	typedef std::function<void()> Task;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	AsyncTaskQueue();
+
+	///	<summary>
+	///		Destructor.  Waits for all pending tasks to complete.
+	///	</summary>
+	~AsyncTaskQueue();
+
+private:
+	///	<summary>
+	///		Copy constructor (disabled).
+	///	</summary>
+	AsyncTaskQueue(const AsyncTaskQueue &);
+
+	///	<summary>
+	///		Assignment operator (disabled).
+	///	</summary>
+	AsyncTaskQueue & operator=(const AsyncTaskQueue &);
+
+public:
+	///	<summary>
+	///		Start the background thread.  At most nMaxPendingTasks tasks
+	///		may be queued or executing at any one time.
+	///	</summary>
+	void Initialize(int nMaxPendingTasks);
+
+	///	<summary>
+	///		Check if the background thread has been started.
+	///	</summary>
+	bool IsInitialized() const {
+		return m_fInitialized;
+	}
+
+	///	<summary>
+	///		Get the maximum number of pending tasks.
+	///	</summary>
+	int GetMaxPendingTasks() const {
+		return m_nMaxPendingTasks;
+	}
+
+	///	<summary>
+	///		Block until fewer than the maximum number of tasks are pending.
+	///	</summary>
+	void WaitForSlot();
+
+	///	<summary>
+	///		Add a task to the queue, blocking until a slot is available.
+	///	</summary>
+	void Push(const Task & task);
+
+	///	<summary>
+	///		Block until all pending tasks have completed.
+	///	</summary>
+	void Flush();
+
+private:
+	///	<summary>
+	///		Throw an exception on the calling thread if a task has failed.
+	///		Must be called with m_mutex locked.
+	///	</summary>
+	void CheckTaskError();
+
+	///	<summary>
+	///		Main loop of the background thread.
+	///	</summary>
+	void Run();
+
+private:
+	///	<summary>
+	///		Flag indicating the background thread has been started.
+	///	</summary>
+	bool m_fInitialized;
+
+	///	<summary>
+	///		Flag indicating the background thread should exit.
+	///	</summary>
+	bool m_fShutdown;
+
+	///	<summary>
+	///		Maximum number of pending tasks.
+	///	</summary>
+	int m_nMaxPendingTasks;
+
+	///	<summary>
+	///		Number of tasks queued or executing.
+	///	</summary>
+	int m_nPendingTasks;
+
+	///	<summary>
+	///		Tasks waiting to be executed.
+	///	</summary>
+	std::deque<Task> m_dequeTasks;
+
+	///	<summary>
+	///		Error message from a failed task, if any.
+	///	</summary>
+	std::string m_strTaskError;
+
+	///	<summary>
+	///		Mutex protecting the queue state.
+	///	</summary>
+	std::mutex m_mutex;
+
+	///	<summary>
+	///		Condition signalled when a task is added or on shutdown.
+	///	</summary>
+	std::condition_variable m_condTaskAdded;
+
+	///	<summary>
+	///		Condition signalled when a task completes.
+	///	</summary>
+	std::condition_variable m_condTaskDone;
+
+	///	<summary>
+	///		Background thread.
+	///	</summary>
+	std::thread m_thread;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
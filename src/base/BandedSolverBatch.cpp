@@ -0,0 +1,297 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    BandedSolverBatch.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "BandedSolverBatch.h"
+#include "Exception.h"
+
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+
+static_assert(BandedSolverBatch::BatchWidth == 4,
+	"BandedSolverBatch::Factor() is unrolled for a batch width of 4");
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BandedSolverBatch::Initialize(
+	int nRows,
+	int nKL,
+	int nKU
+) {
+	if (nRows < 1) {
+		_EXCEPTION1("Invalid number of rows (%i)", nRows);
+	}
+	if ((nKL < 0) || (nKU < 0)) {
+		_EXCEPTION2("Invalid band structure (%i, %i)", nKL, nKU);
+	}
+
+	m_nRows = nRows;
+	m_nKL = nKL;
+	m_nKU = nKU;
+	m_nLDAB = 2 * nKL + nKU + 1;
+
+	m_dAB.Allocate(BatchWidth * m_nLDAB * nRows);
+	m_dB.Allocate(BatchWidth * nRows);
+	m_iPiv.Allocate(BatchWidth * nRows);
+	m_iInfo.Allocate(BatchWidth);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BandedSolverBatch::SetLane(
+	int iLane,
+	const double * dAB,
+	const double * dB
+) {
+	// The first KL rows of each column hold fill-in from pivoting and
+	// are zeroed, as in LAPACK DGBTRF
+	for (int j = 0; j < m_nRows; j++) {
+		const double * dABcol = dAB + m_nLDAB * j;
+		double * dBatchCol = &(m_dAB[BandIx(0, j) + iLane]);
+
+		for (int r = 0; r < m_nKL; r++) {
+			dBatchCol[BatchWidth * r] = 0.0;
+		}
+		for (int r = m_nKL; r < m_nLDAB; r++) {
+			dBatchCol[BatchWidth * r] = dABcol[r];
+		}
+	}
+
+	SetLaneRHS(iLane, dB);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BandedSolverBatch::SetLaneIdentity(
+	int iLane
+) {
+	const int nKV = m_nKL + m_nKU;
+
+	for (int j = 0; j < m_nRows; j++) {
+		double * dBatchCol = &(m_dAB[BandIx(0, j) + iLane]);
+
+		for (int r = 0; r < m_nLDAB; r++) {
+			dBatchCol[BatchWidth * r] = 0.0;
+		}
+		dBatchCol[BatchWidth * nKV] = 1.0;
+
+		m_dB[BatchWidth * j + iLane] = 0.0;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BandedSolverBatch::SetLaneRHS(
+	int iLane,
+	const double * dB
+) {
+	for (int j = 0; j < m_nRows; j++) {
+		m_dB[BatchWidth * j + iLane] = dB[j];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BandedSolverBatch::GetLaneSolution(
+	int iLane,
+	double * dX
+) const {
+	for (int j = 0; j < m_nRows; j++) {
+		dX[j] = m_dB[BatchWidth * j + iLane];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int BandedSolverBatch::Factor() {
+
+	const int n = m_nRows;
+	const int nKV = m_nKL + m_nKU;
+
+	double * dAB = &(m_dAB[0]);
+
+	for (int v = 0; v < BatchWidth; v++) {
+		m_iInfo[v] = 0;
+	}
+
+	// Reciprocal of the pivot in each lane
+	double dInvPivot[BatchWidth];
+
+	// Pivot offset in each lane
+	int iPivot[BatchWidth];
+
+	// Last column of U affected by fill-in in any lane, as tracked by
+	// JU in LAPACK DGBTF2
+	int jFill = 0;
+
+	for (int j = 0; j < n; j++) {
+
+		// Number of subdiagonal entries in this column
+		int nKM = m_nKL;
+		if (j + nKM > n - 1) {
+			nKM = n - 1 - j;
+		}
+
+		// Find pivots independently in each lane
+		for (int v = 0; v < BatchWidth; v++) {
+			iPivot[v] = 0;
+			double dMax = fabs(dAB[BandIx(nKV, j) + v]);
+			for (int i = 1; i <= nKM; i++) {
+				double dAbs = fabs(dAB[BandIx(nKV + i, j) + v]);
+				if (dAbs > dMax) {
+					dMax = dAbs;
+					iPivot[v] = i;
+				}
+			}
+
+			m_iPiv[BatchWidth * j + v] = j + iPivot[v];
+
+			if (jFill < j + m_nKU + iPivot[v]) {
+				jFill = j + m_nKU + iPivot[v];
+			}
+		}
+		if (jFill > n - 1) {
+			jFill = n - 1;
+		}
+
+		// Last column affected by this elimination step (the widest
+		// fill-in over the batch is used so the update is uniform)
+		const int jEnd = jFill;
+
+		// Swap rows independently in each lane
+		for (int v = 0; v < BatchWidth; v++) {
+			if (iPivot[v] != 0) {
+				for (int k = j; k <= jEnd; k++) {
+					int ixA = BandIx(nKV + j - k, k) + v;
+					int ixB = BandIx(nKV + j + iPivot[v] - k, k) + v;
+
+					double dTemp = dAB[ixA];
+					dAB[ixA] = dAB[ixB];
+					dAB[ixB] = dTemp;
+				}
+			}
+
+			double dPivot = dAB[BandIx(nKV, j) + v];
+			if (dPivot != 0.0) {
+				dInvPivot[v] = 1.0 / dPivot;
+			} else {
+				dInvPivot[v] = 0.0;
+				if (m_iInfo[v] == 0) {
+					m_iInfo[v] = j + 1;
+				}
+			}
+		}
+
+		// Compute multipliers
+		for (int i = 1; i <= nKM; i++) {
+			double * dL = dAB + BandIx(nKV + i, j);
+			for (int v = 0; v < BatchWidth; v++) {
+				dL[v] *= dInvPivot[v];
+			}
+		}
+
+		// Rank-one update of the trailing band (subdiagonal entries of
+		// each column are contiguous across rows and lanes)
+		const double * dL = dAB + BandIx(nKV + 1, j);
+		for (int k = j + 1; k <= jEnd; k++) {
+			const double * dU = dAB + BandIx(nKV + j - k, k);
+			double * dA = dAB + BandIx(nKV + j + 1 - k, k);
+
+			const double dU0 = dU[0];
+			const double dU1 = dU[1];
+			const double dU2 = dU[2];
+			const double dU3 = dU[3];
+
+			for (int i = 0; i < BatchWidth * nKM; i += BatchWidth) {
+				dA[i  ] -= dL[i  ] * dU0;
+				dA[i+1] -= dL[i+1] * dU1;
+				dA[i+2] -= dL[i+2] * dU2;
+				dA[i+3] -= dL[i+3] * dU3;
+			}
+		}
+	}
+
+	for (int v = 0; v < BatchWidth; v++) {
+		if (m_iInfo[v] != 0) {
+			return m_iInfo[v];
+		}
+	}
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void BandedSolverBatch::Solve() {
+
+	const int n = m_nRows;
+	const int nKV = m_nKL + m_nKU;
+
+	const double * dAB = &(m_dAB[0]);
+	double * dB = &(m_dB[0]);
+
+	// Apply row interchanges and solve L y = b
+	for (int j = 0; j < n - 1; j++) {
+		int nKM = m_nKL;
+		if (j + nKM > n - 1) {
+			nKM = n - 1 - j;
+		}
+
+		double * dBj = dB + BatchWidth * j;
+
+		for (int v = 0; v < BatchWidth; v++) {
+			int l = m_iPiv[BatchWidth * j + v];
+			if (l != j) {
+				double dTemp = dB[BatchWidth * l + v];
+				dB[BatchWidth * l + v] = dBj[v];
+				dBj[v] = dTemp;
+			}
+		}
+
+		for (int i = 1; i <= nKM; i++) {
+			const double * dL = dAB + BandIx(nKV + i, j);
+			double * dBi = dB + BatchWidth * (j + i);
+			for (int v = 0; v < BatchWidth; v++) {
+				dBi[v] -= dL[v] * dBj[v];
+			}
+		}
+	}
+
+	// Solve U x = y
+	for (int j = n - 1; j >= 0; j--) {
+		double * dBj = dB + BatchWidth * j;
+
+		const double * dD = dAB + BandIx(nKV, j);
+		for (int v = 0; v < BatchWidth; v++) {
+			dBj[v] /= dD[v];
+		}
+
+		int iBegin = j - nKV;
+		if (iBegin < 0) {
+			iBegin = 0;
+		}
+
+		for (int i = iBegin; i < j; i++) {
+			const double * dU = dAB + BandIx(nKV + i - j, j);
+			double * dBi = dB + BatchWidth * i;
+			for (int v = 0; v < BatchWidth; v++) {
+				dBi[v] -= dU[v] * dBj[v];
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
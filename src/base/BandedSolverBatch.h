@@ -0,0 +1,198 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    BandedSolverBatch.h
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _BANDEDSOLVERBATCH_H_
+#define _BANDEDSOLVERBATCH_H_
+
+#include "DataArray1D.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A batched LU factorization and solver for small banded systems that
+///		share the same band structure.  The systems of BatchWidth columns are
+///		interleaved in memory so that each step of the factorization and
+///		solve is performed in lockstep across the batch, which allows the
+///		compiler to vectorize over systems.  Partial pivoting is performed
+///		independently for each system, and produces the same factorization
+///		as LAPACK DGBTRF.
+///	</summary>
+class BandedSolverBatch {
+
+public:
+	///	<summary>
+	///		Number of systems in each batch (one SIMD register of doubles
+	///		on AVX2 hardware).
+	///	</summary>
+	static const int BatchWidth = 4;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	BandedSolverBatch() :
+		m_nRows(0),
+		m_nKL(0),
+		m_nKU(0),
+		m_nLDAB(0)
+	{ }
+
+	///	<summary>
+	///		Initialize the batch for systems of the given size with nKL
+	///		subdiagonals and nKU superdiagonals.
+	///	</summary>
+	void Initialize(
+		int nRows,
+		int nKL,
+		int nKU
+	);
+
+public:
+	///	<summary>
+	///		Get the number of rows in each system.
+	///	</summary>
+	int GetRows() const {
+		return m_nRows;
+	}
+
+	///	<summary>
+	///		Get the leading dimension of the banded matrix storage, which
+	///		must equal 2 * KL + KU + 1 as in LAPACK DGBSV.
+	///	</summary>
+	int GetLDAB() const {
+		return m_nLDAB;
+	}
+
+public:
+	///	<summary>
+	///		Load the system for one lane of the batch.  The matrix dAB is
+	///		stored in LAPACK banded form with leading dimension GetLDAB().
+	///	</summary>
+	void SetLane(
+		int iLane,
+		const double * dAB,
+		const double * dB
+	);
+
+	///	<summary>
+	///		Load the identity system into one lane of the batch.  Used to
+	///		pad partially filled batches.
+	///	</summary>
+	void SetLaneIdentity(
+		int iLane
+	);
+
+	///	<summary>
+	///		Replace the right-hand side of one lane of the batch.
+	///	</summary>
+	void SetLaneRHS(
+		int iLane,
+		const double * dB
+	);
+
+	///	<summary>
+	///		Get the solution vector for one lane of the batch.
+	///	</summary>
+	void GetLaneSolution(
+		int iLane,
+		double * dX
+	) const;
+
+	///	<summary>
+	///		Get the info flag for one lane of the batch (as in LAPACK, zero
+	///		indicates success and i > 0 indicates U(i,i) is exactly zero).
+	///	</summary>
+	int GetLaneInfo(
+		int iLane
+	) const {
+		return m_iInfo[iLane];
+	}
+
+public:
+	///	<summary>
+	///		Compute the LU factorization of all systems in the batch.
+	///		Returns the first nonzero info flag in the batch, or zero.
+	///	</summary>
+	int Factor();
+
+	///	<summary>
+	///		Solve all systems in the batch using the current factorization.
+	///		The solution overwrites the right-hand side.
+	///	</summary>
+	void Solve();
+
+	///	<summary>
+	///		Factor and solve all systems in the batch.
+	///	</summary>
+	int FactorAndSolve() {
+		int iInfo = Factor();
+		Solve();
+		return iInfo;
+	}
+
+protected:
+	///	<summary>
+	///		Index of entry (r,j) of the banded matrix for lane 0.
+	///	</summary>
+	inline int BandIx(int r, int j) const {
+		return (BatchWidth * (m_nLDAB * j + r));
+	}
+
+protected:
+	///	<summary>
+	///		Number of rows in each system.
+	///	</summary>
+	int m_nRows;
+
+	///	<summary>
+	///		Number of subdiagonals.
+	///	</summary>
+	int m_nKL;
+
+	///	<summary>
+	///		Number of superdiagonals.
+	///	</summary>
+	int m_nKU;
+
+	///	<summary>
+	///		Leading dimension of banded storage.
+	///	</summary>
+	int m_nLDAB;
+
+	///	<summary>
+	///		Interleaved banded matrices (and LU factors).
+	///	</summary>
+	DataArray1D<double> m_dAB;
+
+	///	<summary>
+	///		Interleaved right-hand sides (and solutions).
+	///	</summary>
+	DataArray1D<double> m_dB;
+
+	///	<summary>
+	///		Interleaved pivot indices.
+	///	</summary>
+	DataArray1D<int> m_iPiv;
+
+	///	<summary>
+	///		Info flag for each lane.
+	///	</summary>
+	DataArray1D<int> m_iInfo;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    DataAllocator.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "DataAllocator.h"
+#include "Exception.h"
+
+#include <cstring>
+
+#include <sys/mman.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Blocks smaller than this size (in bytes) are zeroed by the calling
+///		thread, since the cost of a parallel region outweighs the benefit.
+///	</summary>
+static const size_t FirstTouchMinimumByteSize = 256 * 1024;
+
+///	<summary>
+///		Flag indicating transparent huge pages are requested.
+///	</summary>
+static bool s_fDataAllocationHugePages = false;
+
+///////////////////////////////////////////////////////////////////////////////
+
+void SetDataAllocationHugePages(bool fHugePages) {
+	s_fDataAllocationHugePages = fHugePages;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool GetDataAllocationHugePages() {
+	return s_fDataAllocationHugePages;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void * AllocateAlignedData(size_t sByteSize) {
+
+	size_t sAlignment = DataAlignment;
+
+	bool fHugePages =
+		(s_fDataAllocationHugePages && (sByteSize >= DataHugePageSize));
+
+	if (fHugePages) {
+		sAlignment = DataHugePageSize;
+	}
+
+	void * ptr = NULL;
+	if (posix_memalign(&ptr, sAlignment, PadToDataAlignment(sByteSize)) != 0) {
+		_EXCEPTION1("Out of memory allocating %lu bytes", sByteSize);
+	}
+
+#if defined(MADV_HUGEPAGE)
+	// Advice only; pages are not backed until first touch
+	if (fHugePages) {
+		madvise(ptr, sByteSize - sByteSize % DataHugePageSize, MADV_HUGEPAGE);
+	}
+#endif
+
+	return ptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FreeAlignedData(void * ptr) {
+	free(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FirstTouchData(
+	unsigned char * pData,
+	size_t sByteSize,
+	size_t nSlices
+) {
+	if ((nSlices == 0) || (sByteSize % nSlices != 0)) {
+		nSlices = 1;
+	}
+
+#ifdef _OPENMP
+	if ((sByteSize < FirstTouchMinimumByteSize) ||
+	    (omp_in_parallel()) ||
+	    (omp_get_max_threads() == 1)
+	) {
+		memset(pData, 0, sByteSize);
+		return;
+	}
+
+	const size_t sSliceByteSize = sByteSize / nSlices;
+
+#pragma omp parallel
+	{
+		const size_t iThread = omp_get_thread_num();
+		const size_t nThreads = omp_get_num_threads();
+
+		const size_t sBegin = (sSliceByteSize * iThread) / nThreads;
+		const size_t sEnd = (sSliceByteSize * (iThread + 1)) / nThreads;
+
+		for (size_t s = 0; s < nSlices; s++) {
+			memset(pData + s * sSliceByteSize + sBegin, 0, sEnd - sBegin);
+		}
+	}
+#else
+	memset(pData, 0, sByteSize);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    DataAllocator.h
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#ifndef _DATAALLOCATOR_H_
+#define _DATAALLOCATOR_H_
+
+#include <cstdlib>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Alignment of all data allocated with AllocateAlignedData (in bytes).
+///		This is one cache line and the width of the widest SIMD registers.
+///	</summary>
+static const size_t DataAlignment = 64;
+
+///	<summary>
+///		Size of a huge page (in bytes).  Allocations of at least this size
+///		are aligned to a huge page boundary when huge pages are enabled.
+///	</summary>
+static const size_t DataHugePageSize = 2 * 1024 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Round a byte size up to a multiple of DataAlignment.
+///	</summary>
+inline size_t PadToDataAlignment(size_t sByteSize) {
+	return ((sByteSize + DataAlignment - 1) / DataAlignment) * DataAlignment;
+}
+
+///	<summary>
+///		Enable or disable transparent huge pages for large allocations.
+///		This should be set before any model data is allocated.
+///	</summary>
+void SetDataAllocationHugePages(bool fHugePages);
+
+///	<summary>
+///		Check if transparent huge pages are enabled for large allocations.
+///	</summary>
+bool GetDataAllocationHugePages();
+
+///	<summary>
+///		Allocate uninitialized memory aligned to DataAlignment.  Memory must
+///		be released with FreeAlignedData.
+///	</summary>
+void * AllocateAlignedData(size_t sByteSize);
+
+///	<summary>
+///		Free memory allocated with AllocateAlignedData.
+///	</summary>
+void FreeAlignedData(void * ptr);
+
+///	<summary>
+///		Zero a block of memory so that each page is first touched by the
+///		OpenMP thread that will later work on it.  The block is divided
+///		into nSlices equal contiguous slices (such as the components of a
+///		state array) and each slice is divided evenly over the threads,
+///		matching a static schedule over the horizontal index inside each
+///		slice.  Small blocks, or calls from within a parallel region, are
+///		zeroed by the calling thread.
+///	</summary>
+void FirstTouchData(
+	unsigned char * pData,
+	size_t sByteSize,
+	size_t nSlices = 1
+);
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif
+
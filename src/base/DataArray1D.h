@@ -21,6 +21,7 @@
 
 #include "Exception.h"
 #include "DataChunk.h"
+#include "DataAllocator.h"
 #include "DataType.h"
 #include "DataLocation.h"
 
@@ -122,7 +123,8 @@ public:
 
 			m_sSize = sSize;
 
-			m_data = reinterpret_cast<T *>(malloc(GetByteSize()));
+			m_data = reinterpret_cast<T *>(
+				AllocateAlignedData(GetByteSize()));
 		}
 
 		Zero();
@@ -168,7 +170,7 @@ public:
 	///	</summary>
 	virtual void Detach() {
 		if ((m_fOwnsData) && (m_data != NULL)) {
-			delete[] m_data;
+			FreeAlignedData(m_data);
 		}
 		m_fOwnsData = true;
 		m_data = NULL;
@@ -21,6 +21,7 @@
 
 #include "Exception.h"
 #include "DataChunk.h"
+#include "DataAllocator.h"
 #include "DataType.h"
 #include "DataLocation.h"
 #include "Subscript.h"
@@ -160,7 +161,8 @@ public:
 			m_sSize[1] = sSize1;
 			m_sSize[2] = sSize2;
 
-			m_data1D = reinterpret_cast<T *>(malloc(GetByteSize()));
+			m_data1D = reinterpret_cast<T *>(
+				AllocateAlignedData(GetByteSize()));
 		}
 
 		Zero();
@@ -210,7 +212,7 @@ public:
 	///	</summary>
 	virtual void Detach() {
 		if ((m_fOwnsData) && (m_data1D != NULL)) {
-			delete[] m_data1D;
+			FreeAlignedData(m_data1D);
 		}
 		m_fOwnsData = true;
 		m_data1D = NULL;
@@ -21,12 +21,14 @@
 
 #include "Exception.h"
 #include "DataChunk.h"
+#include "DataAllocator.h"
 #include "DataType.h"
 #include "DataLocation.h"
 #include "Subscript.h"
 
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 template <typename T>
 class DataArray4D : public DataChunk {
@@ -131,6 +133,15 @@ public:
 		}
 	}
 
+	///	<summary>
+	///		Get the number of slices distributed over threads on first
+	///		touch.  Each index of the leading dimension (such as the
+	///		component of a state array) is one slice.
+	///	</summary>
+	virtual size_t GetFirstTouchSlices() const {
+		return m_sSize[0];
+	}
+
 	///	<summary>
 	///		Allocate data in this DataArray4D.
 	///	</summary>
@@ -176,7 +187,8 @@ public:
 			m_sSize[2] = sSize2;
 			m_sSize[3] = sSize3;
 
-			m_data1D = reinterpret_cast<T *>(malloc(GetByteSize()));
+			m_data1D = reinterpret_cast<T *>(
+				AllocateAlignedData(GetByteSize()));
 		}
 
 		Zero();
@@ -228,7 +240,7 @@ public:
 	///	</summary>
 	virtual void Detach() {
 		if ((m_fOwnsData) && (m_data1D != NULL)) {
-			delete[] m_data1D;
+			FreeAlignedData(m_data1D);
 		}
 		m_fOwnsData = true;
 		m_data1D = NULL;
@@ -442,6 +454,78 @@ public:
 		}
 	}
 
+	///	<summary>
+	///		Replace this DataArray4D with x times this DataArray4D plus the
+	///		sum of vecCoeff[m] times vecData[m].  All arrays are traversed
+	///		once, in cache-sized blocks, and the result is identical to
+	///		calling Scale() (or Zero() if x is zero) followed by AddProduct()
+	///		for each term in order.
+	///	</summary>
+	void LinearCombine(
+		const T & x,
+		const std::vector<const DataArray4D<T> *> & vecData,
+		const std::vector<T> & vecCoeff
+	) {
+		// Check that this DataArray4D is attached to a data object
+		if (!IsAttached()) {
+			_EXCEPTIONT("Attempted operation on unattached DataArray4D");
+		}
+		if (vecData.size() != vecCoeff.size()) {
+			_EXCEPTIONT("Data and coefficient vectors must have the same size");
+		}
+		for (size_t m = 0; m < vecData.size(); m++) {
+			if (!vecData[m]->IsAttached()) {
+				_EXCEPTIONT("Attempted operation on unattached DataArray4D");
+			}
+			if ((vecData[m]->GetSize(0) != GetSize(0)) ||
+			    (vecData[m]->GetSize(1) != GetSize(1)) ||
+			    (vecData[m]->GetSize(2) != GetSize(2)) ||
+			    (vecData[m]->GetSize(3) != GetSize(3))
+			) {
+				_EXCEPTIONT("Dimension mismatch in DataArray4D");
+			}
+		}
+
+		// Number of values in each block
+		const size_t sBlockSize = 512;
+
+		const size_t sTotalSize = GetTotalSize();
+		const long lBlocks = (sTotalSize + sBlockSize - 1) / sBlockSize;
+
+		const int nTerms = vecData.size();
+
+#pragma omp parallel for schedule(static) if (lBlocks >= 64)
+		for (long b = 0; b < lBlocks; b++) {
+			const size_t sBegin = b * sBlockSize;
+
+			size_t sCount = sBlockSize;
+			if (sBegin + sCount > sTotalSize) {
+				sCount = sTotalSize - sBegin;
+			}
+
+			T * const dDest = m_data1D + sBegin;
+
+			if (x == static_cast<T>(0)) {
+				for (size_t i = 0; i < sCount; i++) {
+					dDest[i] = static_cast<T>(0);
+				}
+			} else if (x != static_cast<T>(1)) {
+				for (size_t i = 0; i < sCount; i++) {
+					dDest[i] *= x;
+				}
+			}
+
+			for (int m = 0; m < nTerms; m++) {
+				const T * const dSrc = vecData[m]->m_data1D + sBegin;
+				const T c = vecCoeff[m];
+
+				for (size_t i = 0; i < sCount; i++) {
+					dDest[i] += c * dSrc[i];
+				}
+			}
+		}
+	}
+
 public:
 	///	<summary>
 	///		Subscript DSEL operator.
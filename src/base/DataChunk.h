@@ -36,6 +36,14 @@ public:
 	///	</summary>
 	virtual size_t GetByteSize() const = 0;
 
+	///	<summary>
+	///		Get the number of equal contiguous slices of this DataChunk
+	///		that are each distributed over threads on first touch.
+	///	</summary>
+	virtual size_t GetFirstTouchSlices() const {
+		return 1;
+	}
+
 	///	<summary>
 	///		Determine if this DataChunk is attached to a data array.
 	///	</summary>
@@ -15,22 +15,13 @@
 ///	</remarks>
 
 #include "DataContainer.h"
+#include "DataAllocator.h"
 
 #include "Exception.h"
 
 #include <cstdlib>
 #include <cstring>
 
-#include <iostream>
-
-///////////////////////////////////////////////////////////////////////////////
-
-static const size_t int_aligned_size = sizeof(size_t);
-static const size_t float_aligned_size = sizeof(size_t);
-static const size_t double_aligned_size = sizeof(double);
-static const size_t size_t_aligned_size = sizeof(size_t);
-static const size_t bool_aligned_size = sizeof(size_t);
-
 ///////////////////////////////////////////////////////////////////////////////
 
 DataContainer::DataContainer() :
@@ -42,11 +33,7 @@ DataContainer::DataContainer() :
 
 DataContainer::~DataContainer() {
 	if ((m_fOwnsData) && (m_pAllocatedMemory != NULL)) {
-#if defined(__INTEL_COMPILER)
-		_mm_free(m_pAllocatedMemory);
-#else
-		free(m_pAllocatedMemory);
-#endif
+		FreeAlignedData(m_pAllocatedMemory);
 	}
 }
 
@@ -54,7 +41,8 @@ DataContainer::~DataContainer() {
 
 size_t DataContainer::GetTotalByteSize() const {
 	
-	// Get the accumulated size of all DataChunks
+	// Get the accumulated size of all DataChunks, each padded so that
+	// the next DataChunk begins on an aligned boundary
 	size_t sAccumulated = 0;
 
 	for (size_t i = 0; i < m_vecDataChunks.size(); i++) {
@@ -66,7 +54,51 @@ size_t DataContainer::GetTotalByteSize() const {
 		if (sByteSize % sizeof(size_t) != 0) {
 			_EXCEPTIONT("Misaligned array detected in DataContainer");
 		}
-		sAccumulated += sByteSize;
+		sAccumulated += PadToDataAlignment(sByteSize);
+	}
+
+	return sAccumulated;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t DataContainer::GetUnpaddedByteSize() const {
+
+	size_t sAccumulated = 0;
+
+	for (size_t i = 0; i < m_vecDataChunks.size(); i++) {
+		sAccumulated += GetDataChunkByteSize(i);
+	}
+
+	return sAccumulated;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t DataContainer::GetDataChunkByteSize(size_t ix) const {
+
+	if (ix >= m_vecDataChunks.size()) {
+		_EXCEPTIONT("DataChunk index out of range");
+	}
+
+	const DataChunk * pDataChunk =
+		reinterpret_cast<const DataChunk *>(m_vecDataChunks[ix]);
+
+	return pDataChunk->GetByteSize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t DataContainer::GetDataChunkOffset(size_t ix) const {
+
+	if (ix >= m_vecDataChunks.size()) {
+		_EXCEPTIONT("DataChunk index out of range");
+	}
+
+	size_t sAccumulated = 0;
+
+	for (size_t i = 0; i < ix; i++) {
+		sAccumulated += PadToDataAlignment(GetDataChunkByteSize(i));
 	}
 
 	return sAccumulated;
@@ -84,34 +116,34 @@ void DataContainer::Allocate() {
 	// Allocate memory as one contiguous chunk
 	size_t sTotalByteSize = GetTotalByteSize();
 
-#if defined(__INTEL_COMPILER)
 	m_pAllocatedMemory =
-		reinterpret_cast<unsigned char*>(_mm_malloc(sTotalByteSize, 64));
-#else
-	m_pAllocatedMemory =
-		reinterpret_cast<unsigned char*>(malloc(sTotalByteSize));
-#endif
-
-	if (m_pAllocatedMemory == NULL) {
-		_EXCEPTIONT("Out of memory");
-	}
-
-	// Initialize allocated memory to zero
-	memset(m_pAllocatedMemory, 0, sTotalByteSize);
+		reinterpret_cast<unsigned char*>(AllocateAlignedData(sTotalByteSize));
 
-	// Assign memory to DataChunks
+	// Initialize allocated memory to zero, with each page first touched
+	// by the thread that will work on it
 	unsigned char * pAccumulated = m_pAllocatedMemory;
 
 	for (size_t i = 0; i < m_vecDataChunks.size(); i++) {
 		DataChunk * pDataChunk =
 			reinterpret_cast<DataChunk*>(m_vecDataChunks[i]);
 
-		pDataChunk->AttachToData(
-			reinterpret_cast<void *>(pAccumulated));
+		size_t sByteSize = pDataChunk->GetByteSize();
+		size_t sPaddedByteSize = PadToDataAlignment(sByteSize);
+
+		FirstTouchData(
+			pAccumulated,
+			sByteSize,
+			pDataChunk->GetFirstTouchSlices());
+
+		memset(pAccumulated + sByteSize, 0, sPaddedByteSize - sByteSize);
 
-#pragma message "Alignment may be an issue here on 32-bit systems"
-		pAccumulated += pDataChunk->GetByteSize();
+		pAccumulated += sPaddedByteSize;
 	}
+
+	// Assign memory to DataChunks
+	m_fOwnsData = true;
+
+	AttachDataChunks();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -133,17 +165,7 @@ void DataContainer::AttachTo(
 	m_pAllocatedMemory = pAllocatedMemory;
 
 	// Assign memory to DataChunks
-	unsigned char * pAccumulated = m_pAllocatedMemory;
-
-	for (size_t i = 0; i < m_vecDataChunks.size(); i++) {
-
-		DataChunk * pDataChunk =
-			reinterpret_cast<DataChunk *>(m_vecDataChunks[i]);
-		pDataChunk->AttachToData(
-			reinterpret_cast<void *>(pAccumulated));
-
-		pAccumulated += pDataChunk->GetByteSize();
-	}
+	AttachDataChunks();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -158,7 +180,7 @@ void DataContainer::Detach() {
 	}
 
 	if ((m_fOwnsData) && (m_pAllocatedMemory != NULL)) {
-		free(m_pAllocatedMemory);
+		FreeAlignedData(m_pAllocatedMemory);
 	}
 
 	m_fOwnsData = true;
@@ -167,3 +189,20 @@ void DataContainer::Detach() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void DataContainer::AttachDataChunks() {
+
+	unsigned char * pAccumulated = m_pAllocatedMemory;
+
+	for (size_t i = 0; i < m_vecDataChunks.size(); i++) {
+
+		DataChunk * pDataChunk =
+			reinterpret_cast<DataChunk *>(m_vecDataChunks[i]);
+		pDataChunk->AttachToData(
+			reinterpret_cast<void *>(pAccumulated));
+
+		pAccumulated += PadToDataAlignment(pDataChunk->GetByteSize());
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -49,10 +49,43 @@ public:
 	}
 
 	///	<summary>
-	///		Get the total size of the DataContainer (in bytes).
+	///		Get the total size of the DataContainer (in bytes).  Each
+	///		DataChunk is padded to a multiple of DataAlignment so that
+	///		every DataChunk begins on an aligned boundary.
 	///	</summary>
 	size_t GetTotalByteSize() const;
 
+	///	<summary>
+	///		Get the total size of all DataChunks without padding (in bytes).
+	///		This is the size of the DataContainer in restart files.
+	///	</summary>
+	size_t GetUnpaddedByteSize() const;
+
+	///	<summary>
+	///		Get the number of DataChunks in the DataContainer.
+	///	</summary>
+	size_t GetDataChunkCount() const {
+		return m_vecDataChunks.size();
+	}
+
+	///	<summary>
+	///		Get the specified DataChunk.
+	///	</summary>
+	DataChunk * GetDataChunk(size_t ix) const {
+		return reinterpret_cast<DataChunk *>(m_vecDataChunks[ix]);
+	}
+
+	///	<summary>
+	///		Get the size of the specified DataChunk without padding (in bytes).
+	///	</summary>
+	size_t GetDataChunkByteSize(size_t ix) const;
+
+	///	<summary>
+	///		Get the offset of the specified DataChunk from the start of the
+	///		allocated memory (in bytes).
+	///	</summary>
+	size_t GetDataChunkOffset(size_t ix) const;
+
 	///	<summary>
 	///		Get a pointer to the data.
 	///	</summary>
@@ -68,7 +101,9 @@ public:
 	}
 
 	///	<summary>
-	///		Allocate an array for all DataChunks.
+	///		Allocate an aligned array for all DataChunks.  Memory is zeroed
+	///		in parallel so that pages are placed near the OpenMP threads
+	///		that work on them.
 	///	</summary>
 	void Allocate();
 
@@ -94,6 +129,12 @@ public:
 		return (m_pAllocatedMemory != NULL);
 	}
 
+private:
+	///	<summary>
+	///		Attach all DataChunks to their location in the allocated memory.
+	///	</summary>
+	void AttachDataChunks();
+
 private:
 	///	<summary>
 	///		Flag indicating that this DataContainer owns is memory space.
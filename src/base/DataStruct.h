@@ -21,6 +21,7 @@
 
 #include "Exception.h"
 #include "DataChunk.h"
+#include "DataAllocator.h"
 
 #include <cstdlib>
 #include <cstring>
@@ -78,7 +79,8 @@ public:
 		if (m_data == NULL) {
 			Detach();
 
-			m_data = reinterpret_cast<T *>(malloc(GetByteSize()));
+			m_data = reinterpret_cast<T *>(
+				AllocateAlignedData(GetByteSize()));
 		}
 
 		Zero();
@@ -111,7 +113,7 @@ public:
 	///	</summary>
 	virtual void Detach() {
 		if ((m_fOwnsData) && (m_data != NULL)) {
-			delete[] m_data;
+			FreeAlignedData(m_data);
 		}
 		m_fOwnsData = true;
 		m_data = NULL;
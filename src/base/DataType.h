@@ -50,4 +50,60 @@ enum DataType {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Get the name of a DataType.
+///	</summary>
+inline const char * DataTypeToString(DataType eDataType) {
+	switch (eDataType) {
+		case DataType_All:
+			return "All";
+		case DataType_State:
+			return "State";
+		case DataType_RefState:
+			return "RefState";
+		case DataType_Tracers:
+			return "Tracers";
+		case DataType_Auxiliary2D:
+			return "Auxiliary2D";
+		case DataType_Auxiliary3D:
+			return "Auxiliary3D";
+		case DataType_Jacobian:
+			return "Jacobian";
+		case DataType_ElementArea:
+			return "ElementArea";
+		case DataType_Topography:
+			return "Topography";
+		case DataType_TopographyDeriv:
+			return "TopographyDeriv";
+		case DataType_Longitude:
+			return "Longitude";
+		case DataType_Latitude:
+			return "Latitude";
+		case DataType_Z:
+			return "Z";
+		case DataType_Pressure:
+			return "Pressure";
+		case DataType_SurfacePressure:
+			return "SurfacePressure";
+		case DataType_KineticEnergy:
+			return "KineticEnergy";
+		case DataType_Vorticity:
+			return "Vorticity";
+		case DataType_Divergence:
+			return "Divergence";
+		case DataType_Temperature:
+			return "Temperature";
+		case DataType_RayleighStrength:
+			return "RayleighStrength";
+		case DataType_Richardson:
+			return "Richardson";
+		case DataType_None:
+			return "None";
+		default:
+			return "Unknown";
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 #endif
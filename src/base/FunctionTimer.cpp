@@ -16,73 +16,468 @@
 
 #include "FunctionTimer.h"
 #include "Exception.h"
+#include "Announce.h"
 
-#include <iostream>
-#include <sys/time.h>
+#ifdef TEMPEST_MPIOMP
+#include <mpi.h>
+#endif
+
+#include <cstdio>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <mutex>
+#include <memory>
 
 ///////////////////////////////////////////////////////////////////////////////
 
-FunctionTimer::GroupDataMap FunctionTimer::m_mapGroupData;
+///	<summary>
+///		A node of the call tree of a thread.
+///	</summary>
+struct FunctionTimerNode {
+
+	///	<summary>
+	///		Group of this node, or InvalidGroupId for the root.
+	///	</summary>
+	FunctionTimer::GroupId idGroup;
+
+	///	<summary>
+	///		Index of the parent node, or -1 for the root.
+	///	</summary>
+	int iParent;
+
+	///	<summary>
+	///		Inclusive time in nanoseconds.
+	///	</summary>
+	unsigned long long iTotalTime;
+
+	///	<summary>
+	///		Inclusive time of all child nodes in nanoseconds.
+	///	</summary>
+	unsigned long long iChildTime;
+
+	///	<summary>
+	///		Number of entries.
+	///	</summary>
+	unsigned int nEntries;
+
+	///	<summary>
+	///		Indices of child nodes.
+	///	</summary>
+	std::vector<int> vecChildren;
+};
 
 ///////////////////////////////////////////////////////////////////////////////
 
-FunctionTimer::FunctionTimer(const char *szGroup) {
+///	<summary>
+///		Timer data owned by a single thread.
+///	</summary>
+struct FunctionTimerThreadData {
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	FunctionTimerThreadData() :
+		iCurrentNode(0)
+	{
+		vecNodes.resize(1);
+		vecNodes[0].idGroup = FunctionTimer::InvalidGroupId;
+		vecNodes[0].iParent = (-1);
+		vecNodes[0].iTotalTime = 0;
+		vecNodes[0].iChildTime = 0;
+		vecNodes[0].nEntries = 0;
+	}
+
+	///	<summary>
+	///		Group data records, indexed by group.
+	///	</summary>
+	std::vector<FunctionTimer::TimerGroupData> vecGroupData;
 
-	// Assign group name
-	if (szGroup == NULL) {
-		m_strGroup = "";
-	} else {
-		m_strGroup = szGroup;
+	///	<summary>
+	///		Number of active timers of each group, used to avoid double
+	///		counting time in the group records under recursion.
+	///	</summary>
+	std::vector<int> vecActiveCount;
+
+	///	<summary>
+	///		Call tree, with the root at index 0.
+	///	</summary>
+	std::vector<FunctionTimerNode> vecNodes;
+
+	///	<summary>
+	///		Index of the innermost active node.
+	///	</summary>
+	int iCurrentNode;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Registry of group names and per-thread timer data.
+///	</summary>
+struct FunctionTimerRegistry {
+
+	///	<summary>
+	///		Mutex protecting the registry.
+	///	</summary>
+	std::mutex mutex;
+
+	///	<summary>
+	///		Names of all groups, indexed by group.
+	///	</summary>
+	std::vector<std::string> vecNames;
+
+	///	<summary>
+	///		Map from group name to group.
+	///	</summary>
+	std::map<std::string, FunctionTimer::GroupId> mapGroups;
+
+	///	<summary>
+	///		Timer data of all threads that have used a named timer.
+	///	</summary>
+	std::vector< std::unique_ptr<FunctionTimerThreadData> > vecThreadData;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get the timer registry.
+///	</summary>
+static FunctionTimerRegistry & GetTimerRegistry() {
+	static FunctionTimerRegistry s_registry;
+	return s_registry;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Timer data of the calling thread.
+///	</summary>
+static thread_local FunctionTimerThreadData * s_pThreadTimerData = NULL;
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get the timer data of the calling thread.
+///	</summary>
+static FunctionTimerThreadData & GetThreadTimerData() {
+	if (s_pThreadTimerData == NULL) {
+		FunctionTimerRegistry & registry = GetTimerRegistry();
+
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		registry.vecThreadData.push_back(
+			std::unique_ptr<FunctionTimerThreadData>(
+				new FunctionTimerThreadData));
+
+		s_pThreadTimerData = registry.vecThreadData.back().get();
+	}
+	return (*s_pThreadTimerData);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get the group data record of the calling thread.
+///	</summary>
+static FunctionTimer::TimerGroupData & GetThreadGroupData(
+	FunctionTimer::GroupId idGroup
+) {
+	FunctionTimerThreadData & data = GetThreadTimerData();
+
+	if (idGroup >= data.vecGroupData.size()) {
+		FunctionTimer::TimerGroupData tgdEmpty;
+		tgdEmpty.iTotalTime = 0;
+		tgdEmpty.nEntries = 0;
+
+		data.vecGroupData.resize(idGroup + 1, tgdEmpty);
+		data.vecActiveCount.resize(idGroup + 1, 0);
+	}
+	return data.vecGroupData[idGroup];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Aggregated timing data of a region of the call tree.
+///	</summary>
+struct FunctionTimerRegion {
+
+	///	<summary>
+	///		Inclusive time in seconds.
+	///	</summary>
+	double dInclusiveTime;
+
+	///	<summary>
+	///		Self time in seconds.
+	///	</summary>
+	double dSelfTime;
+
+	///	<summary>
+	///		Number of entries.
+	///	</summary>
+	double dEntries;
+};
+
+///	<summary>
+///		A region of the call tree, identified by the group names along the
+///		path from the root.  Ordering paths lexicographically traverses
+///		the tree depth-first.
+///	</summary>
+typedef std::vector<std::string> FunctionTimerPath;
+
+///	<summary>
+///		Map from region path to aggregated timing data.
+///	</summary>
+typedef std::map<FunctionTimerPath, FunctionTimerRegion>
+	FunctionTimerRegionMap;
+
+///	<summary>
+///		Separator between group names in a serialized region path.
+///	</summary>
+static const char RegionPathSeparator = '\x1f';
+
+///	<summary>
+///		Terminator of a serialized region path.
+///	</summary>
+static const char RegionPathTerminator = '\x1e';
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Add the call tree below the given node to the region map.
+///	</summary>
+static void AccumulateRegions(
+	const FunctionTimerThreadData & data,
+	const std::vector<std::string> & vecNames,
+	int iNode,
+	FunctionTimerPath & path,
+	FunctionTimerRegionMap & mapRegions
+) {
+	const FunctionTimerNode & node = data.vecNodes[iNode];
+
+	if (iNode != 0) {
+		path.push_back(vecNames[node.idGroup]);
+	}
+
+	// Skip regions that have been reset or never completed
+	if ((iNode != 0) && (node.nEntries != 0)) {
+		FunctionTimerRegionMap::iterator iter = mapRegions.find(path);
+		if (iter == mapRegions.end()) {
+			FunctionTimerRegion rd;
+			rd.dInclusiveTime = 0.0;
+			rd.dSelfTime = 0.0;
+			rd.dEntries = 0.0;
+
+			iter = mapRegions.insert(
+				FunctionTimerRegionMap::value_type(path, rd)).first;
+		}
+
+		unsigned long long iSelfTime = 0;
+		if (node.iTotalTime > node.iChildTime) {
+			iSelfTime = node.iTotalTime - node.iChildTime;
+		}
+
+		iter->second.dInclusiveTime += 1.0e-9 * node.iTotalTime;
+		iter->second.dSelfTime += 1.0e-9 * iSelfTime;
+		iter->second.dEntries += static_cast<double>(node.nEntries);
+	}
+
+	for (int i = 0; i < node.vecChildren.size(); i++) {
+		AccumulateRegions(
+			data, vecNames, node.vecChildren[i], path, mapRegions);
+	}
+
+	if (iNode != 0) {
+		path.pop_back();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Serialize a set of region paths.
+///	</summary>
+static void SerializeRegionPaths(
+	const std::set<FunctionTimerPath> & setPaths,
+	std::string & strBuffer
+) {
+	strBuffer.clear();
+
+	std::set<FunctionTimerPath>::const_iterator iter = setPaths.begin();
+	for (; iter != setPaths.end(); iter++) {
+		for (int i = 0; i < iter->size(); i++) {
+			if (i != 0) {
+				strBuffer += RegionPathSeparator;
+			}
+			strBuffer += (*iter)[i];
+		}
+		strBuffer += RegionPathTerminator;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Add serialized region paths to a set of region paths.
+///	</summary>
+static void DeserializeRegionPaths(
+	const char * szBuffer,
+	int nLength,
+	std::set<FunctionTimerPath> & setPaths
+) {
+	FunctionTimerPath path;
+	std::string strName;
+
+	for (int i = 0; i < nLength; i++) {
+		if (szBuffer[i] == RegionPathSeparator) {
+			path.push_back(strName);
+			strName.clear();
+
+		} else if (szBuffer[i] == RegionPathTerminator) {
+			path.push_back(strName);
+			setPaths.insert(path);
+			path.clear();
+			strName.clear();
+
+		} else {
+			strName += szBuffer[i];
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Write a string to a JSON file with escaping.
+///	</summary>
+static void WriteJSONString(
+	FILE * fp,
+	const std::string & str
+) {
+	fputc('\"', fp);
+	for (int i = 0; i < str.length(); i++) {
+		if ((str[i] == '\"') || (str[i] == '\\')) {
+			fputc('\\', fp);
+		}
+		fputc(str[i], fp);
+	}
+	fputc('\"', fp);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+FunctionTimer::FunctionTimer(const char *szGroup) :
+	m_idGroup(InvalidGroupId),
+	m_iNode(-1),
+	m_fStopped(false)
+{
+	// Assign group
+	if ((szGroup != NULL) && (szGroup[0] != '\0')) {
+		m_idGroup = RegisterGroup(szGroup);
+	}
+
+	Start();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+FunctionTimer::FunctionTimer(GroupId idGroup) :
+	m_idGroup(idGroup),
+	m_iNode(-1),
+	m_fStopped(false)
+{
+	Start();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FunctionTimer::Start() {
+
+	// Enter the call tree
+	if (m_idGroup != InvalidGroupId) {
+		FunctionTimerThreadData & data = GetThreadTimerData();
+
+		GetThreadGroupData(m_idGroup);
+		data.vecActiveCount[m_idGroup]++;
+
+		const int iParent = data.iCurrentNode;
+		const std::vector<int> & vecChildren =
+			data.vecNodes[iParent].vecChildren;
+
+		m_iNode = (-1);
+		for (int i = 0; i < vecChildren.size(); i++) {
+			if (data.vecNodes[vecChildren[i]].idGroup == m_idGroup) {
+				m_iNode = vecChildren[i];
+				break;
+			}
+		}
+
+		if (m_iNode == (-1)) {
+			m_iNode = static_cast<int>(data.vecNodes.size());
+
+			FunctionTimerNode node;
+			node.idGroup = m_idGroup;
+			node.iParent = iParent;
+			node.iTotalTime = 0;
+			node.iChildTime = 0;
+			node.nEntries = 0;
+
+			data.vecNodes.push_back(node);
+			data.vecNodes[iParent].vecChildren.push_back(m_iNode);
+		}
+
+		data.iCurrentNode = m_iNode;
 	}
 
 	// Assign start time
-	gettimeofday(&m_tvStartTime, NULL);
+	m_tpStartTime = Clock::now();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void FunctionTimer::Reset() {
-	gettimeofday(&m_tvStartTime, NULL);
+	m_tpStartTime = Clock::now();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 unsigned long FunctionTimer::Time(bool fDone) {
-	timeval tv;
-	gettimeofday(&tv, NULL);
 
-	unsigned long iTime =
-	    MICROSECONDS_PER_SECOND * (tv.tv_sec - m_tvStartTime.tv_sec)
-	    + (tv.tv_usec - m_tvStartTime.tv_usec);
+	unsigned long long iTime =
+		std::chrono::duration_cast<std::chrono::nanoseconds>(
+			Clock::now() - m_tpStartTime).count();
 
-	// If no name associated with this timer, ignore fDone.
-	if (m_strGroup == "") {
-		return iTime;
+	// If no group is associated with this timer, ignore fDone.
+	if (m_idGroup == InvalidGroupId) {
+		return static_cast<unsigned long>(
+			iTime / NANOSECONDS_PER_MICROSECOND);
 	}
 
-	// Add the time to the group record
-	if (fDone) {
-		GroupDataMap::iterator iter;
+	// Add the time to the call tree and group record
+	if ((fDone) && (!m_fStopped)) {
+		m_fStopped = true;
 
-		iter = m_mapGroupData.find(m_strGroup);
+		FunctionTimerThreadData & data = GetThreadTimerData();
 
-		// Add to existing group record
-		if (iter != m_mapGroupData.end()) {
-			iter->second.iTotalTime += iTime;
-			iter->second.nEntries++;
+		FunctionTimerNode & node = data.vecNodes[m_iNode];
+		node.iTotalTime += iTime;
+		node.nEntries++;
 
-		// Create new group record
-		} else {
-			GroupDataPair gdp;
-			gdp.first = m_strGroup;
-			gdp.second.iTotalTime = iTime;
-			gdp.second.nEntries = 1;
+		data.vecNodes[node.iParent].iChildTime += iTime;
+		data.iCurrentNode = node.iParent;
 
-			m_mapGroupData.insert(gdp);
+		// Only the outermost timer of a recursive group adds time
+		TimerGroupData & tgd = data.vecGroupData[m_idGroup];
+		tgd.nEntries++;
+
+		data.vecActiveCount[m_idGroup]--;
+		if (data.vecActiveCount[m_idGroup] == 0) {
+			tgd.iTotalTime += iTime;
 		}
 	}
 
-	return iTime;
+	return static_cast<unsigned long>(iTime / NANOSECONDS_PER_MICROSECOND);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -93,78 +488,409 @@ unsigned long FunctionTimer::StopTime() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-const FunctionTimer::TimerGroupData & FunctionTimer::GetGroupTimeRecord(
-	const char *szName
-) {
-	GroupDataMap::iterator iter;
+FunctionTimer::GroupId FunctionTimer::RegisterGroup(const char *szName) {
+
+	FunctionTimerRegistry & registry = GetTimerRegistry();
 
-	iter = m_mapGroupData.find(szName);
+	std::lock_guard<std::mutex> lock(registry.mutex);
 
-	// Retrieve existing group record
-	if (iter != m_mapGroupData.end()) {
+	std::map<std::string, GroupId>::const_iterator iter =
+		registry.mapGroups.find(szName);
+
+	if (iter != registry.mapGroups.end()) {
 		return iter->second;
+	}
+
+	GroupId idGroup = static_cast<GroupId>(registry.vecNames.size());
+
+	registry.vecNames.push_back(szName);
+	registry.mapGroups.insert(
+		std::pair<std::string, GroupId>(szName, idGroup));
+
+	return idGroup;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+FunctionTimer::GroupId FunctionTimer::FindGroup(const char *szName) {
+
+	FunctionTimerRegistry & registry = GetTimerRegistry();
+
+	std::lock_guard<std::mutex> lock(registry.mutex);
+
+	std::map<std::string, GroupId>::const_iterator iter =
+		registry.mapGroups.find(szName);
+
+	if (iter != registry.mapGroups.end()) {
+		return iter->second;
+	}
+
+	return InvalidGroupId;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FunctionTimer::GetGroupName(GroupId idGroup) {
+
+	FunctionTimerRegistry & registry = GetTimerRegistry();
+
+	std::lock_guard<std::mutex> lock(registry.mutex);
+
+	if ((idGroup < 0) || (idGroup >= registry.vecNames.size())) {
+		_EXCEPTION1("Invalid timer group (%i)", idGroup);
+	}
+
+	return registry.vecNames[idGroup];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+FunctionTimer::GroupId FunctionTimer::GetCurrentGroup() {
+
+	const FunctionTimerThreadData & data = GetThreadTimerData();
+
+	return data.vecNodes[data.iCurrentNode].idGroup;
+}
+
+const FunctionTimer::TimerGroupData & FunctionTimer::GetGroupTimeRecord(
+	const char *szName
+) {
+	GroupId idGroup = FindGroup(szName);
 
 	// Group record does not exist
-	} else {
+	if (idGroup == InvalidGroupId) {
 		_EXCEPTION1("Group time record %s does not exist.", szName);
 	}
+
+	return GetThreadGroupData(idGroup);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 unsigned long FunctionTimer::GetAverageGroupTime(const char *szName) {
 
-	GroupDataMap::iterator iter;
+	GroupId idGroup = FindGroup(szName);
+
+	// Group record does not exist
+	if (idGroup == InvalidGroupId) {
+		return 0;
+	}
+
+	const TimerGroupData & tgd = GetThreadGroupData(idGroup);
+
+	if (tgd.nEntries == 0) {
+		return 0;
+	}
+
+	return static_cast<unsigned long>(
+		tgd.iTotalTime / (NANOSECONDS_PER_MICROSECOND * tgd.nEntries));
+}
 
-	iter = m_mapGroupData.find(szName);
+///////////////////////////////////////////////////////////////////////////////
 
-	// Retrieve existing group record
-	if (iter != m_mapGroupData.end()) {
-		const TimerGroupData & tgd = iter->second;
+unsigned long FunctionTimer::GetTotalGroupTime(const char *szName) {
 
-		return (tgd.iTotalTime / tgd.nEntries);
+	GroupId idGroup = FindGroup(szName);
 
 	// Group record does not exist
-	} else {
+	if (idGroup == InvalidGroupId) {
 		return 0;
 	}
+
+	return GetTotalGroupTime(idGroup);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-unsigned int FunctionTimer::GetNumberOfEntries(const char *szName) {
+unsigned long FunctionTimer::GetTotalGroupTime(GroupId idGroup) {
+
+	if (idGroup == InvalidGroupId) {
+		return 0;
+	}
 
-	GroupDataMap::iterator iter;
+	const TimerGroupData & tgd = GetThreadGroupData(idGroup);
 
-	iter = m_mapGroupData.find(szName);
+	return static_cast<unsigned long>(
+		tgd.iTotalTime / NANOSECONDS_PER_MICROSECOND);
+}
+
+///////////////////////////////////////////////////////////////////////////////
 
-	// Retrieve existing group record
-	if (iter != m_mapGroupData.end()) {
-		const TimerGroupData & tgd = iter->second;
+unsigned int FunctionTimer::GetNumberOfEntries(const char *szName) {
 
-		return (tgd.nEntries);
+	GroupId idGroup = FindGroup(szName);
 
 	// Group record does not exist
-	} else {
+	if (idGroup == InvalidGroupId) {
 		return 0;
 	}
+
+	return GetThreadGroupData(idGroup).nEntries;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void FunctionTimer::ResetGroupTimeRecord(const char *szName) {
-	GroupDataMap::iterator iter;
-
-	iter = m_mapGroupData.find(szName);
 
-	// Retrieve existing group record
-	if (iter != m_mapGroupData.end()) {
-		m_mapGroupData.erase(iter);
+	GroupId idGroup = FindGroup(szName);
 
 	// Group record does not exist
-	} else {
+	if (idGroup == InvalidGroupId) {
 		_EXCEPTION1("Group time record %s does not exist.", szName);
 	}
+
+	TimerGroupData & tgd = GetThreadGroupData(idGroup);
+	tgd.iTotalTime = 0;
+	tgd.nEntries = 0;
+
+	// Reset call tree nodes of this group; the nodes are retained since
+	// active timers may refer to them
+	FunctionTimerThreadData & data = GetThreadTimerData();
+	for (int n = 1; n < data.vecNodes.size(); n++) {
+		FunctionTimerNode & node = data.vecNodes[n];
+		if (node.idGroup == idGroup) {
+			data.vecNodes[node.iParent].iChildTime -=
+				std::min(node.iTotalTime,
+					data.vecNodes[node.iParent].iChildTime);
+
+			node.iTotalTime = 0;
+			node.nEntries = 0;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FunctionTimer::ReportProfile(
+	const std::string & strFilename,
+	ReportFormat eFormat
+) {
+	// Accumulate the call trees of all threads on this rank
+	FunctionTimerRegionMap mapLocalRegions;
+	{
+		FunctionTimerRegistry & registry = GetTimerRegistry();
+
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		FunctionTimerPath path;
+		for (int t = 0; t < registry.vecThreadData.size(); t++) {
+			AccumulateRegions(
+				*(registry.vecThreadData[t]),
+				registry.vecNames,
+				0,
+				path,
+				mapLocalRegions);
+		}
+	}
+
+	// Regions present on any rank
+	std::set<FunctionTimerPath> setRegions;
+
+	FunctionTimerRegionMap::const_iterator iterLocal = mapLocalRegions.begin();
+	for (; iterLocal != mapLocalRegions.end(); iterLocal++) {
+		setRegions.insert(iterLocal->first);
+	}
+
+	int nRank = 0;
+	int nCommSize = 1;
+
+#ifdef TEMPEST_MPIOMP
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
+
+	{
+		std::string strLocal;
+		SerializeRegionPaths(setRegions, strLocal);
+
+		int nLocalLength = static_cast<int>(strLocal.length());
+
+		std::vector<int> vecLengths(nCommSize);
+		MPI_Gather(
+			&nLocalLength, 1, MPI_INT,
+			&(vecLengths[0]), 1, MPI_INT,
+			0, MPI_COMM_WORLD);
+
+		std::vector<int> vecDisplacements(nCommSize, 0);
+		int nTotalLength = 0;
+		if (nRank == 0) {
+			for (int p = 0; p < nCommSize; p++) {
+				vecDisplacements[p] = nTotalLength;
+				nTotalLength += vecLengths[p];
+			}
+		}
+
+		std::vector<char> vecGathered(nTotalLength + 1);
+		MPI_Gatherv(
+			const_cast<char *>(strLocal.c_str()), nLocalLength, MPI_CHAR,
+			&(vecGathered[0]), &(vecLengths[0]), &(vecDisplacements[0]),
+			MPI_CHAR, 0, MPI_COMM_WORLD);
+
+		std::string strGlobal;
+		if (nRank == 0) {
+			DeserializeRegionPaths(
+				&(vecGathered[0]), nTotalLength, setRegions);
+			SerializeRegionPaths(setRegions, strGlobal);
+		}
+
+		int nGlobalLength = static_cast<int>(strGlobal.length());
+		MPI_Bcast(&nGlobalLength, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+		std::vector<char> vecGlobal(nGlobalLength + 1);
+		if (nRank == 0) {
+			strGlobal.copy(&(vecGlobal[0]), nGlobalLength);
+		}
+		MPI_Bcast(&(vecGlobal[0]), nGlobalLength, MPI_CHAR,
+			0, MPI_COMM_WORLD);
+
+		setRegions.clear();
+		DeserializeRegionPaths(&(vecGlobal[0]), nGlobalLength, setRegions);
+	}
+#endif
+
+	// Local timing data of all regions
+	const int nRegions = static_cast<int>(setRegions.size());
+
+	std::vector<double> vecInclusive(nRegions + 1, 0.0);
+	std::vector<double> vecSelf(nRegions + 1, 0.0);
+	std::vector<double> vecEntries(nRegions + 1, 0.0);
+
+	std::set<FunctionTimerPath>::const_iterator iterRegion = setRegions.begin();
+	for (int r = 0; iterRegion != setRegions.end(); iterRegion++, r++) {
+		iterLocal = mapLocalRegions.find(*iterRegion);
+		if (iterLocal != mapLocalRegions.end()) {
+			vecInclusive[r] = iterLocal->second.dInclusiveTime;
+			vecSelf[r] = iterLocal->second.dSelfTime;
+			vecEntries[r] = iterLocal->second.dEntries;
+		}
+	}
+
+	// Reduce over all ranks
+	std::vector<double> vecInclusiveMin(vecInclusive);
+	std::vector<double> vecInclusiveSum(vecInclusive);
+	std::vector<double> vecInclusiveMax(vecInclusive);
+	std::vector<double> vecSelfSum(vecSelf);
+	std::vector<double> vecEntriesMax(vecEntries);
+
+#ifdef TEMPEST_MPIOMP
+	MPI_Reduce(&(vecInclusive[0]), &(vecInclusiveMin[0]),
+		nRegions, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+	MPI_Reduce(&(vecInclusive[0]), &(vecInclusiveSum[0]),
+		nRegions, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+	MPI_Reduce(&(vecInclusive[0]), &(vecInclusiveMax[0]),
+		nRegions, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+	MPI_Reduce(&(vecSelf[0]), &(vecSelfSum[0]),
+		nRegions, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+	MPI_Reduce(&(vecEntries[0]), &(vecEntriesMax[0]),
+		nRegions, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+#endif
+
+	if (nRank != 0) {
+		return;
+	}
+
+	// Mean times and load imbalance
+	std::vector<double> vecInclusiveMean(nRegions + 1, 0.0);
+	std::vector<double> vecSelfMean(nRegions + 1, 0.0);
+	std::vector<double> vecImbalance(nRegions + 1, 1.0);
+
+	for (int r = 0; r < nRegions; r++) {
+		vecInclusiveMean[r] =
+			vecInclusiveSum[r] / static_cast<double>(nCommSize);
+		vecSelfMean[r] =
+			vecSelfSum[r] / static_cast<double>(nCommSize);
+
+		if (vecInclusiveMean[r] > 0.0) {
+			vecImbalance[r] = vecInclusiveMax[r] / vecInclusiveMean[r];
+		}
+	}
+
+	// Announce the report
+	char szTitle[64];
+	snprintf(szTitle, 64, "Profile over %i ranks", nCommSize);
+
+	AnnounceStartBlock(szTitle);
+	Announce("%-40s %10s %11s %11s %11s %7s %11s",
+		"Region", "Calls", "Min(s)", "Mean(s)", "Max(s)",
+		"Imbal", "Self(s)");
+
+	iterRegion = setRegions.begin();
+	for (int r = 0; iterRegion != setRegions.end(); iterRegion++, r++) {
+		std::string strName(2 * (iterRegion->size() - 1), ' ');
+		strName += iterRegion->back();
+
+		Announce("%-40s %10.0f %11.4f %11.4f %11.4f %7.3f %11.4f",
+			strName.c_str(),
+			vecEntriesMax[r],
+			vecInclusiveMin[r],
+			vecInclusiveMean[r],
+			vecInclusiveMax[r],
+			vecImbalance[r],
+			vecSelfMean[r]);
+	}
+	AnnounceEndBlock(NULL);
+
+	// Write the report to file
+	if (strFilename == "") {
+		return;
+	}
+
+	FILE * fp = fopen(strFilename.c_str(), "w");
+	if (fp == NULL) {
+		_EXCEPTION1("Unable to open profile file \"%s\"",
+			strFilename.c_str());
+	}
+
+	if (eFormat == ReportFormat_CSV) {
+		fprintf(fp, "region,depth,calls,min,mean,max,imbalance,self\n");
+
+	} else {
+		fprintf(fp, "{\n  \"ranks\": %i,\n  \"regions\": [", nCommSize);
+	}
+
+	iterRegion = setRegions.begin();
+	for (int r = 0; iterRegion != setRegions.end(); iterRegion++, r++) {
+		std::string strPath;
+		for (int i = 0; i < iterRegion->size(); i++) {
+			if (i != 0) {
+				strPath += "/";
+			}
+			strPath += (*iterRegion)[i];
+		}
+
+		if (eFormat == ReportFormat_CSV) {
+			fprintf(fp, "%s,%i,%.0f,%1.9e,%1.9e,%1.9e,%1.6f,%1.9e\n",
+				strPath.c_str(),
+				static_cast<int>(iterRegion->size()) - 1,
+				vecEntriesMax[r],
+				vecInclusiveMin[r],
+				vecInclusiveMean[r],
+				vecInclusiveMax[r],
+				vecImbalance[r],
+				vecSelfMean[r]);
+
+		} else {
+			fprintf(fp, "%s\n    {\"region\": ", (r == 0)?(""):(","));
+			WriteJSONString(fp, strPath);
+			fprintf(fp, ", \"name\": ");
+			WriteJSONString(fp, iterRegion->back());
+			fprintf(fp, ", \"depth\": %i, \"calls\": %.0f, "
+				"\"min\": %1.9e, \"mean\": %1.9e, \"max\": %1.9e, "
+				"\"imbalance\": %1.6f, \"self\": %1.9e}",
+				static_cast<int>(iterRegion->size()) - 1,
+				vecEntriesMax[r],
+				vecInclusiveMin[r],
+				vecInclusiveMean[r],
+				vecInclusiveMax[r],
+				vecImbalance[r],
+				vecSelfMean[r]);
+		}
+	}
+
+	if (eFormat == ReportFormat_JSON) {
+		fprintf(fp, "\n  ]\n}\n");
+	}
+
+	fclose(fp);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20,15 +20,19 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <string>
-#include <map>
-#include <sys/time.h>
+#include <vector>
+#include <chrono>
 
 ///////////////////////////////////////////////////////////////////////////////
 
 ///	<summary>
 ///		FunctionTimer is a class used for timing operations or groups of
-///		operations.  Timing is provided via the Unix gettimeofday class
-///		and is calculated in microseconds.
+///		operations.  Timing is provided via a monotonic clock.  Named
+///		timers are accumulated into per-thread group records and into a
+///		per-thread call tree, so nested timers report both inclusive and
+///		self time.  Group names are interned: hot code paths should
+///		register the group once with RegisterGroup() and construct timers
+///		from the returned identifier.
 ///	</summary>
 class FunctionTimer {
 
@@ -38,22 +42,43 @@ public:
 	///	</summary>
 	static const unsigned long MICROSECONDS_PER_SECOND = 1000000;
 
+	///	<summary>
+	///		Nanoseconds per microsecond.
+	///	</summary>
+	static const unsigned long NANOSECONDS_PER_MICROSECOND = 1000;
+
+	///	<summary>
+	///		Identifier of a timer group.
+	///	</summary>
+	typedef int GroupId;
+
+	///	<summary>
+	///		Identifier of an anonymous timer, which is not recorded.
+	///	</summary>
+	static const GroupId InvalidGroupId = (-1);
+
+	///	<summary>
+	///		Clock used for timing.
+	///	</summary>
+	typedef std::chrono::steady_clock Clock;
+
+	///	<summary>
+	///		Format of the profile report file.
+	///	</summary>
+	enum ReportFormat {
+		ReportFormat_CSV,
+		ReportFormat_JSON
+	};
+
 public:
 	///	<summary>
 	///		A structure for storing group data.
 	///	</summary>
 	struct TimerGroupData {
-		unsigned long iTotalTime;
+		unsigned long long iTotalTime;
 		unsigned int nEntries;
 	};
 
-	///	<summary>
-	///		The map structure for storing group data.
-	///	</summary>
-	typedef std::map<std::string, TimerGroupData> GroupDataMap;
-
-	typedef std::pair<std::string, TimerGroupData> GroupDataPair;
-
 public:
 	///	<summary>
 	///		Constructor.
@@ -63,6 +88,11 @@ public:
 	///	</param>
 	FunctionTimer(const char *szGroup = NULL);
 
+	///	<summary>
+	///		Constructor from an interned group identifier.
+	///	</summary>
+	FunctionTimer(GroupId idGroup);
+
 	///	<summary>
 	///		Destructor.
 	///	</summary>
@@ -70,13 +100,30 @@ public:
 		StopTime();
 	}
 
+private:
+	///	<summary>
+	///		Copy constructor (disabled).
+	///	</summary>
+	FunctionTimer(const FunctionTimer &);
+
+	///	<summary>
+	///		Assignment operator (disabled).
+	///	</summary>
+	FunctionTimer & operator=(const FunctionTimer &);
+
+	///	<summary>
+	///		Start the timer and enter the call tree.
+	///	</summary>
+	void Start();
+
+public:
 	///	<summary>
 	///		Reset the timer.
 	///	</summary>
 	void Reset();
 
 	///	<summary>
-	///		Return the time elapsed since this timer began.
+	///		Return the time elapsed in microseconds since this timer began.
 	///	</summary>
 	///	<param name="fDone">
 	///		If true stores the elapsed time in the group structure.
@@ -84,48 +131,105 @@ public:
 	unsigned long Time(bool fDone = false);
 
 	///	<summary>
-	///		Return the time elapsed since this timer began and store in
-	///		group data.
+	///		Return the time elapsed in microseconds since this timer began
+	///		and store in group data.  Only the first call records the time.
 	///	</summary>
 	unsigned long StopTime();
 
 public:
 	///	<summary>
-	///		Retrieve a group data record.
+	///		Get the identifier of the named group, registering it if it
+	///		does not exist.  This function is thread-safe.
+	///	</summary>
+	static GroupId RegisterGroup(const char *szName);
+
+	///	<summary>
+	///		Get the identifier of the named group, or InvalidGroupId if
+	///		the group has not been registered.
+	///	</summary>
+	static GroupId FindGroup(const char *szName);
+
+	///	<summary>
+	///		Get the name of a registered group.
+	///	</summary>
+	static std::string GetGroupName(GroupId idGroup);
+
+	///	<summary>
+	///		Get the group of the innermost active named timer on the
+	///		calling thread, or InvalidGroupId if no named timer is active.
+	///	</summary>
+	static GroupId GetCurrentGroup();
+
+	///	<summary>
+	///		Retrieve a group data record on the calling thread.  The total
+	///		time of the record is in nanoseconds.
 	///	</summary>
 	static const TimerGroupData & GetGroupTimeRecord(const char *szName);
 
 	///	<summary>
-	///		Retrieve the average time from a group data record.
+	///		Retrieve the average time in microseconds from a group data
+	///		record on the calling thread.
 	///	</summary>
 	static unsigned long GetAverageGroupTime(const char *szName);
 
 	///	<summary>
-	///		Retrieve the number of entries from a group data record.
+	///		Retrieve the total time in microseconds from a group data record
+	///		on the calling thread, or zero if the group record does not
+	///		exist.
+	///	</summary>
+	static unsigned long GetTotalGroupTime(const char *szName);
+
+	///	<summary>
+	///		Retrieve the total time in microseconds from a group data record
+	///		on the calling thread.
+	///	</summary>
+	static unsigned long GetTotalGroupTime(GroupId idGroup);
+
+	///	<summary>
+	///		Retrieve the number of entries from a group data record on the
+	///		calling thread.
 	///	</summary>
 	static unsigned int GetNumberOfEntries(const char *szName);
 
 	///	<summary>
-	///		Reset the group data record.
+	///		Reset the group data record and the call tree entries of the
+	///		group on the calling thread.
 	///	</summary>
 	static void ResetGroupTimeRecord(const char *szName);
 
-private:
 	///	<summary>
-	///		Group data.
+	///		Reduce the call trees of all threads over all MPI ranks and
+	///		announce the minimum, mean and maximum inclusive time of each
+	///		region with its load imbalance (maximum over mean).  If a
+	///		filename is given the report is also written to file on the
+	///		root rank.  This function is collective and must be called when
+	///		no other thread is timing.
 	///	</summary>
-	static GroupDataMap m_mapGroupData;
+	static void ReportProfile(
+		const std::string & strFilename = "",
+		ReportFormat eFormat = ReportFormat_CSV
+	);
 
 private:
 	///	<summary>
 	///		Time at which this timer was constructed.
-	///	</summary
-	timeval m_tvStartTime;
+	///	</summary>
+	Clock::time_point m_tpStartTime;
+
+	///	<summary>
+	///		Group associated with this timer.
+	///	</summary>
+	GroupId m_idGroup;
+
+	///	<summary>
+	///		Call tree node of this timer on the constructing thread.
+	///	</summary>
+	int m_iNode;
 
 	///	<summary>
-	///		Group name associated with this timer.
+	///		Flag indicating this timer has been stopped.
 	///	</summary>
-	std::string m_strGroup;
+	bool m_fStopped;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -305,15 +305,23 @@ int LAPACK::DGBTRF(
 	int iKL,
 	int iKU
 ) {
+	// Banded storage as in DGBSV (one row of dA per matrix column)
+	if (dA.GetColumns() < 2 * iKL + iKU + 1) {
+		_EXCEPTIONT("Matrix A has insufficient columns for DGBTRF");
+	}
+	if (iPIV.GetRows() < dA.GetRows()) {
+		_EXCEPTIONT("Matrix A / IPIV dimension mismatch in DGBTRF");
+	}
+
 	int m = dA.GetRows();
-	int n = dA.GetColumns();
+	int n = dA.GetRows();
 
-	int lda = m;
+	int lda = dA.GetColumns();
 
 	int nInfo;
 
 #ifdef TEMPEST_LAPACK_ACML_INTERFACE
-	dgbtrf(m, n, &iKL, &iKU, &(dA[0][0]), lda, &(iPIV[0]), &nInfo);
+	dgbtrf(m, n, iKL, iKU, &(dA[0][0]), lda, &(iPIV[0]), &nInfo);
 #endif
 #ifdef TEMPEST_LAPACK_ESSL_INTERFACE
 	dgbtrf(m, n, iKL, iKU, &(dA[0][0]), lda, &(iPIV[0]), nInfo);
@@ -365,10 +373,14 @@ int LAPACK::DGBTRS(
 	int iKL,
 	int iKU
 ) {
-	int m = dA.GetRows();
-	int n = dA.GetColumns();
+	// Banded storage as in DGBSV (one row of dA per matrix column)
+	if (dB.GetRows() < dA.GetRows()) {
+		_EXCEPTIONT("Matrix A / B dimension mismatch in DGBTRS");
+	}
 
-	int lda = m;
+	int n = dA.GetRows();
+
+	int lda = dA.GetColumns();
 	int ldb = dB.GetRows();
 	int nRHS = 1;
 
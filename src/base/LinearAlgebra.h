@@ -405,7 +405,8 @@ public:
 	);
 
 	///	<summary>
-	///		Calculate the LU decomposition of a given banded matrix.
+	///		Calculate the LU decomposition of a given banded matrix, stored
+	///		in the same banded form as DGBSV.
 	///	</summary>
 	static int DGBTRF(
 		DataArray2D<double> & dA,
@@ -23,18 +23,24 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void PrintMemoryLine(const char * szString) {
+long GetPeakResidentMemory() {
 	rusage ruse;
 
 	getrusage(RUSAGE_SELF, &ruse);
 
+	return ruse.ru_maxrss;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PrintMemoryLine(const char * szString) {
+	long lPeakResidentMemory = GetPeakResidentMemory();
+
 	if (szString == NULL) {
-		Announce("MEMORY RES %lu", ruse.ru_maxrss);
+		Announce("MEMORY RES %li", lPeakResidentMemory);
 	} else {
-		Announce("%s : RES %lu : DATA %lu : STACK %lu",
-			szString, ruse.ru_maxrss);
+		Announce("%s : RES %li", szString, lPeakResidentMemory);
 	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-
@@ -26,6 +26,14 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
+///	<summary>
+///		Get the peak resident set size of this process (in kilobytes).
+///	</summary>
+long GetPeakResidentMemory();
+
+///	<summary>
+///		Announce the peak resident set size of this process.
+///	</summary>
 void PrintMemoryLine(const char * szString = NULL);
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@
 #include "GridGLL.h"
 #include "Defines.h"
 
+#include "FunctionTimer.h"
 #include "Announce.h" 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -187,6 +188,8 @@ void DCMIPPhysics::Perform(
 	for (int n = 0; n < pGridGLL->GetActivePatchCount(); n++) {
 		GridPatch * pPatch = pGridGLL->GetActivePatch(n);
 
+		FunctionTimer timerPatch;
+
 		const PatchBox & box = pPatch->GetPatchBox();
 
 		// Get latitude
@@ -401,6 +404,8 @@ void DCMIPPhysics::Perform(
 			}
 		}
 		}
+
+		pPatch->AddComputeTime(timerPatch.Time());
 	}
 
 	// Call up the stack to update performance time
@@ -452,6 +457,8 @@ void DCMIPPhysics::Perform(
 	for (int n = 0; n < pGridGLL->GetActivePatchCount(); n++) {
 		GridPatch * pPatch = pGridGLL->GetActivePatch(n);
 
+		FunctionTimer timerPatch;
+
 		const PatchBox & box = pPatch->GetPatchBox();
 
 		// Metric components
@@ -735,6 +742,8 @@ void DCMIPPhysics::Perform(
 			}
 		}
 		}
+
+		pPatch->AddComputeTime(timerPatch.Time());
 	}
 
 	//_EXCEPTION();
@@ -782,6 +791,8 @@ void DCMIPPhysics::Perform(
 	for (int n = 0; n < pGridGLL->GetActivePatchCount(); n++) {
 		GridPatch * pPatch = pGridGLL->GetActivePatch(n);
 
+		FunctionTimer timerPatch;
+
 		const PatchBox & box = pPatch->GetPatchBox();
 
 		// Grid data
@@ -991,6 +1002,8 @@ void DCMIPPhysics::Perform(
 			}
 		}
 		}
+
+		pPatch->AddComputeTime(timerPatch.Time());
 	}
 
 	// Call up the stack to update performance time
@@ -20,6 +20,7 @@
 #include "GridGLL.h"
 #include "Defines.h"
 
+#include "FunctionTimer.h"
 #include "Announce.h" 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -111,6 +112,8 @@ void KesslerPhysics::Perform(
 	for (int n = 0; n < pGridGLL->GetActivePatchCount(); n++) {
 		GridPatch * pPatch = pGridGLL->GetActivePatch(n);
 
+		FunctionTimer timerPatch;
+
 		const PatchBox & box = pPatch->GetPatchBox();
 
 		// Get latitude
@@ -281,6 +284,8 @@ void KesslerPhysics::Perform(
 			}
 		}
 		}
+
+		pPatch->AddComputeTime(timerPatch.Time());
 	}
 
 	// Call up the stack to update performance time
@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    BandedSolverBatchTest.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "BandedSolverBatch.h"
+#include "LinearAlgebra.h"
+#include "FunctionTimer.h"
+#include "CommandLine.h"
+#include "Announce.h"
+#include "Exception.h"
+#include "DataArray1D.h"
+#include "DataArray2D.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <mpi.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Build a random diagonally dominant banded matrix in LAPACK banded
+///		storage, along with a random right-hand side.
+///	</summary>
+void BuildRandomBandedSystem(
+	int nRows,
+	int nOffD,
+	DataArray2D<double> & dAB,
+	DataArray1D<double> & dB
+) {
+	const int nKV = 2 * nOffD;
+
+	dAB.Zero();
+
+	for (int j = 0; j < nRows; j++) {
+		for (int i = j - nOffD; i <= j + nOffD; i++) {
+			if ((i < 0) || (i >= nRows)) {
+				continue;
+			}
+			double dValue =
+				2.0 * static_cast<double>(rand()) / RAND_MAX - 1.0;
+			if (i == j) {
+				dValue += static_cast<double>(nOffD);
+			}
+			dAB[j][nKV + i - j] = dValue;
+		}
+		dB[j] = static_cast<double>(rand()) / RAND_MAX;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char ** argv) {
+
+	// Initialize MPI
+	MPI_Init(&argc, &argv);
+
+try {
+	// Number of levels
+	int nLevels;
+
+	// Number of off-diagonals
+	int nOffD;
+
+	// Number of columns
+	int nColumns;
+
+	// Parse the command line
+	BeginCommandLine()
+		CommandLineInt(nLevels, "levels", 30);
+		CommandLineInt(nOffD, "offd", 9);
+		CommandLineInt(nColumns, "columns", 4096);
+
+		ParseCommandLine(argc, argv);
+	EndCommandLine(argv)
+
+	AnnounceBanner();
+
+	// System size used by VerticalDynamicsFEM
+	const int nRows = 3 * (nLevels + 1);
+	const int nLDAB = 3 * nOffD + 1;
+	const int nBatchWidth = BandedSolverBatch::BatchWidth;
+
+	if (nColumns % nBatchWidth != 0) {
+		_EXCEPTION1("--columns must be a multiple of %i", nBatchWidth);
+	}
+
+	Announce("Rows: %i  Off-diagonals: %i  Columns: %i  Batch width: %i",
+		nRows, nOffD, nColumns, nBatchWidth);
+
+	// Build the systems
+	srand(1);
+
+	std::vector< DataArray2D<double> > vecAB(nColumns);
+	std::vector< DataArray1D<double> > vecB(nColumns);
+
+	for (int c = 0; c < nColumns; c++) {
+		vecAB[c].Allocate(nRows, nLDAB);
+		vecB[c].Allocate(nRows);
+		BuildRandomBandedSystem(nRows, nOffD, vecAB[c], vecB[c]);
+	}
+
+	// Solve each system with DGBSV
+	std::vector< DataArray1D<double> > vecXLAPACK(nColumns);
+
+	DataArray2D<double> dAB(nRows, nLDAB);
+	DataArray1D<int> iPiv(nRows);
+
+	FunctionTimer timerLAPACK;
+	for (int c = 0; c < nColumns; c++) {
+		dAB = vecAB[c];
+		vecXLAPACK[c] = vecB[c];
+
+		int iInfo = LAPACK::DGBSV(dAB, vecXLAPACK[c], iPiv, nOffD, nOffD);
+		if (iInfo != 0) {
+			_EXCEPTION1("DGBSV failed (%i)", iInfo);
+		}
+	}
+	unsigned long lTimeLAPACK = timerLAPACK.Time();
+
+	// Solve systems in batches
+	std::vector< DataArray1D<double> > vecXBatch(nColumns);
+
+	BandedSolverBatch solverBatch;
+	solverBatch.Initialize(nRows, nOffD, nOffD);
+
+	FunctionTimer timerBatch;
+	for (int c = 0; c < nColumns; c += nBatchWidth) {
+		for (int v = 0; v < nBatchWidth; v++) {
+			solverBatch.SetLane(v, &(vecAB[c+v][0][0]), &(vecB[c+v][0]));
+		}
+
+		int iInfo = solverBatch.FactorAndSolve();
+		if (iInfo != 0) {
+			_EXCEPTION1("BandedSolverBatch failed (%i)", iInfo);
+		}
+
+		for (int v = 0; v < nBatchWidth; v++) {
+			vecXBatch[c+v].Allocate(nRows);
+			solverBatch.GetLaneSolution(v, &(vecXBatch[c+v][0]));
+		}
+	}
+	unsigned long lTimeBatch = timerBatch.Time();
+
+	// Compare solutions
+	double dMaxDiff = 0.0;
+	for (int c = 0; c < nColumns; c++) {
+		for (int k = 0; k < nRows; k++) {
+			double dDiff = fabs(vecXBatch[c][k] - vecXLAPACK[c][k]);
+			if (dDiff > dMaxDiff) {
+				dMaxDiff = dDiff;
+			}
+		}
+	}
+
+	Announce("DGBSV:             %8.3f us / column",
+		static_cast<double>(lTimeLAPACK) / static_cast<double>(nColumns));
+	Announce("BandedSolverBatch: %8.3f us / column",
+		static_cast<double>(lTimeBatch) / static_cast<double>(nColumns));
+	Announce("Speedup:           %8.3f",
+		static_cast<double>(lTimeLAPACK) / static_cast<double>(lTimeBatch));
+	Announce("Max difference:    %1.5e", dMaxDiff);
+
+	if (dMaxDiff > 1.0e-10) {
+		_EXCEPTIONT("Batched solution differs from DGBSV");
+	}
+
+	AnnounceBanner();
+
+} catch(Exception & e) {
+	Announce(e.ToString().c_str());
+}
+
+	// Deinitialize MPI
+	MPI_Finalize();
+
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,823 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    KernelBenchmark.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "Tempest.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <mpi.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		An isothermal atmosphere at rest in hydrostatic balance with a
+///		small potential temperature perturbation, used to populate the
+///		state for benchmarking.
+///	</summary>
+class KernelBenchmarkTest : public TestCase {
+
+protected:
+	///	<summary>
+	///		Model cap.
+	///	</summary>
+	double m_dZtop;
+
+	///	<summary>
+	///		Background temperature.
+	///	</summary>
+	double m_dT0;
+
+public:
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	KernelBenchmarkTest(
+		double dZtop,
+		double dT0
+	) :
+		m_dZtop(dZtop),
+		m_dT0(dT0)
+	{ }
+
+public:
+	///	<summary>
+	///		Number of tracers used in this test.
+	///	</summary>
+	virtual int GetTracerCount() const {
+		return 0;
+	}
+
+	///	<summary>
+	///		Get the altitude of the model cap.
+	///	</summary>
+	virtual double GetZtop() const {
+		return m_dZtop;
+	}
+
+	///	<summary>
+	///		Flag indicating that a reference state is available.
+	///	</summary>
+	virtual bool HasReferenceState() const {
+		return true;
+	}
+
+	///	<summary>
+	///		Evaluate the reference state at the given point.
+	///	</summary>
+	virtual void EvaluateReferenceState(
+		const PhysicalConstants & phys,
+		double dZ,
+		double dLon,
+		double dLat,
+		double * dState
+	) const {
+
+		// Scale height
+		double dH = phys.GetR() * m_dT0 / phys.GetG();
+
+		// Isothermal pressure and density
+		double dPressure = phys.GetP0() * exp(- dZ / dH);
+
+		double dRho = dPressure / (phys.GetR() * m_dT0);
+
+		// Store the state
+		dState[0] = 0.0;
+		dState[1] = 0.0;
+		dState[2] = phys.RhoThetaFromPressure(dPressure) / dRho;
+		dState[3] = 0.0;
+		dState[4] = dRho;
+	}
+
+	///	<summary>
+	///		Evaluate the state vector at the given point.
+	///	</summary>
+	virtual void EvaluatePointwiseState(
+		const PhysicalConstants & phys,
+		const Time & time,
+		double dZ,
+		double dLon,
+		double dLat,
+		double * dState,
+		double * dTracer
+	) const {
+
+		// Calculate the reference state
+		EvaluateReferenceState(phys, dZ, dLon, dLat, dState);
+
+		// Add in a smooth potential temperature perturbation
+		dState[2] += cos(dLon) * cos(dLat) * sin(M_PI * dZ / m_dZtop);
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Timing of one kernel on one configuration.
+///	</summary>
+struct KernelTiming {
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	KernelTiming(
+		const char * szName,
+		double dSeconds,
+		double dNodes,
+		double dBytes
+	) :
+		strName(szName),
+		dSeconds(dSeconds),
+		dNodes(dNodes),
+		dBytes(dBytes)
+	{ }
+
+	///	<summary>
+	///		Name of the kernel.
+	///	</summary>
+	std::string strName;
+
+	///	<summary>
+	///		Wall time on this rank over all repetitions (in seconds).
+	///	</summary>
+	double dSeconds;
+
+	///	<summary>
+	///		Number of nodes processed on this rank over all repetitions.
+	///	</summary>
+	double dNodes;
+
+	///	<summary>
+	///		Estimated number of bytes of state data read and written on
+	///		this rank over all repetitions.
+	///	</summary>
+	double dBytes;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Parse a comma-separated list of positive integers.
+///	</summary>
+void ParseIntegerList(
+	const std::string & strList,
+	const char * szOption,
+	std::vector<int> & vecValues
+) {
+	vecValues.clear();
+
+	size_t sBegin = 0;
+	while (sBegin <= strList.length()) {
+		size_t sEnd = strList.find(',', sBegin);
+		if (sEnd == std::string::npos) {
+			sEnd = strList.length();
+		}
+
+		int nValue = atoi(strList.substr(sBegin, sEnd - sBegin).c_str());
+		if (nValue < 1) {
+			_EXCEPTION2("Invalid value in --%s \"%s\"",
+				szOption, strList.c_str());
+		}
+		vecValues.push_back(nValue);
+
+		sBegin = sEnd + 1;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get the wall time in seconds since the given time point.
+///	</summary>
+double SecondsSince(
+	const FunctionTimer::Clock::time_point & tpStart
+) {
+	return std::chrono::duration<double>(
+		FunctionTimer::Clock::now() - tpStart).count();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Apply a column operator to every column of every variable of the
+///		given state on all active patches.  The operator maps columns of
+///		length nInLevels to columns of length nOutLevels.  Each output
+///		level of a column counts as one node.
+///	</summary>
+template <typename ColumnFunctor>
+KernelTiming BenchmarkColumnKernel(
+	const char * szName,
+	Grid * pGrid,
+	DataLocation locIn,
+	DataLocation locOut,
+	int nInLevels,
+	int nOutLevels,
+	int nRepetitions,
+	const ColumnFunctor & functor
+) {
+	double dNodes = 0.0;
+	double dBytes = 0.0;
+
+	FunctionTimer::Clock::time_point tpStart = FunctionTimer::Clock::now();
+
+	for (int r = 0; r < nRepetitions; r++) {
+	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
+		GridPatch * pPatch = pGrid->GetActivePatch(n);
+
+		const PatchBox & box = pPatch->GetPatchBox();
+
+		const DataArray4D<double> & dataIn =
+			pPatch->GetDataState(0, locIn);
+
+		DataArray4D<double> & dataOut =
+			pPatch->GetDataState(1, locOut);
+
+		const int nComponents = dataIn.GetSize(0);
+
+		for (int c = 0; c < nComponents; c++) {
+		for (int i = box.GetAInteriorBegin(); i < box.GetAInteriorEnd(); i++) {
+		for (int j = box.GetBInteriorBegin(); j < box.GetBInteriorEnd(); j++) {
+			functor(&(dataIn[c][i][j][0]), &(dataOut[c][i][j][0]));
+		}
+		}
+		}
+
+		dNodes += static_cast<double>(
+			box.GetAInteriorWidth() * box.GetBInteriorWidth())
+			* static_cast<double>(nOutLevels);
+
+		dBytes += static_cast<double>(
+			nComponents * box.GetAInteriorWidth() * box.GetBInteriorWidth())
+			* static_cast<double>(nInLevels + nOutLevels)
+			* static_cast<double>(sizeof(double));
+	}
+	}
+
+	double dSeconds = SecondsSince(tpStart);
+
+	return KernelTiming(szName, dSeconds, dNodes, dBytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		LinearColumnOperator::Apply.
+///	</summary>
+struct ColumnApplyFunctor {
+	ColumnApplyFunctor(const LinearColumnOperator & op) : m_op(op) { }
+
+	void operator()(const double * dIn, double * dOut) const {
+		m_op.Apply(dIn, dOut);
+	}
+
+	const LinearColumnOperator & m_op;
+};
+
+///	<summary>
+///		GridGLL::InterpolateNodeToREdge.
+///	</summary>
+struct InterpNodeToREdgeFunctor {
+	InterpNodeToREdgeFunctor(const GridGLL & grid) : m_grid(grid) { }
+
+	void operator()(const double * dIn, double * dOut) const {
+		m_grid.InterpolateNodeToREdge(dIn, dOut);
+	}
+
+	const GridGLL & m_grid;
+};
+
+///	<summary>
+///		GridGLL::InterpolateREdgeToNode.
+///	</summary>
+struct InterpREdgeToNodeFunctor {
+	InterpREdgeToNodeFunctor(const GridGLL & grid) : m_grid(grid) { }
+
+	void operator()(const double * dIn, double * dOut) const {
+		m_grid.InterpolateREdgeToNode(dIn, dOut);
+	}
+
+	const GridGLL & m_grid;
+};
+
+///	<summary>
+///		GridGLL::DifferentiateNodeToREdge.
+///	</summary>
+struct DiffNodeToREdgeFunctor {
+	DiffNodeToREdgeFunctor(const GridGLL & grid) : m_grid(grid) { }
+
+	void operator()(const double * dIn, double * dOut) const {
+		m_grid.DifferentiateNodeToREdge(dIn, dOut);
+	}
+
+	const GridGLL & m_grid;
+};
+
+///	<summary>
+///		GridGLL::DifferentiateREdgeToNode.
+///	</summary>
+struct DiffREdgeToNodeFunctor {
+	DiffREdgeToNodeFunctor(const GridGLL & grid) : m_grid(grid) { }
+
+	void operator()(const double * dIn, double * dOut) const {
+		m_grid.DifferentiateREdgeToNode(dIn, dOut);
+	}
+
+	const GridGLL & m_grid;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Run all kernels on one configuration and append the timings.
+///	</summary>
+void BenchmarkConfiguration(
+	int nHorizontalOrder,
+	int nLevels,
+	int nResolution,
+	int nPatchesPerProcessor,
+	int nRepetitions,
+	std::vector<KernelTiming> & vecTimings
+) {
+	int nCommSize;
+	MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
+
+	// Time step size used by the dynamics kernels
+	const double dDeltaT = 1.0;
+
+	Time time;
+
+	// Setup the Model
+	Model model(EquationSet::PrimitiveNonhydrostaticEquations);
+
+	model.SetDeltaT(Time(0, 0, 0, 1, 0));
+
+	model.SetTimestepScheme(new TimestepSchemeStrang(model));
+
+	HorizontalDynamicsFEM * pHorizontalDynamics =
+		new HorizontalDynamicsFEM(
+			model, nHorizontalOrder, 4, 1.0e15, 1.0e15, 1.0e15, 0.0);
+
+	model.SetHorizontalDynamics(pHorizontalDynamics);
+
+	VerticalDynamicsFEM * pVerticalDynamics =
+		new VerticalDynamicsFEM(
+			model, nHorizontalOrder, 1, 0, false, true, false);
+
+	model.SetVerticalDynamics(pVerticalDynamics);
+
+	// Setup the Grid
+	const int nPatchCount = nCommSize * nPatchesPerProcessor;
+
+	GridCSGLL * pGrid = new GridCSGLL(model);
+
+	pGrid->DefineParameters();
+
+	pGrid->SetParameters(
+		nLevels,
+		nPatchCount + 6 * nResolution,
+		nResolution,
+		4,
+		nHorizontalOrder,
+		1,
+		Grid::VerticalDiscretization_FiniteElement,
+		Grid::VerticalStaggering_Lorenz);
+
+	pGrid->InitializeDataLocal();
+
+	model.SetGrid(pGrid, nPatchCount);
+
+	model.SetTestCase(new KernelBenchmarkTest(10000.0, 300.0));
+
+	// With the end time equal to the start time the Model evaluates the
+	// geometric terms and initializes all components without stepping
+	model.SetEndTime(model.GetStartTime());
+	model.Go();
+
+	pGrid->CopyData(0, 1, DataType_State);
+
+	// Number of interior nodes on this rank
+	double dLocalNodes = 0.0;
+	for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
+		const PatchBox & box = pGrid->GetActivePatch(n)->GetPatchBox();
+
+		dLocalNodes +=
+			static_cast<double>(
+				box.GetAInteriorWidth() * box.GetBInteriorWidth())
+			* static_cast<double>(nLevels);
+	}
+
+	const int nComponents = model.GetEquationSet().GetComponents();
+
+	const double dNodeBytes =
+		static_cast<double>(nComponents)
+		* static_cast<double>(2 * nLevels + 1)
+		/ static_cast<double>(nLevels)
+		* static_cast<double>(sizeof(double));
+
+	const size_t sTimingsBegin = vecTimings.size();
+
+	// LinearColumnOperator::Apply (derivative from levels to levels)
+	MPI_Barrier(MPI_COMM_WORLD);
+	vecTimings.push_back(
+		BenchmarkColumnKernel(
+			"LinearColumnOperator::Apply",
+			pGrid, DataLocation_Node, DataLocation_Node,
+			nLevels, nLevels, nRepetitions,
+			ColumnApplyFunctor(pGrid->GetOpDiffNodeToNode())));
+
+	// GridGLL interpolation and differentiation
+	MPI_Barrier(MPI_COMM_WORLD);
+	vecTimings.push_back(
+		BenchmarkColumnKernel(
+			"GridGLL::InterpNodeToREdge",
+			pGrid, DataLocation_Node, DataLocation_REdge,
+			nLevels, nLevels + 1, nRepetitions,
+			InterpNodeToREdgeFunctor(*pGrid)));
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	vecTimings.push_back(
+		BenchmarkColumnKernel(
+			"GridGLL::InterpREdgeToNode",
+			pGrid, DataLocation_REdge, DataLocation_Node,
+			nLevels + 1, nLevels, nRepetitions,
+			InterpREdgeToNodeFunctor(*pGrid)));
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	vecTimings.push_back(
+		BenchmarkColumnKernel(
+			"GridGLL::DiffNodeToREdge",
+			pGrid, DataLocation_Node, DataLocation_REdge,
+			nLevels, nLevels + 1, nRepetitions,
+			DiffNodeToREdgeFunctor(*pGrid)));
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	vecTimings.push_back(
+		BenchmarkColumnKernel(
+			"GridGLL::DiffREdgeToNode",
+			pGrid, DataLocation_REdge, DataLocation_Node,
+			nLevels + 1, nLevels, nRepetitions,
+			DiffREdgeToNodeFunctor(*pGrid)));
+
+	// ExchangeBuffer::Pack and ExchangeBuffer::Unpack, timed by the
+	// exchange statistics of a full exchange of the state.  Each set of
+	// values of all components packed or unpacked counts as one node.
+	{
+		static const FunctionTimer::GroupId s_idTimer =
+			FunctionTimer::RegisterGroup("KernelBenchmarkExchange");
+
+		pGrid->GetExchangeStatistics().Reset();
+
+		MPI_Barrier(MPI_COMM_WORLD);
+		{
+			FunctionTimer timer(s_idTimer);
+			for (int r = 0; r < nRepetitions; r++) {
+				pGrid->Exchange(DataType_State, 0);
+			}
+		}
+
+		const ExchangeCounters & counters =
+			pGrid->GetExchangeStatistics().GetCounters(
+				s_idTimer, DataType_State);
+
+		// Payload of the last exchange, which includes messages that do
+		// not pass through MPI.  Neighboring patches exchange equal
+		// payloads, so the same volume is unpacked, except for data
+		// copied directly into the halo of patches on the same rank,
+		// which is timed as packing.
+		std::vector<ExchangeBuffer> & vecExchangeBuffers =
+			pGrid->GetExchangeBufferRegistry().GetExchangeBuffers();
+
+		double dBytesPacked = 0.0;
+		double dBytesCopied = 0.0;
+		for (int b = 0; b < vecExchangeBuffers.size(); b++) {
+			double dBytes = static_cast<double>(
+				vecExchangeBuffers[b].GetPackedMessageSize()
+				- sizeof(ExchangeBuffer::MessageHeader));
+
+			if (vecExchangeBuffers[b].GetLocalTarget() != NULL) {
+				dBytesCopied += dBytes;
+			} else {
+				dBytesPacked += dBytes;
+			}
+		}
+		dBytesPacked *= static_cast<double>(nRepetitions);
+		dBytesCopied *= static_cast<double>(nRepetitions);
+
+		const double dValuesPacked =
+			dBytesPacked / static_cast<double>(sizeof(double));
+		const double dValuesCopied =
+			dBytesCopied / static_cast<double>(sizeof(double));
+
+		vecTimings.push_back(
+			KernelTiming(
+				"ExchangeBuffer::Pack",
+				counters.dPackTime,
+				(dValuesPacked + dValuesCopied)
+					/ static_cast<double>(nComponents),
+				2.0 * (dBytesPacked + dBytesCopied)));
+
+		vecTimings.push_back(
+			KernelTiming(
+				"ExchangeBuffer::Unpack",
+				counters.dUnpackTime,
+				dValuesPacked / static_cast<double>(nComponents),
+				2.0 * dBytesPacked));
+
+		pGrid->GetExchangeStatistics().Reset();
+	}
+
+	// GridCSGLL::ApplyDSS
+	{
+		MPI_Barrier(MPI_COMM_WORLD);
+		FunctionTimer::Clock::time_point tpStart =
+			FunctionTimer::Clock::now();
+
+		for (int r = 0; r < nRepetitions; r++) {
+			pGrid->ApplyDSS(1, DataType_State);
+		}
+
+		double dNodes = dLocalNodes * static_cast<double>(nRepetitions);
+
+		vecTimings.push_back(
+			KernelTiming(
+				"GridCSGLL::ApplyDSS",
+				SecondsSince(tpStart),
+				dNodes,
+				2.0 * dNodes * dNodeBytes));
+
+		pGrid->GetExchangeStatistics().Reset();
+	}
+
+	// GridPatch::LinearCombineData with two source terms
+	{
+		DataArray1D<double> dCoeff(3);
+		dCoeff[0] = 0.5;
+		dCoeff[1] = 0.25;
+		dCoeff[2] = 0.25;
+
+		pGrid->CopyData(0, 2, DataType_State);
+
+		MPI_Barrier(MPI_COMM_WORLD);
+		FunctionTimer::Clock::time_point tpStart =
+			FunctionTimer::Clock::now();
+
+		for (int r = 0; r < nRepetitions; r++) {
+			pGrid->LinearCombineData(dCoeff, 1, DataType_State);
+		}
+
+		double dNodes = dLocalNodes * static_cast<double>(nRepetitions);
+
+		vecTimings.push_back(
+			KernelTiming(
+				"GridPatch::LinearCombineData",
+				SecondsSince(tpStart),
+				dNodes,
+				4.0 * dNodes * dNodeBytes));
+	}
+
+	// VerticalDynamicsFEM column solve on every column
+	{
+		pGrid->CopyData(0, 1, DataType_State);
+
+		MPI_Barrier(MPI_COMM_WORLD);
+		FunctionTimer::Clock::time_point tpStart =
+			FunctionTimer::Clock::now();
+
+		double dColumns = 0.0;
+		for (int r = 0; r < nRepetitions; r++) {
+		for (int n = 0; n < pGrid->GetActivePatchCount(); n++) {
+		GridPatch * pPatch = pGrid->GetActivePatch(n);
+
+		const PatchBox & box = pPatch->GetPatchBox();
+
+		for (int i = box.GetAInteriorBegin(); i < box.GetAInteriorEnd(); i++) {
+		for (int j = box.GetBInteriorBegin(); j < box.GetBInteriorEnd(); j++) {
+			pVerticalDynamics->SolveImplicitColumn(
+				pPatch, i, j, dDeltaT,
+				pPatch->GetReferenceState(DataLocation_Node),
+				pPatch->GetDataState(0, DataLocation_Node),
+				pPatch->GetDataState(1, DataLocation_Node),
+				pPatch->GetReferenceState(DataLocation_REdge),
+				pPatch->GetDataState(0, DataLocation_REdge),
+				pPatch->GetDataState(1, DataLocation_REdge),
+				pPatch->GetReferenceTracers(),
+				pPatch->GetDataTracers(0),
+				pPatch->GetDataTracers(1));
+
+			dColumns += 1.0;
+		}
+		}
+		}
+		}
+
+		double dNodes = dColumns * static_cast<double>(nLevels);
+
+		vecTimings.push_back(
+			KernelTiming(
+				"VerticalDynamicsFEM::SolveColumn",
+				SecondsSince(tpStart),
+				dNodes,
+				3.0 * dNodes * dNodeBytes));
+	}
+
+	// HorizontalDynamicsFEM element right-hand side on all elements
+	{
+		pGrid->CopyData(0, 1, DataType_State);
+
+		MPI_Barrier(MPI_COMM_WORLD);
+		FunctionTimer::Clock::time_point tpStart =
+			FunctionTimer::Clock::now();
+
+		for (int r = 0; r < nRepetitions; r++) {
+			pHorizontalDynamics->StepNonhydrostaticPrimitive(
+				0, 1, time, dDeltaT);
+		}
+
+		double dNodes = dLocalNodes * static_cast<double>(nRepetitions);
+
+		vecTimings.push_back(
+			KernelTiming(
+				"HorizontalDynamicsFEM::ElementRHS",
+				SecondsSince(tpStart),
+				dNodes,
+				2.0 * dNodes * dNodeBytes));
+	}
+
+	// Reduce over ranks: the slowest rank determines the time
+	for (size_t t = sTimingsBegin; t < vecTimings.size(); t++) {
+		double dLocal[3];
+		dLocal[0] = vecTimings[t].dSeconds;
+		dLocal[1] = vecTimings[t].dNodes;
+		dLocal[2] = vecTimings[t].dBytes;
+
+		double dGlobal[3];
+		MPI_Allreduce(
+			&(dLocal[0]), &(dGlobal[0]), 1,
+			MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+		MPI_Allreduce(
+			&(dLocal[1]), &(dGlobal[1]), 2,
+			MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+		vecTimings[t].dSeconds = dGlobal[0];
+		vecTimings[t].dNodes = dGlobal[1];
+		vecTimings[t].dBytes = dGlobal[2];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv) {
+
+	// Initialize Tempest
+	TempestInitialize(&argc, &argv);
+
+try {
+	// Horizontal orders
+	std::string strOrders;
+
+	// Vertical levels
+	std::string strLevels;
+
+	// Cubed-sphere resolutions
+	std::string strResolutions;
+
+	// Patches per processor
+	int nPatchesPerProcessor;
+
+	// Repetitions of each kernel
+	int nRepetitions;
+
+	// Output file
+	std::string strOutputFile;
+
+	// Parse the command line
+	BeginCommandLine()
+		CommandLineString(strOrders, "orders", "3,4");
+		CommandLineString(strLevels, "levels", "10,30");
+		CommandLineString(strResolutions, "resolutions", "4,8");
+		CommandLineInt(nPatchesPerProcessor, "patchesperproc", 1);
+		CommandLineInt(nRepetitions, "reps", 10);
+		CommandLineString(strOutputFile, "output_file", "");
+
+		ParseCommandLine(argc, argv);
+	EndCommandLine(argv)
+
+	AnnounceBanner();
+
+	std::vector<int> vecOrders;
+	std::vector<int> vecLevels;
+	std::vector<int> vecResolutions;
+
+	ParseIntegerList(strOrders, "orders", vecOrders);
+	ParseIntegerList(strLevels, "levels", vecLevels);
+	ParseIntegerList(strResolutions, "resolutions", vecResolutions);
+
+	if (nRepetitions < 1) {
+		_EXCEPTIONT("--reps must be positive");
+	}
+
+	int nRank;
+	int nCommSize;
+	MPI_Comm_rank(MPI_COMM_WORLD, &nRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nCommSize);
+
+	// Open the output file
+	FILE * fp = NULL;
+	if ((nRank == 0) && (strOutputFile != "")) {
+		fp = fopen(strOutputFile.c_str(), "w");
+		if (fp == NULL) {
+			_EXCEPTION1("Unable to open output file \"%s\"",
+				strOutputFile.c_str());
+		}
+		fprintf(fp, "kernel,order,levels,resolution,ranks,"
+			"nodes,seconds,ns_per_node,gb_per_s\n");
+	}
+
+	// Sweep over configurations
+	for (int o = 0; o < vecOrders.size(); o++) {
+	for (int l = 0; l < vecLevels.size(); l++) {
+	for (int r = 0; r < vecResolutions.size(); r++) {
+
+		std::vector<KernelTiming> vecTimings;
+
+		BenchmarkConfiguration(
+			vecOrders[o],
+			vecLevels[l],
+			vecResolutions[r],
+			nPatchesPerProcessor,
+			nRepetitions,
+			vecTimings);
+
+		AnnounceBanner();
+		Announce("Order %i  Levels %i  Resolution %i  Ranks %i",
+			vecOrders[o], vecLevels[l], vecResolutions[r], nCommSize);
+		Announce("%-34s %12s %10s %10s",
+			"Kernel", "Nodes/rank", "ns/node", "GB/s");
+
+		for (int t = 0; t < vecTimings.size(); t++) {
+			const KernelTiming & timing = vecTimings[t];
+
+			// Time per node on each rank and throughput over all ranks
+			double dNsPerNode = 0.0;
+			double dGBPerSecond = 0.0;
+			if (timing.dNodes > 0.0) {
+				dNsPerNode =
+					1.0e9 * timing.dSeconds
+					* static_cast<double>(nCommSize) / timing.dNodes;
+			}
+			if (timing.dSeconds > 0.0) {
+				dGBPerSecond = 1.0e-9 * timing.dBytes / timing.dSeconds;
+			}
+
+			Announce("%-34s %12.0f %10.3f %10.3f",
+				timing.strName.c_str(),
+				timing.dNodes / static_cast<double>(
+					nCommSize * nRepetitions),
+				dNsPerNode,
+				dGBPerSecond);
+
+			if (fp != NULL) {
+				fprintf(fp, "%s,%i,%i,%i,%i,%1.0f,%1.6e,%1.6e,%1.6e\n",
+					timing.strName.c_str(),
+					vecOrders[o], vecLevels[l], vecResolutions[r],
+					nCommSize,
+					timing.dNodes,
+					timing.dSeconds,
+					dNsPerNode,
+					dGBPerSecond);
+			}
+		}
+	}
+	}
+	}
+
+	if (fp != NULL) {
+		fclose(fp);
+	}
+
+	AnnounceBanner();
+
+} catch(Exception & e) {
+	std::cout << e.ToString() << std::endl;
+}
+
+	// Deinitialize Tempest
+	TempestDeinitialize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,25 @@
+#!/bin/sh
+# Regression run for adaptive time stepping (--dt 0s).  At this resolution
+# a fixed time step of 1400s is stable for 10 days and 1500s is not, so
+# every adaptively chosen time step must stay at or below DTMAX.
+
+DTMAX=1400
+
+./BaroclinicWaveUMJSTest --resolution 6 --levels 10 --dt 0s --endtime 10d --outputtime 10d --output_none > adaptivedt.log 2>&1 || { echo "FAIL: run aborted"; exit 1; }
+
+if grep -qiE "nan|exception" adaptivedt.log; then
+	echo "FAIL: run became unstable"
+	exit 1
+fi
+
+awk -v dtmax=$DTMAX '
+	/dt = / {
+		dt = $NF; gsub(/[s)]/, "", dt); n++;
+		if (dt + 0 > max + 0) max = dt + 0;
+		if (dt + 0 <= 0 || dt + 0 > dtmax) bad++;
+	}
+	END {
+		printf("%d steps, maximum dt %ss\n", n, max);
+		if ((n == 0) || (bad > 0)) { print "FAIL: dt outside (0, " dtmax "]"; exit 1 }
+		print "PASS"
+	}' adaptivedt.log
@@ -0,0 +1,797 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	\file    ScalingBenchmark.cpp
+///	\author  agent
+///	\version October 16, 2026
+///
+///	<remarks>
+///		Copyright 2026 agent
+///
+///		This file is distributed as part of the Tempest source code package.
+///		Permission is granted to use, copy, modify and distribute this
+///		source code and its documentation under the terms of the GNU General
+///		Public License.  This software is provided "as is" without express
+///		or implied warranty.
+///	</remarks>
+
+#include "Preferences.h"
+#include "CommandLine.h"
+#include "Announce.h"
+#include "Exception.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <map>
+
+#include <sys/stat.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		A test case driver run by the scaling benchmark.
+///	</summary>
+struct ScalingTestCase {
+
+	///	<summary>
+	///		Name of the test case.
+	///	</summary>
+	std::string strName;
+
+	///	<summary>
+	///		Path to the driver executable.
+	///	</summary>
+	std::string strExecutable;
+
+	///	<summary>
+	///		Flag indicating the driver uses a Cartesian grid, with the
+	///		resolution given by --resx and --resy, rather than a cubed-sphere
+	///		grid with the resolution given by --resolution.
+	///	</summary>
+	bool fCartesian;
+
+	///	<summary>
+	///		Additional arguments passed to the driver.
+	///	</summary>
+	std::string strArguments;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		One run of a test case driver and its results.
+///	</summary>
+struct ScalingRun {
+
+	///	<summary>
+	///		Constructor.
+	///	</summary>
+	ScalingRun() :
+		ixTestCase(0),
+		nRanks(0),
+		nThreads(0),
+		nResolution(0),
+		nLevels(0),
+		fWeak(false),
+		fSuccess(false),
+		nSteps(0),
+		dWallTime(0.0),
+		dCommunicateTime(0.0),
+		dLoopImbalance(0.0),
+		dMaxWaitTime(0.0),
+		dSYPD(0.0),
+		dPeakMemory(0.0)
+	{ }
+
+	///	<summary>
+	///		Index of the test case.
+	///	</summary>
+	int ixTestCase;
+
+	///	<summary>
+	///		Number of MPI ranks.
+	///	</summary>
+	int nRanks;
+
+	///	<summary>
+	///		Number of OpenMP threads per rank.
+	///	</summary>
+	int nThreads;
+
+	///	<summary>
+	///		Horizontal resolution (elements per panel edge).
+	///	</summary>
+	int nResolution;
+
+	///	<summary>
+	///		Number of vertical levels.
+	///	</summary>
+	int nLevels;
+
+	///	<summary>
+	///		Flag indicating this run belongs to the weak scaling series.
+	///	</summary>
+	bool fWeak;
+
+	///	<summary>
+	///		Tag identifying the output files of this run.
+	///	</summary>
+	std::string strTag;
+
+	///	<summary>
+	///		Number of grid nodes.
+	///	</summary>
+	double dNodes;
+
+	///	<summary>
+	///		Flag indicating the run completed and its reports were read.
+	///	</summary>
+	bool fSuccess;
+
+	///	<summary>
+	///		Number of timed steps (after warmup).
+	///	</summary>
+	int nSteps;
+
+	///	<summary>
+	///		Wall time of the timed steps on the slowest rank (in seconds).
+	///	</summary>
+	double dWallTime;
+
+	///	<summary>
+	///		Communication time of the timed steps on the slowest rank.
+	///	</summary>
+	double dCommunicateTime;
+
+	///	<summary>
+	///		Load imbalance (maximum over mean) of the time step loop.
+	///	</summary>
+	double dLoopImbalance;
+
+	///	<summary>
+	///		Maximum total exchange wait time over ranks (in seconds).
+	///	</summary>
+	double dMaxWaitTime;
+
+	///	<summary>
+	///		Throughput over the last steps of the run.
+	///	</summary>
+	double dSYPD;
+
+	///	<summary>
+	///		Peak resident set size over ranks (in MB).
+	///	</summary>
+	double dPeakMemory;
+
+	///	<summary>
+	///		Get the wall time per step.
+	///	</summary>
+	double GetTimePerStep() const {
+		if (nSteps == 0) {
+			return 0.0;
+		}
+		return dWallTime / static_cast<double>(nSteps);
+	}
+
+	///	<summary>
+	///		Get the number of cores.
+	///	</summary>
+	int GetCores() const {
+		return (nRanks * nThreads);
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Split a comma-separated list, removing surrounding whitespace.
+///	</summary>
+void ParseList(
+	const std::string & strList,
+	std::vector<std::string> & vecItems
+) {
+	vecItems.clear();
+
+	size_t sBegin = 0;
+	while (sBegin <= strList.length()) {
+		size_t sEnd = strList.find(',', sBegin);
+		if (sEnd == std::string::npos) {
+			sEnd = strList.length();
+		}
+
+		std::string strItem = strList.substr(sBegin, sEnd - sBegin);
+
+		size_t sFirst = strItem.find_first_not_of(" \t");
+		size_t sLast = strItem.find_last_not_of(" \t");
+		if (sFirst != std::string::npos) {
+			vecItems.push_back(strItem.substr(sFirst, sLast - sFirst + 1));
+		}
+
+		sBegin = sEnd + 1;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Get a comma-separated list of positive integers from the
+///		configuration.
+///	</summary>
+void GetIntegerList(
+	const Preferences & prefs,
+	const char * szName,
+	std::vector<int> & vecValues
+) {
+	std::vector<std::string> vecItems;
+	ParseList(prefs.GetPreferenceAsString_NoThrow(szName), vecItems);
+
+	vecValues.clear();
+	for (int i = 0; i < vecItems.size(); i++) {
+		int nValue = atoi(vecItems[i].c_str());
+		if (nValue < 1) {
+			_EXCEPTION2("Invalid value \"%s\" in \"%s\"",
+				vecItems[i].c_str(), szName);
+		}
+		vecValues.push_back(nValue);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Read the CSV file with the given name, skipping the header.  Each
+///		row is split into its fields.
+///	</summary>
+bool ReadCSV(
+	const std::string & strFilename,
+	std::vector< std::vector<std::string> > & vecRows
+) {
+	vecRows.clear();
+
+	FILE * fp = fopen(strFilename.c_str(), "r");
+	if (fp == NULL) {
+		return false;
+	}
+
+	char szBuffer[1024];
+	bool fHeader = true;
+	while (fgets(szBuffer, 1024, fp) != NULL) {
+		size_t sLength = strlen(szBuffer);
+		while ((sLength > 0) &&
+		       ((szBuffer[sLength-1] == '\n') || (szBuffer[sLength-1] == '\r'))
+		) {
+			szBuffer[--sLength] = '\0';
+		}
+		if (fHeader) {
+			fHeader = false;
+			continue;
+		}
+		if (sLength == 0) {
+			continue;
+		}
+
+		vecRows.push_back(std::vector<std::string>());
+		ParseList(szBuffer, vecRows.back());
+	}
+
+	fclose(fp);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Read the results of a run from its performance log, profile and
+///		exchange statistics.  The first nWarmupSteps steps are not timed.
+///	</summary>
+bool ReadRunResults(
+	const std::string & strOutputDir,
+	int nWarmupSteps,
+	ScalingRun & run
+) {
+	// The drivers report exceptions on the console, so a run that failed
+	// part way through is identified from its log
+	FILE * fpLog = fopen((strOutputDir + "/" + run.strTag + ".log").c_str(), "r");
+	if (fpLog != NULL) {
+		char szBuffer[1024];
+		bool fException = false;
+		while (fgets(szBuffer, 1024, fpLog) != NULL) {
+			if (strstr(szBuffer, "EXCEPTION") != NULL) {
+				fException = true;
+				break;
+			}
+		}
+		fclose(fpLog);
+
+		if (fException) {
+			return false;
+		}
+	}
+
+	std::vector< std::vector<std::string> > vecRows;
+
+	// Performance log: step,time,dt,wall,wall_rank,dynamics,dynamics_rank,
+	// physics,physics_rank,output,output_rank,communicate,communicate_rank,
+	// mpi_messages,mpi_bytes,local_messages,local_bytes,shm_messages,
+	// shm_bytes,sdpd,sypd,rss_mb,rss_rank
+	if (!ReadCSV(strOutputDir + "/" + run.strTag + "_perf.csv", vecRows)) {
+		return false;
+	}
+
+	for (int i = 0; i < vecRows.size(); i++) {
+		if (vecRows[i].size() != 23) {
+			return false;
+		}
+		if (i >= nWarmupSteps) {
+			run.nSteps++;
+			run.dWallTime += atof(vecRows[i][3].c_str());
+			run.dCommunicateTime += atof(vecRows[i][11].c_str());
+		}
+		run.dSYPD = atof(vecRows[i][20].c_str());
+
+		double dMemory = atof(vecRows[i][21].c_str());
+		if (dMemory > run.dPeakMemory) {
+			run.dPeakMemory = dMemory;
+		}
+	}
+
+	if (run.nSteps == 0) {
+		return false;
+	}
+
+	// Profile: region,depth,calls,min,mean,max,imbalance,self
+	if (ReadCSV(strOutputDir + "/" + run.strTag + "_profile.csv", vecRows)) {
+		for (int i = 0; i < vecRows.size(); i++) {
+			if ((vecRows[i].size() == 8) && (vecRows[i][0] == "Loop")) {
+				run.dLoopImbalance = atof(vecRows[i][6].c_str());
+			}
+		}
+	}
+
+	// Exchange statistics: rank,site,datatype,exchanges,messages_sent,
+	// bytes_sent,messages_received,bytes_received,local_messages_sent,
+	// local_bytes_sent,shm_messages_sent,shm_bytes_sent,pack,unpack,
+	// wait_recv,wait_send
+	if (ReadCSV(strOutputDir + "/" + run.strTag + "_exchange.csv", vecRows)) {
+		std::map<int, double> mapRankWaitTime;
+		for (int i = 0; i < vecRows.size(); i++) {
+			if (vecRows[i].size() != 16) {
+				continue;
+			}
+			mapRankWaitTime[atoi(vecRows[i][0].c_str())] +=
+				atof(vecRows[i][14].c_str()) + atof(vecRows[i][15].c_str());
+		}
+
+		std::map<int, double>::const_iterator iter = mapRankWaitTime.begin();
+		for (; iter != mapRankWaitTime.end(); iter++) {
+			if (iter->second > run.dMaxWaitTime) {
+				run.dMaxWaitTime = iter->second;
+			}
+		}
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+///	<summary>
+///		Announce a scaling efficiency table for a series of runs, sorted
+///		by increasing number of cores.  Strong scaling efficiency is the
+///		speedup over the smallest run divided by the increase in cores.
+///		Weak scaling efficiency is the throughput per core (nodes updated
+///		per second per core) relative to the smallest run.
+///	</summary>
+void AnnounceScalingTable(
+	const std::vector<ScalingRun> & vecRuns,
+	const std::vector<int> & vecSeries,
+	bool fWeak
+) {
+	Announce("%8s %8s %8s %12s %12s %10s %10s %8s",
+		"Ranks", "Threads", "Res", "Nodes/core", "s/step",
+		fWeak ? "Scaled" : "Speedup", "Efficiency", "Comm%");
+
+	const ScalingRun & base = vecRuns[vecSeries[0]];
+
+	for (int s = 0; s < vecSeries.size(); s++) {
+		const ScalingRun & run = vecRuns[vecSeries[s]];
+
+		double dNodesPerCore =
+			run.dNodes / static_cast<double>(run.GetCores());
+
+		double dCommunicate = 0.0;
+		if (run.dWallTime > 0.0) {
+			dCommunicate = 100.0 * run.dCommunicateTime / run.dWallTime;
+		}
+
+		double dSpeedup = 0.0;
+		double dEfficiency = 0.0;
+
+		if (run.GetTimePerStep() > 0.0) {
+			if (fWeak) {
+				double dBaseRate =
+					base.dNodes / base.GetTimePerStep()
+					/ static_cast<double>(base.GetCores());
+				double dRate =
+					run.dNodes / run.GetTimePerStep()
+					/ static_cast<double>(run.GetCores());
+
+				dSpeedup =
+					dRate * static_cast<double>(run.GetCores()) / dBaseRate;
+				dEfficiency = dRate / dBaseRate;
+
+			} else {
+				dSpeedup = base.GetTimePerStep() / run.GetTimePerStep();
+				dEfficiency =
+					dSpeedup * static_cast<double>(base.GetCores())
+					/ static_cast<double>(run.GetCores());
+			}
+		}
+
+		Announce("%8i %8i %8i %12.0f %12.5f %10.3f %9.1f%% %7.1f%%",
+			run.nRanks, run.nThreads, run.nResolution,
+			dNodesPerCore, run.GetTimePerStep(),
+			dSpeedup, 100.0 * dEfficiency, dCommunicate);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv) {
+
+try {
+	// Configuration file
+	std::string strConfigFile;
+
+	// Only print the commands
+	bool fDryRun;
+
+	// Parse the command line
+	BeginCommandLine()
+		CommandLineString(strConfigFile, "config", "");
+		CommandLineBool(fDryRun, "dry_run");
+
+		ParseCommandLine(argc, argv);
+	EndCommandLine(argv)
+
+	AnnounceBanner();
+
+	if (strConfigFile == "") {
+		_EXCEPTIONT("No configuration file specified (--config)");
+	}
+
+	// Read the configuration
+	Preferences prefs(strConfigFile.c_str());
+
+	std::vector<std::string> vecTestCaseNames;
+	ParseList(prefs.GetPreferenceAsString("testcases"), vecTestCaseNames);
+
+	if (vecTestCaseNames.size() == 0) {
+		_EXCEPTIONT("No test cases specified (testcases)");
+	}
+
+	std::vector<ScalingTestCase> vecTestCases(vecTestCaseNames.size());
+	for (int t = 0; t < vecTestCaseNames.size(); t++) {
+		std::string strPrefix = vecTestCaseNames[t] + ".";
+
+		vecTestCases[t].strName = vecTestCaseNames[t];
+		vecTestCases[t].strExecutable =
+			prefs.GetPreferenceAsString((strPrefix + "exec").c_str());
+		vecTestCases[t].strArguments =
+			prefs.GetPreferenceAsString_NoThrow((strPrefix + "args").c_str());
+
+		std::string strGrid =
+			prefs.GetPreferenceAsString_NoCase_NoThrow(
+				(strPrefix + "grid").c_str());
+
+		if ((strGrid == "") || (strGrid == "cubedsphere")) {
+			vecTestCases[t].fCartesian = false;
+		} else if (strGrid == "cartesian") {
+			vecTestCases[t].fCartesian = true;
+		} else {
+			_EXCEPTION2("Invalid value \"%s\" in \"%sgrid\": "
+				"Expected \"cubedsphere\" or \"cartesian\"",
+				strGrid.c_str(), strPrefix.c_str());
+		}
+	}
+
+	std::vector<int> vecRanks;
+	std::vector<int> vecThreads;
+	std::vector<int> vecResolutions;
+	std::vector<int> vecLevels;
+	std::vector<int> vecWeakResolutions;
+
+	GetIntegerList(prefs, "ranks", vecRanks);
+	GetIntegerList(prefs, "threads", vecThreads);
+	GetIntegerList(prefs, "resolutions", vecResolutions);
+	GetIntegerList(prefs, "levels", vecLevels);
+	GetIntegerList(prefs, "weak_resolutions", vecWeakResolutions);
+
+	if (vecRanks.size() == 0) {
+		_EXCEPTIONT("No rank counts specified (ranks)");
+	}
+	if (vecThreads.size() == 0) {
+		vecThreads.push_back(1);
+	}
+	if (vecLevels.size() == 0) {
+		_EXCEPTIONT("No levels specified (levels)");
+	}
+	if ((vecWeakResolutions.size() != 0) &&
+	    (vecWeakResolutions.size() != vecRanks.size())
+	) {
+		_EXCEPTIONT("weak_resolutions must contain one resolution for "
+			"each entry of ranks");
+	}
+
+	int iError;
+
+	int nOrder = prefs.GetPreferenceAsInt_NoThrow("order", &iError);
+	if (iError != 0) {
+		nOrder = 4;
+	}
+
+	int nWarmupSteps =
+		prefs.GetPreferenceAsInt_NoThrow("warmup_steps", &iError);
+	if (iError != 0) {
+		nWarmupSteps = 1;
+	}
+
+	std::string strLauncher =
+		prefs.GetPreferenceAsString_NoThrow("launcher", &iError);
+	if (iError != 0) {
+		strLauncher = "mpirun -np";
+	}
+
+	std::string strOutputDir =
+		prefs.GetPreferenceAsString_NoThrow("output_dir", &iError);
+	if (iError != 0) {
+		strOutputDir = "scaling";
+	}
+
+	// Build the matrix of runs: the strong scaling series runs each
+	// resolution on every rank count and the weak scaling series runs
+	// each rank count with its own resolution
+	std::vector<ScalingRun> vecRuns;
+
+	for (int t = 0; t < vecTestCases.size(); t++) {
+	for (int l = 0; l < vecLevels.size(); l++) {
+	for (int h = 0; h < vecThreads.size(); h++) {
+	for (int w = 0; w < 2; w++) {
+
+		const std::vector<int> & vecSeriesResolutions =
+			(w == 0)?(vecResolutions):(vecWeakResolutions);
+
+		for (int r = 0; r < vecSeriesResolutions.size(); r++) {
+		for (int p = 0; p < vecRanks.size(); p++) {
+			if ((w == 1) && (p != r)) {
+				continue;
+			}
+
+			ScalingRun run;
+			run.ixTestCase = t;
+			run.nRanks = vecRanks[p];
+			run.nThreads = vecThreads[h];
+			run.nResolution = vecSeriesResolutions[r];
+			run.nLevels = vecLevels[l];
+			run.fWeak = (w == 1);
+
+			double dColumns =
+				static_cast<double>(run.nResolution * nOrder)
+				* static_cast<double>(run.nResolution * nOrder);
+
+			if (!vecTestCases[t].fCartesian) {
+				dColumns *= 6.0;
+			}
+
+			run.dNodes = dColumns * static_cast<double>(run.nLevels);
+
+			char szTag[256];
+			snprintf(szTag, 256, "%s_%s_p%i_t%i_r%i_l%i",
+				vecTestCases[t].strName.c_str(),
+				run.fWeak ? "weak" : "strong",
+				run.nRanks, run.nThreads, run.nResolution, run.nLevels);
+
+			run.strTag = szTag;
+
+			vecRuns.push_back(run);
+		}
+		}
+	}
+	}
+	}
+	}
+
+	Announce("Test cases: %i  Runs: %i", (int)vecTestCases.size(), (int)vecRuns.size());
+
+	if (!fDryRun) {
+		mkdir(strOutputDir.c_str(), 0755);
+	}
+
+	// Execute all runs
+	for (int i = 0; i < vecRuns.size(); i++) {
+		ScalingRun & run = vecRuns[i];
+
+		const ScalingTestCase & testcase = vecTestCases[run.ixTestCase];
+
+		std::string strPrefix = strOutputDir + "/" + run.strTag;
+
+		char szResolution[64];
+		if (testcase.fCartesian) {
+			snprintf(szResolution, 64, "--resx %i --resy %i",
+				run.nResolution, run.nResolution);
+		} else {
+			snprintf(szResolution, 64, "--resolution %i", run.nResolution);
+		}
+
+		char szCommand[2048];
+		snprintf(szCommand, 2048,
+			"OMP_NUM_THREADS=%i %s %i %s %s --levels %i --order %i %s "
+			"--output_none --output_dir %s "
+			"--profile_file %s_profile.csv "
+			"--profile_exchange_file %s_exchange.csv "
+			"--perf_log %s_perf.csv > %s.log 2>&1",
+			run.nThreads,
+			strLauncher.c_str(),
+			run.nRanks,
+			testcase.strExecutable.c_str(),
+			szResolution,
+			run.nLevels,
+			nOrder,
+			testcase.strArguments.c_str(),
+			strPrefix.c_str(),
+			strPrefix.c_str(),
+			strPrefix.c_str(),
+			strPrefix.c_str(),
+			strPrefix.c_str());
+
+		Announce("[%i/%i] %s", i+1, (int)vecRuns.size(), szCommand);
+
+		if (fDryRun) {
+			continue;
+		}
+
+		int iResult = system(szCommand);
+		if (iResult != 0) {
+			Announce("  run failed (%i): see %s.log", iResult,
+				strPrefix.c_str());
+			continue;
+		}
+
+		run.fSuccess = ReadRunResults(strOutputDir, nWarmupSteps, run);
+		if (!run.fSuccess) {
+			Announce("  unable to read results: see %s.log",
+				strPrefix.c_str());
+		}
+	}
+
+	if (fDryRun) {
+		AnnounceBanner();
+		return 0;
+	}
+
+	// Write a summary of all runs
+	std::string strSummaryFile = strOutputDir + "/scaling_summary.csv";
+
+	FILE * fp = fopen(strSummaryFile.c_str(), "w");
+	if (fp == NULL) {
+		_EXCEPTION1("Unable to open summary file \"%s\"",
+			strSummaryFile.c_str());
+	}
+
+	fprintf(fp, "testcase,series,ranks,threads,resolution,levels,nodes,"
+		"success,steps,wall,s_per_step,communicate,loop_imbalance,"
+		"max_wait,sypd,rss_mb\n");
+
+	for (int i = 0; i < vecRuns.size(); i++) {
+		const ScalingRun & run = vecRuns[i];
+
+		fprintf(fp, "%s,%s,%i,%i,%i,%i,%1.0f,%i,%i,"
+			"%1.6e,%1.6e,%1.6e,%1.6f,%1.6e,%1.6e,%1.3f\n",
+			vecTestCases[run.ixTestCase].strName.c_str(),
+			run.fWeak ? "weak" : "strong",
+			run.nRanks, run.nThreads, run.nResolution, run.nLevels,
+			run.dNodes,
+			run.fSuccess ? 1 : 0,
+			run.nSteps,
+			run.dWallTime,
+			run.GetTimePerStep(),
+			run.dCommunicateTime,
+			run.dLoopImbalance,
+			run.dMaxWaitTime,
+			run.dSYPD,
+			run.dPeakMemory);
+	}
+
+	fclose(fp);
+
+	// Announce the results of each run
+	AnnounceBanner("RUNS");
+	Announce("%-24s %6s %6s %6s %6s %6s %12s %8s %10s %10s %10s",
+		"TestCase", "Series", "Ranks", "Thr", "Res", "Lev",
+		"s/step", "Imbal", "MaxWait", "SYPD", "RSS(MB)");
+
+	for (int i = 0; i < vecRuns.size(); i++) {
+		const ScalingRun & run = vecRuns[i];
+
+		if (!run.fSuccess) {
+			Announce("%-24s %6s %6i %6i %6i %6i %12s",
+				vecTestCases[run.ixTestCase].strName.c_str(),
+				run.fWeak ? "weak" : "strong",
+				run.nRanks, run.nThreads, run.nResolution, run.nLevels,
+				"FAILED");
+			continue;
+		}
+
+		Announce("%-24s %6s %6i %6i %6i %6i %12.5f %8.3f %10.4f %10.3f %10.1f",
+			vecTestCases[run.ixTestCase].strName.c_str(),
+			run.fWeak ? "weak" : "strong",
+			run.nRanks, run.nThreads, run.nResolution, run.nLevels,
+			run.GetTimePerStep(),
+			run.dLoopImbalance,
+			run.dMaxWaitTime,
+			run.dSYPD,
+			run.dPeakMemory);
+	}
+
+	// Group successful runs into series, ordered by number of cores
+	typedef std::map<std::string, std::vector<int> > SeriesMap;
+
+	SeriesMap mapSeries;
+
+	for (int i = 0; i < vecRuns.size(); i++) {
+		const ScalingRun & run = vecRuns[i];
+		if (!run.fSuccess) {
+			continue;
+		}
+
+		char szSeries[256];
+		if (run.fWeak) {
+			snprintf(szSeries, 256, "%s: weak scaling, %i levels",
+				vecTestCases[run.ixTestCase].strName.c_str(),
+				run.nLevels);
+		} else {
+			snprintf(szSeries, 256,
+				"%s: strong scaling, resolution %i, %i levels",
+				vecTestCases[run.ixTestCase].strName.c_str(),
+				run.nResolution, run.nLevels);
+		}
+
+		std::vector<int> & vecSeries = mapSeries[szSeries];
+
+		int s = static_cast<int>(vecSeries.size());
+		vecSeries.push_back(i);
+		for (; s > 0; s--) {
+			if (vecRuns[vecSeries[s-1]].GetCores() <= run.GetCores()) {
+				break;
+			}
+			vecSeries[s] = vecSeries[s-1];
+			vecSeries[s-1] = i;
+		}
+	}
+
+	// Announce the scaling efficiency of each series
+	SeriesMap::const_iterator iterSeries = mapSeries.begin();
+	for (; iterSeries != mapSeries.end(); iterSeries++) {
+		AnnounceBanner(iterSeries->first.c_str());
+		AnnounceScalingTable(
+			vecRuns,
+			iterSeries->second,
+			vecRuns[iterSeries->second[0]].fWeak);
+	}
+
+	AnnounceBanner();
+
+	Announce("Summary written to %s", strSummaryFile.c_str());
+
+} catch(Exception & e) {
+	Announce(e.ToString().c_str());
+	return 1;
+}
+
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+